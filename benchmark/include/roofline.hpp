@@ -0,0 +1,364 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Roofline benchmark harness.
+ *
+ * The peak floating point throughput and the peak memory bandwidth of
+ * the machine are measured at startup with an FMA kernel and a STREAM
+ * triad kernel. Each benchmark declares its number of floating point
+ * operations and of bytes moved, and is reported with its achieved
+ * GFLOPS and GB/s and the fraction of the attainable performance given
+ * by the roofline model. The results can be written as JSON and compared
+ * with a previous run to detect regressions.
+ *
+ * The bandwidth roof is the bandwidth of the main memory, a fraction above
+ * 100% indicates a working set served from the caches.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "etl/etl.hpp"
+
+namespace roofline {
+
+using clock = std::chrono::steady_clock;
+
+/*!
+ * \brief The measured peaks of the machine
+ */
+struct machine {
+    double sp_gflops = 0.0; ///< Peak single-precision GFLOPS
+    double dp_gflops = 0.0; ///< Peak double-precision GFLOPS
+    double gbs       = 0.0; ///< Peak memory bandwidth (GB/s)
+    size_t threads   = 1;   ///< The number of threads used for the peaks
+};
+
+/*!
+ * \brief The result of one benchmark
+ */
+struct result {
+    std::string name; ///< The name of the benchmark
+    std::string size; ///< The size of the benchmark
+    double time;      ///< The time of one run (ns)
+    double flops;     ///< The number of floating point operations of one run
+    double bytes;     ///< The number of bytes moved by one run
+    double gflops;    ///< The achieved GFLOPS
+    double gbs;       ///< The achieved GB/s
+    double fraction;  ///< The fraction of the attainable performance
+};
+
+/*!
+ * \brief Run the functor on the given number of threads and returns the
+ * elapsed time in seconds
+ */
+template <typename Functor>
+double run_threads(size_t threads, Functor&& functor) {
+    std::vector<std::thread> pool;
+
+    auto start = clock::now();
+
+    for (size_t t = 0; t < threads; ++t) {
+        pool.emplace_back([&functor, t]() { functor(t); });
+    }
+
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    return std::chrono::duration<double>(clock::now() - start).count();
+}
+
+/*!
+ * \brief Measure the FMA peak of the given type, in GFLOPS.
+ *
+ * Each thread updates many independent accumulators so that the latency
+ * of the FMA units is hidden.
+ */
+template <typename T>
+double measure_fma_peak(size_t threads) {
+    constexpr size_t accumulators = 64;
+    constexpr size_t iterations   = 2000000;
+
+    std::vector<T> sink(threads);
+
+    double best = 0.0;
+
+    for (size_t repeat = 0; repeat < 3; ++repeat) {
+        auto seconds = run_threads(threads, [&sink](size_t t) {
+            T acc[accumulators];
+
+            for (size_t j = 0; j < accumulators; ++j) {
+                acc[j] = T(j + t);
+            }
+
+            const T a = T(0.999999);
+            const T b = T(0.000001);
+
+            for (size_t i = 0; i < iterations; ++i) {
+                for (size_t j = 0; j < accumulators; ++j) {
+                    acc[j] = std::fma(acc[j], a, b);
+                }
+            }
+
+            T sum(0);
+
+            for (size_t j = 0; j < accumulators; ++j) {
+                sum += acc[j];
+            }
+
+            sink[t] = sum;
+        });
+
+        best = std::max(best, 2.0 * accumulators * iterations * threads / seconds / 1e9);
+    }
+
+    // Keep the accumulators alive
+    volatile T total = std::accumulate(sink.begin(), sink.end(), T(0));
+    (void)total;
+
+    return best;
+}
+
+/*!
+ * \brief Measure the memory bandwidth with the STREAM triad kernel
+ * (a = b + s * c) on arrays much larger than the caches, in GB/s
+ */
+inline double measure_bandwidth(size_t threads) {
+    constexpr size_t n = 1UL << 23;
+
+    std::vector<double> a(n, 0.0);
+    std::vector<double> b(n, 1.0);
+    std::vector<double> c(n, 2.0);
+
+    const size_t chunk = n / threads;
+
+    double best = 0.0;
+
+    for (size_t repeat = 0; repeat < 5; ++repeat) {
+        auto seconds = run_threads(threads, [&](size_t t) {
+            const size_t first = t * chunk;
+            const size_t last  = t == threads - 1 ? n : first + chunk;
+
+            for (size_t i = first; i < last; ++i) {
+                a[i] = b[i] + 3.0 * c[i];
+            }
+        });
+
+        best = std::max(best, 3.0 * sizeof(double) * n / seconds / 1e9);
+    }
+
+    return best;
+}
+
+/*!
+ * \brief Measure the peaks of the machine.
+ *
+ * All the hardware threads are used when ETL is in parallel mode,
+ * otherwise a single thread is used.
+ */
+inline machine measure_machine() {
+    machine peak;
+
+    peak.threads   = etl::is_parallel ? std::max(1U, std::thread::hardware_concurrency()) : 1;
+    peak.sp_gflops = measure_fma_peak<float>(peak.threads);
+    peak.dp_gflops = measure_fma_peak<double>(peak.threads);
+    peak.gbs       = measure_bandwidth(peak.threads);
+
+    return peak;
+}
+
+/*!
+ * \brief A suite of roofline benchmarks
+ */
+struct suite {
+    machine peak;                ///< The peaks of the machine
+    std::vector<result> results; ///< The results of the benchmarks
+    double min_time = 0.25;      ///< The minimum time to run each benchmark (s)
+    std::string filter;          ///< Only run the benchmarks containing this string
+
+    /*!
+     * \brief Measure the peaks of the machine and print them
+     */
+    void init() {
+        peak = measure_machine();
+
+        printf("Machine (%zu threads): %.2f SP GFLOPS, %.2f DP GFLOPS, %.2f GB/s\n\n", peak.threads, peak.sp_gflops, peak.dp_gflops, peak.gbs);
+        printf(" %-32s | %-16s | %12s | %9s | %9s | %6s\n", "Benchmark", "Size", "Time", "GFLOPS", "GB/s", "Peak");
+    }
+
+    /*!
+     * \brief Run a benchmark
+     *
+     * \param name The name of the benchmark
+     * \param size The size of the benchmark
+     * \param flops The number of floating point operations of one run
+     * \param bytes The number of bytes moved by one run
+     * \param functor The functor to benchmark
+     * \tparam T The value type of the benchmark (selects the FLOPS peak)
+     */
+    template <typename T, typename Functor>
+    void bench(const std::string& name, const std::string& size, double flops, double bytes, Functor&& functor) {
+        if (!filter.empty() && name.find(filter) == std::string::npos) {
+            return;
+        }
+
+        // Warmup and estimation of the number of runs
+        auto start = clock::now();
+        functor();
+        double estimate = std::chrono::duration<double>(clock::now() - start).count();
+
+        const size_t runs = std::max<size_t>(1, size_t(min_time / 5.0 / std::max(estimate, 1e-9)));
+
+        // Best mean of five batches
+        double best = std::numeric_limits<double>::max();
+
+        for (size_t batch = 0; batch < 5; ++batch) {
+            start = clock::now();
+
+            for (size_t r = 0; r < runs; ++r) {
+                functor();
+            }
+
+            best = std::min(best, std::chrono::duration<double, std::nano>(clock::now() - start).count() / runs);
+        }
+
+        result r;
+        r.name   = name;
+        r.size   = size;
+        r.time   = best;
+        r.flops  = flops;
+        r.bytes  = bytes;
+        r.gflops = flops / best;
+        r.gbs    = bytes / best;
+
+        // The attainable performance from the roofline model
+        const double flops_peak = std::is_same_v<T, float> || std::is_same_v<T, std::complex<float>> ? peak.sp_gflops : peak.dp_gflops;
+
+        if (flops > 0.0) {
+            r.fraction = r.gflops / std::min(flops_peak, flops / bytes * peak.gbs);
+        } else {
+            r.fraction = r.gbs / peak.gbs;
+        }
+
+        printf(" %-32s | %-16s | %12s | %9.2f | %9.2f | %5.1f%%\n", name.c_str(), size.c_str(), etl::duration_string(best).c_str(), r.gflops, r.gbs,
+               100.0 * r.fraction);
+
+        results.push_back(r);
+    }
+
+    /*!
+     * \brief Write the machine and the results as JSON, with one result
+     * per line
+     *
+     * \param path The path of the file
+     * \return true if the file was written, false otherwise
+     */
+    bool write_json(const std::string& path) const {
+        std::ofstream stream(path);
+
+        if (!stream) {
+            return false;
+        }
+
+        stream << "{\n\"machine\": {\"threads\": " << peak.threads << ", \"sp_gflops\": " << peak.sp_gflops << ", \"dp_gflops\": " << peak.dp_gflops
+               << ", \"gbs\": " << peak.gbs << "},\n\"results\": [";
+
+        for (size_t i = 0; i < results.size(); ++i) {
+            auto& r = results[i];
+
+            stream << (i ? ",\n" : "\n") << "{\"name\": \"" << r.name << "\", \"size\": \"" << r.size << "\", \"time\": " << r.time
+                   << ", \"flops\": " << r.flops << ", \"bytes\": " << r.bytes << ", \"gflops\": " << r.gflops << ", \"gbs\": " << r.gbs
+                   << ", \"fraction\": " << r.fraction << "}";
+        }
+
+        stream << "\n]\n}\n";
+
+        return bool(stream);
+    }
+
+    /*!
+     * \brief Compare the results with the results of a JSON file written by
+     * write_json.
+     *
+     * \param path The path of the reference file
+     * \param tolerance The relative slowdown tolerated
+     * \return The number of regressions, or -1 if the file cannot be read
+     */
+    int compare(const std::string& path, double tolerance) const {
+        std::ifstream stream(path);
+
+        if (!stream) {
+            return -1;
+        }
+
+        auto field = [](const std::string& line, const std::string& key) {
+            auto start = line.find("\"" + key + "\": ");
+
+            if (start == std::string::npos) {
+                return std::string();
+            }
+
+            start += key.size() + 4;
+
+            if (line[start] == '"') {
+                return line.substr(start + 1, line.find('"', start + 1) - start - 1);
+            }
+
+            return line.substr(start, line.find_first_of(",}", start) - start);
+        };
+
+        int regressions = 0;
+
+        std::string line;
+
+        printf("\nComparison with %s (tolerance %.0f%%)\n", path.c_str(), 100.0 * tolerance);
+
+        while (std::getline(stream, line)) {
+            auto name = field(line, "name");
+            auto size = field(line, "size");
+            auto time = field(line, "time");
+
+            if (name.empty() || time.empty()) {
+                continue;
+            }
+
+            const double reference = std::stod(time);
+
+            for (auto& r : results) {
+                if (r.name == name && r.size == size) {
+                    const double ratio = r.time / reference;
+
+                    if (ratio > 1.0 + tolerance) {
+                        printf(" REGRESSION %-32s | %-16s | %.2fx slower\n", name.c_str(), size.c_str(), ratio);
+                        ++regressions;
+                    } else if (ratio < 1.0 / (1.0 + tolerance)) {
+                        printf(" improvement %-31s | %-16s | %.2fx faster\n", name.c_str(), size.c_str(), 1.0 / ratio);
+                    }
+                }
+            }
+        }
+
+        printf(" %d regression(s)\n", regressions);
+
+        return regressions;
+    }
+};
+
+} //end of namespace roofline
@@ -0,0 +1,368 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Measure the crossovers between the implementations on this
+ * machine and write them as a tuning profile.
+ *
+ * Usage: etl_autotune [--quick] [file]
+ *
+ * The profile (etl_tuning.conf by default) is used by setting the
+ * ETL_TUNING_PROFILE environment variable to its path.
+ */
+
+#ifndef ETL_MANUAL_SELECT
+#define ETL_MANUAL_SELECT
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "etl/etl.hpp"
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+double min_time = 0.1; ///< The minimum time to run each measurement (s)
+
+/*!
+ * \brief Returns the best mean time of a run of the functor, in
+ * nanoseconds
+ */
+double measure(const std::function<void()>& functor) {
+    // Warmup and estimation of the number of runs
+    auto start = clock_type::now();
+    functor();
+    double estimate = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    const size_t runs = std::max<size_t>(1, size_t(min_time / 3.0 / std::max(estimate, 1e-9)));
+
+    double best = std::numeric_limits<double>::max();
+
+    for (size_t batch = 0; batch < 3; ++batch) {
+        start = clock_type::now();
+
+        for (size_t r = 0; r < runs; ++r) {
+            functor();
+        }
+
+        best = std::min(best, std::chrono::duration<double, std::nano>(clock_type::now() - start).count() / runs);
+    }
+
+    return best;
+}
+
+/*!
+ * \brief A candidate size of a crossover search
+ */
+struct candidate {
+    size_t size;                  ///< The size of the operation
+    size_t value;                 ///< The threshold value selecting the small path up to this size
+    std::function<void()> run;    ///< Run the operation once
+};
+
+/*!
+ * \brief Find the crossover between the small path (threshold at its
+ * maximum) and the large path (threshold at zero) of a threshold.
+ *
+ * The candidates are measured by increasing size, the threshold is set
+ * to the value of the last candidate for which the small path is not
+ * slower, stopping at the first candidate where the large path wins.
+ *
+ * \param name The name of the threshold
+ * \param threshold The threshold in the profile
+ * \param candidates The candidates, by increasing size
+ */
+void crossover(const char* name, size_t& threshold, const std::vector<candidate>& candidates) {
+    const size_t initial = threshold;
+
+    size_t value = 0;
+
+    for (auto& c : candidates) {
+        threshold = std::numeric_limits<size_t>::max();
+        const double small = measure(c.run);
+
+        threshold = 0;
+        const double large = measure(c.run);
+
+        printf("   %-28s %10zu: small %12.0fns large %12.0fns\n", name, c.size, small, large);
+
+        if (large < small) {
+            break;
+        }
+
+        value = c.value;
+    }
+
+    threshold = value;
+
+    printf(" %-30s %zu (default %zu)\n", name, threshold, initial);
+}
+
+std::vector<candidate> gemm_candidates(const std::vector<size_t>& sizes, bool nt, bool cm) {
+    std::vector<candidate> candidates;
+
+    for (auto n : sizes) {
+        candidate c;
+        c.size  = n;
+        c.value = n * n;
+
+        if (cm) {
+            auto a = std::make_shared<etl::dyn_matrix_cm<float>>(n, n);
+            auto b = std::make_shared<etl::dyn_matrix_cm<float>>(n, n);
+            auto r = std::make_shared<etl::dyn_matrix_cm<float>>(n, n);
+
+            *a = etl::normal_generator<float>();
+            *b = etl::normal_generator<float>();
+
+            c.run = [a, b, r]() { *r = selected_helper(etl::gemm_impl::VEC, *a * *b); };
+        } else {
+            auto a = std::make_shared<etl::dyn_matrix<float>>(n, n);
+            auto b = std::make_shared<etl::dyn_matrix<float>>(n, n);
+            auto r = std::make_shared<etl::dyn_matrix<float>>(n, n);
+
+            *a = etl::normal_generator<float>();
+            *b = etl::normal_generator<float>();
+
+            if (nt) {
+                c.run = [a, b, r]() { *r = selected_helper(etl::gemm_impl::VEC, *a * transpose(*b)); };
+            } else {
+                c.run = [a, b, r]() { *r = selected_helper(etl::gemm_impl::VEC, *a * *b); };
+            }
+        }
+
+        candidates.push_back(std::move(c));
+    }
+
+    return candidates;
+}
+
+template <bool Gevm, typename M>
+std::vector<candidate> gemv_candidates(const std::vector<size_t>& sizes) {
+    std::vector<candidate> candidates;
+
+    for (auto n : sizes) {
+        candidate c;
+        c.size  = n;
+        c.value = n * n + 1;
+
+        auto a = std::make_shared<M>(n, n);
+        auto x = std::make_shared<etl::dyn_vector<float>>(n);
+        auto r = std::make_shared<etl::dyn_vector<float>>(n);
+
+        *a = etl::normal_generator<float>();
+        *x = etl::normal_generator<float>();
+
+        if (Gevm) {
+            c.run = [a, x, r]() { *r = selected_helper(etl::gemm_impl::VEC, *x * *a); };
+        } else {
+            c.run = [a, x, r]() { *r = selected_helper(etl::gemm_impl::VEC, *a * *x); };
+        }
+
+        candidates.push_back(std::move(c));
+    }
+
+    return candidates;
+}
+
+template <typename Functor>
+std::vector<candidate> vector_candidates(const std::vector<size_t>& sizes, Functor functor) {
+    std::vector<candidate> candidates;
+
+    for (auto n : sizes) {
+        candidate c;
+        c.size  = n;
+        c.value = n + 1;
+
+        auto a = std::make_shared<etl::dyn_vector<float>>(n);
+        auto b = std::make_shared<etl::dyn_vector<float>>(n);
+        auto r = std::make_shared<etl::dyn_vector<float>>(n);
+
+        *a = etl::normal_generator<float>();
+        *b = etl::normal_generator<float>();
+
+        c.run = [a, b, r, functor]() { functor(*a, *b, *r); };
+
+        candidates.push_back(std::move(c));
+    }
+
+    return candidates;
+}
+
+/*!
+ * \brief Returns the runs of the 4D valid convolution with VEC and
+ * BLAS_VEC on a batch of images of the given size and kernels of the
+ * given size
+ */
+std::pair<std::function<void()>, std::function<void()>> conv4_runs(size_t i, size_t k) {
+    auto input  = std::make_shared<etl::dyn_matrix<float, 4>>(16, 8, i, i);
+    auto kernel = std::make_shared<etl::dyn_matrix<float, 4>>(16, 8, k, k);
+    auto output = std::make_shared<etl::dyn_matrix<float, 4>>(16, 16, i - k + 1, i - k + 1);
+
+    *input  = etl::normal_generator<float>();
+    *kernel = etl::normal_generator<float>();
+
+    return {[=]() { *output = selected_helper(etl::conv4_impl::VEC, etl::conv_4d_valid(*input, *kernel)); },
+            [=]() { *output = selected_helper(etl::conv4_impl::BLAS_VEC, etl::conv_4d_valid(*input, *kernel)); }};
+}
+
+/*!
+ * \brief Tune the selection between VEC and BLAS_VEC for the 4D valid
+ * convolution: BLAS_VEC is used for small kernels, unless the images are
+ * large.
+ */
+void tune_conv4(etl::tuning_profile& profile, bool quick) {
+    const size_t initial_kernel = profile.conv4_small_kernel_threshold;
+    const size_t initial_image  = profile.conv4_vec_image_threshold;
+
+    // The largest kernel for which BLAS_VEC is faster on medium images
+    size_t kernel = 0;
+
+    for (size_t k : {3UL, 5UL, 7UL, 9UL}) {
+        auto [vec, blas] = conv4_runs(32, k);
+
+        const double vec_time  = measure(vec);
+        const double blas_time = measure(blas);
+
+        printf("   %-28s %10zu: blas %13.0fns vec %14.0fns\n", "conv4_small_kernel_threshold", k, blas_time, vec_time);
+
+        if (vec_time < blas_time) {
+            break;
+        }
+
+        kernel = k;
+    }
+
+    profile.conv4_small_kernel_threshold = kernel;
+
+    // The largest image for which BLAS_VEC is faster with small kernels
+    size_t image = initial_image;
+
+    if (kernel) {
+        std::vector<size_t> images = quick ? std::vector<size_t>{16, 32, 64, 128} : std::vector<size_t>{16, 24, 32, 48, 64, 96, 128, 160, 192};
+
+        image = images.back();
+
+        for (size_t i : images) {
+            auto [vec, blas] = conv4_runs(i, 3);
+
+            const double vec_time  = measure(vec);
+            const double blas_time = measure(blas);
+
+            printf("   %-28s %10zu: blas %13.0fns vec %14.0fns\n", "conv4_vec_image_threshold", i, blas_time, vec_time);
+
+            if (vec_time < blas_time) {
+                image = i - 1;
+                break;
+            }
+        }
+    }
+
+    profile.conv4_vec_image_threshold = image;
+
+    printf(" %-30s %zu (default %zu)\n", "conv4_small_kernel_threshold", profile.conv4_small_kernel_threshold, initial_kernel);
+    printf(" %-30s %zu (default %zu)\n", "conv4_vec_image_threshold", profile.conv4_vec_image_threshold, initial_image);
+}
+
+} //end of anonymous namespace
+
+int main(int argc, char* argv[]) {
+    bool quick = false;
+
+    std::string path = "etl_tuning.conf";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+
+        if (arg == "--quick") {
+            quick = true;
+        } else {
+            path = arg;
+        }
+    }
+
+    if (quick) {
+        min_time = 0.02;
+    }
+
+    auto& profile = etl::tuning();
+
+    // Matrix-Matrix multiplication
+
+    std::vector<size_t> gemm_sizes = quick ? std::vector<size_t>{8, 16, 32, 64, 128} : std::vector<size_t>{4, 8, 12, 16, 24, 32, 48, 64, 96, 128, 192, 256};
+
+    crossover("gemm_rr_small_threshold", profile.gemm_rr_small_threshold, gemm_candidates(gemm_sizes, false, false));
+    crossover("gemm_nt_rr_small_threshold", profile.gemm_nt_rr_small_threshold, gemm_candidates(gemm_sizes, true, false));
+    crossover("gemm_cc_small_threshold", profile.gemm_cc_small_threshold, gemm_candidates(gemm_sizes, false, true));
+
+    // Matrix-Vector and Vector-Matrix multiplication
+
+    std::vector<size_t> gemv_sizes = quick ? std::vector<size_t>{32, 64, 128, 256, 512} : std::vector<size_t>{16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024};
+
+    crossover("gemv_rm_small_threshold", profile.gemv_rm_small_threshold, gemv_candidates<false, etl::dyn_matrix<float>>(gemv_sizes));
+    crossover("gemv_cm_small_threshold", profile.gemv_cm_small_threshold, gemv_candidates<false, etl::dyn_matrix_cm<float>>(gemv_sizes));
+    crossover("gevm_rm_small_threshold", profile.gevm_rm_small_threshold, gemv_candidates<true, etl::dyn_matrix<float>>(gemv_sizes));
+    crossover("gevm_cm_small_threshold", profile.gevm_cm_small_threshold, gemv_candidates<true, etl::dyn_matrix_cm<float>>(gemv_sizes));
+
+    // Parallel thresholds, only meaningful with several threads
+
+    if (etl::is_parallel && etl::threads > 1) {
+        std::vector<size_t> sizes;
+
+        for (size_t n = 1024; n <= (quick ? 1UL << 20 : 1UL << 22); n *= 2) {
+            sizes.push_back(n);
+        }
+
+        crossover("parallel_threshold", profile.parallel_threshold, vector_candidates(sizes, [](auto& a, auto& b, auto& r) { r = 2.0f * a + b; }));
+
+        // Only measure the parallel dispatch of the sum
+        const size_t vec_sum = profile.vec_sum_parallel_threshold;
+        const size_t sum     = profile.sum_parallel_threshold;
+        profile.sum_parallel_threshold = 0;
+
+        crossover("vec_sum_parallel_threshold", profile.vec_sum_parallel_threshold, vector_candidates(sizes, [](auto& a, auto&, auto& r) {
+            SELECTED_SECTION(etl::sum_impl::VEC) {
+                r[0] = etl::sum(a);
+            }
+        }));
+
+        const size_t tuned_vec_sum = profile.vec_sum_parallel_threshold;
+        profile.vec_sum_parallel_threshold = vec_sum;
+        profile.sum_parallel_threshold     = sum;
+
+        crossover("sum_parallel_threshold", profile.sum_parallel_threshold, vector_candidates(sizes, [](auto& a, auto&, auto& r) {
+            SELECTED_SECTION(etl::sum_impl::STD) {
+                r[0] = etl::sum(a);
+            }
+        }));
+
+        profile.vec_sum_parallel_threshold = tuned_vec_sum;
+    } else {
+        printf(" Parallel thresholds not tuned (ETL_PARALLEL not set or single thread)\n");
+    }
+
+    // 4D convolution
+
+    if (etl::vec_enabled) {
+        tune_conv4(profile, quick);
+    }
+
+    if (!profile.save(path)) {
+        std::cerr << "Unable to write " << path << std::endl;
+        return 1;
+    }
+
+    printf("\nTuning profile written to %s (use ETL_TUNING_PROFILE=%s)\n", path.c_str(), path.c_str());
+
+    return 0;
+}
@@ -0,0 +1,205 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Roofline benchmarks of the main kernels.
+ *
+ * Usage: roofline [--quick] [--json=file] [--compare=file] [--tolerance=t] [filter]
+ */
+
+#include "roofline.hpp"
+
+namespace {
+
+using svec = etl::dyn_vector<float>;
+using dvec = etl::dyn_vector<double>;
+using smat = etl::dyn_matrix<float>;
+using dmat = etl::dyn_matrix<double>;
+using smat4 = etl::dyn_matrix<float, 4>;
+using cvec = etl::dyn_vector<std::complex<float>>;
+
+std::string dims(size_t d1) {
+    return std::to_string(d1);
+}
+
+std::string dims(size_t d1, size_t d2) {
+    return std::to_string(d1) + "x" + std::to_string(d2);
+}
+
+void bench_vector(roofline::suite& suite, const std::vector<size_t>& sizes) {
+    for (auto n : sizes) {
+        dvec a(n);
+        dvec b(n);
+        dvec r(n);
+
+        a = etl::normal_generator<double>();
+        b = etl::normal_generator<double>();
+
+        suite.bench<double>("copy (d)", dims(n), 0.0, 2.0 * 8 * n, [&]() { r = a; });
+        suite.bench<double>("axpy (d)", dims(n), 2.0 * n, 3.0 * 8 * n, [&]() { r = 2.5 * a + b; });
+        suite.bench<double>("dot (d)", dims(n), 2.0 * n, 2.0 * 8 * n, [&]() { r[0] = etl::dot(a, b); });
+        suite.bench<double>("sum (d)", dims(n), 1.0 * n, 1.0 * 8 * n, [&]() { r[0] = etl::sum(a); });
+    }
+}
+
+void bench_gemm(roofline::suite& suite, const std::vector<size_t>& sizes) {
+    for (auto n : sizes) {
+        smat a(n, n);
+        smat b(n, n);
+        smat c(n, n);
+
+        a = etl::normal_generator<float>();
+        b = etl::normal_generator<float>();
+
+        suite.bench<float>("gemm (s)", dims(n, n), 2.0 * n * n * n, 3.0 * 4 * n * n, [&]() { c = a * b; });
+        suite.bench<float>("gemm_tn (s)", dims(n, n), 2.0 * n * n * n, 3.0 * 4 * n * n, [&]() { c = transpose(a) * b; });
+
+        dmat da(n, n);
+        dmat db(n, n);
+        dmat dc(n, n);
+
+        da = etl::normal_generator<double>();
+        db = etl::normal_generator<double>();
+
+        suite.bench<double>("gemm (d)", dims(n, n), 2.0 * n * n * n, 3.0 * 8 * n * n, [&]() { dc = da * db; });
+    }
+}
+
+void bench_conv(roofline::suite& suite, const std::vector<size_t>& sizes) {
+    for (auto n : sizes) {
+        const size_t k = 5;
+
+        smat a(n, n);
+        smat b(k, k);
+        smat c(n - k + 1, n - k + 1);
+
+        a = etl::normal_generator<float>();
+        b = etl::normal_generator<float>();
+
+        const double out = double(n - k + 1) * (n - k + 1);
+
+        suite.bench<float>("conv_2d_valid (s)", dims(n, k), 2.0 * out * k * k, 4.0 * (n * n + k * k + out), [&]() { c = etl::conv_2d_valid(a, b); });
+    }
+
+    // Convolutional layers (batch of 16 images)
+    for (auto n : sizes) {
+        const size_t batch = 16;
+        const size_t ci    = 8;
+        const size_t co    = 16;
+        const size_t k     = 3;
+        const size_t w     = n / 8;
+
+        smat4 input(batch, ci, w, w);
+        smat4 kernel(co, ci, k, k);
+        smat4 output(batch, co, w - k + 1, w - k + 1);
+
+        input  = etl::normal_generator<float>();
+        kernel = etl::normal_generator<float>();
+
+        const double flops = 2.0 * etl::size(output) * ci * k * k;
+        const double bytes = 4.0 * (etl::size(input) + etl::size(kernel) + etl::size(output));
+
+        suite.bench<float>("conv_4d_valid (s)", dims(w, k), flops, bytes, [&]() { output = etl::conv_4d_valid(input, kernel); });
+    }
+}
+
+void bench_pool(roofline::suite& suite, const std::vector<size_t>& sizes) {
+    for (auto n : sizes) {
+        smat4 input(16, 8, n / 4, n / 4);
+        smat4 output(16, 8, n / 8, n / 8);
+
+        input = etl::normal_generator<float>();
+
+        // One comparison per input element
+        const double flops = etl::size(input);
+        const double bytes = 4.0 * (etl::size(input) + etl::size(output));
+
+        suite.bench<float>("max_pool_2d (s)", dims(n / 4, 2), flops, bytes, [&]() { output = etl::max_pool_2d<2, 2>(input); });
+    }
+}
+
+void bench_fft(roofline::suite& suite, const std::vector<size_t>& sizes) {
+    for (auto n : sizes) {
+        cvec a(n);
+        cvec b(n);
+
+        a = etl::normal_generator<float>();
+
+        // Conventional count of 5 n log2(n) for the complex FFT
+        const double flops = 5.0 * n * std::log2(double(n));
+        const double bytes = 2.0 * 8 * n;
+
+        suite.bench<std::complex<float>>("fft_1d (c)", dims(n), flops, bytes, [&]() { b = etl::fft_1d(a); });
+    }
+}
+
+} //end of anonymous namespace
+
+int main(int argc, char* argv[]) {
+    roofline::suite suite;
+
+    bool quick = false;
+
+    std::string json;
+    std::string reference;
+    double tolerance = 0.1;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+
+        if (arg == "--quick") {
+            quick = true;
+        } else if (arg.rfind("--json=", 0) == 0) {
+            json = arg.substr(7);
+        } else if (arg.rfind("--compare=", 0) == 0) {
+            reference = arg.substr(10);
+        } else if (arg.rfind("--tolerance=", 0) == 0) {
+            tolerance = std::stod(arg.substr(12));
+        } else {
+            suite.filter = arg;
+        }
+    }
+
+    if (quick) {
+        suite.min_time = 0.05;
+    }
+
+    suite.init();
+
+    if (quick) {
+        bench_vector(suite, {1024, 1024 * 1024});
+        bench_gemm(suite, {64, 256});
+        bench_conv(suite, {128, 256});
+        bench_pool(suite, {128});
+        bench_fft(suite, {1024, 65536});
+    } else {
+        bench_vector(suite, {1024, 16 * 1024, 256 * 1024, 4 * 1024 * 1024});
+        bench_gemm(suite, {64, 128, 256, 512, 1024});
+        bench_conv(suite, {128, 256, 512});
+        bench_pool(suite, {128, 256, 512});
+        bench_fft(suite, {1024, 16384, 262144});
+    }
+
+    if (!json.empty() && !suite.write_json(json)) {
+        std::cerr << "Unable to write " << json << std::endl;
+        return 1;
+    }
+
+    if (!reference.empty()) {
+        int regressions = suite.compare(reference, tolerance);
+
+        if (regressions < 0) {
+            std::cerr << "Unable to read " << reference << std::endl;
+            return 1;
+        }
+
+        return regressions ? 2 : 0;
+    }
+
+    return 0;
+}
@@ -558,6 +558,20 @@ struct avx512_vec {
         return lhs;
     }
 
+    /*!
+     * \brief Compute (a * b) + c
+     */
+    ETL_INLINE_VEC_512 fmadd(__m512 a, __m512 b, __m512 c) {
+        return _mm512_fmadd_ps(a, b, c);
+    }
+
+    /*!
+     * \brief Compute (a * b) + c
+     */
+    ETL_INLINE_VEC_512D fmadd(__m512d a, __m512d b, __m512d c) {
+        return _mm512_fmadd_pd(a, b, c);
+    }
+
 #ifdef __INTEL_COMPILER
 
     //Exponential
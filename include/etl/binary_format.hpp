@@ -0,0 +1,522 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Versioned binary format for dense containers.
+ *
+ * The file starts with a header describing the content:
+ *   * the magic "ETLB"
+ *   * a byte-order mark (uint32 0x01020304, in the order of the writer)
+ *   * the version of the format (uint16)
+ *   * the type of the values (uint8) and the size of a value (uint8)
+ *   * the storage order (uint8) and the flags (uint8)
+ *   * the number of dimensions (uint16) and the alignment (uint32)
+ *   * each dimension (uint64)
+ *   * zero padding up to the alignment
+ *
+ * The header is followed by the contiguous memory of the container,
+ * written with a single call, and, if enabled, by a 64-bit checksum of
+ * this memory. Since the values start at an aligned offset, a mapped
+ * file can be used directly as the memory of a container. Files written
+ * on a machine with another byte order are converted when they are
+ * loaded.
+ */
+
+#pragma once
+
+#include <cstring> //For std::memcpy
+
+namespace etl {
+
+/*!
+ * \brief The version of the binary format written by save_binary
+ */
+constexpr uint16_t binary_format_version = 1;
+
+/*!
+ * \brief The alignment of the values in the files written by save_binary
+ */
+constexpr size_t binary_format_alignment = 64;
+
+/*!
+ * \brief The result of loading a container from the binary format
+ */
+enum class binary_status {
+    OK,             ///< The container has been loaded
+    IO_ERROR,       ///< The stream could not be read or written
+    BAD_MAGIC,      ///< The stream does not contain the binary format
+    BAD_VERSION,    ///< The version of the format is not supported
+    BAD_TYPE,       ///< The type of the values does not match the container
+    BAD_ORDER,      ///< The storage order does not match the container
+    BAD_DIMENSIONS, ///< The dimensions do not match the container
+    BAD_CHECKSUM    ///< The checksum of the values is not valid
+};
+
+/*!
+ * \brief The type of the values in the binary format
+ */
+enum class binary_type : uint8_t {
+    UNKNOWN = 0, ///< Any other type
+    FLOAT,       ///< Single-precision floating point
+    DOUBLE,      ///< Double-precision floating point
+    INT8,        ///< Signed 8-bit integer
+    UINT8,       ///< Unsigned 8-bit integer
+    INT16,       ///< Signed 16-bit integer
+    UINT16,      ///< Unsigned 16-bit integer
+    INT32,       ///< Signed 32-bit integer
+    UINT32,      ///< Unsigned 32-bit integer
+    INT64,       ///< Signed 64-bit integer
+    UINT64,      ///< Unsigned 64-bit integer
+    CFLOAT,      ///< Single-precision complex
+    CDOUBLE,     ///< Double-precision complex
+    BOOL         ///< Boolean
+};
+
+namespace binary_detail {
+
+constexpr char magic[4]          = {'E', 'T', 'L', 'B'}; ///< The magic of the format
+constexpr uint32_t byte_order    = 0x01020304;           ///< The byte-order mark
+constexpr uint32_t swapped_order = 0x04030201;           ///< The byte-order mark written by a machine of the other byte order
+constexpr uint8_t checksum_flag  = 1;                    ///< The flag indicating that a checksum follows the values
+
+/*!
+ * \brief Returns the size of the header (without padding) for the given number of dimensions
+ */
+constexpr size_t header_size(size_t dimensions) {
+    return 20 + 8 * dimensions;
+}
+
+/*!
+ * \brief Returns the size of the padding after a header of the given size
+ */
+constexpr size_t padding_size(size_t header, size_t alignment) {
+    return alignment > 1 ? (alignment - header % alignment) % alignment : 0;
+}
+
+/*!
+ * \brief Returns the binary type of T
+ */
+template <typename T>
+constexpr binary_type type_of() {
+    if constexpr (std::is_same_v<T, bool>) {
+        return binary_type::BOOL;
+    } else if constexpr (std::is_same_v<T, float>) {
+        return binary_type::FLOAT;
+    } else if constexpr (std::is_same_v<T, double>) {
+        return binary_type::DOUBLE;
+    } else if constexpr (is_complex_single_t<T>) {
+        return binary_type::CFLOAT;
+    } else if constexpr (is_complex_double_t<T>) {
+        return binary_type::CDOUBLE;
+    } else if constexpr (std::is_integral_v<T>) {
+        constexpr bool s = std::is_signed_v<T>;
+
+        switch (sizeof(T)) {
+            case 1:
+                return s ? binary_type::INT8 : binary_type::UINT8;
+            case 2:
+                return s ? binary_type::INT16 : binary_type::UINT16;
+            case 4:
+                return s ? binary_type::INT32 : binary_type::UINT32;
+            case 8:
+                return s ? binary_type::INT64 : binary_type::UINT64;
+            default:
+                return binary_type::UNKNOWN;
+        }
+    } else {
+        return binary_type::UNKNOWN;
+    }
+}
+
+/*!
+ * \brief Returns the size of the scalars that must be swapped to
+ * change the byte order of values of type T
+ */
+template <typename T>
+constexpr size_t scalar_size() {
+    if constexpr (is_complex_single_t<T> || is_complex_double_t<T>) {
+        return sizeof(T) / 2;
+    } else {
+        return sizeof(T);
+    }
+}
+
+/*!
+ * \brief Reverse the bytes of each scalar of the given buffer
+ * \param data The buffer
+ * \param n The number of scalars
+ * \param width The size of each scalar
+ */
+inline void swap_bytes(char* data, size_t n, size_t width) {
+    if (width > 1) {
+        for (size_t i = 0; i < n; ++i) {
+            std::reverse(data + i * width, data + (i + 1) * width);
+        }
+    }
+}
+
+/*!
+ * \brief Compute the Fletcher-64 checksum of the given buffer.
+ *
+ * The buffer is read by 32-bit words, in the byte order of the writer:
+ * if swap is true, each word is byte-swapped before being accumulated
+ * so that the checksum does not depend on the byte order of the reader.
+ *
+ * \param data The buffer
+ * \param n The size of the buffer, in bytes
+ * \param swap Indicates if the words must be byte-swapped
+ * \return the checksum of the buffer
+ */
+inline uint64_t checksum(const char* data, size_t n, bool swap) {
+    constexpr uint64_t mod = 0xFFFFFFFFULL;
+
+    // Words accumulated before the sums are reduced, small enough for b
+    // to never overflow
+    constexpr size_t block = 1024;
+
+    uint64_t a = 0;
+    uint64_t b = 0;
+
+    auto word = [&](size_t first, size_t count) {
+        uint32_t w = 0;
+        std::memcpy(&w, data + first, count);
+
+        if (swap) {
+            w = (w >> 24) | ((w >> 8) & 0xFF00U) | ((w << 8) & 0xFF0000U) | (w << 24);
+        }
+
+        return uint64_t(w);
+    };
+
+    const size_t words = n / 4;
+
+    for (size_t first = 0; first < words; first += block) {
+        const size_t last = std::min(words, first + block);
+
+        for (size_t i = first; i < last; ++i) {
+            a += word(4 * i, 4);
+            b += a;
+        }
+
+        a %= mod;
+        b %= mod;
+    }
+
+    if (n % 4) {
+        a = (a + word(4 * words, n % 4)) % mod;
+        b = (b + a) % mod;
+    }
+
+    return (b << 32) | a;
+}
+
+/*!
+ * \brief Write a value to the stream, in the native byte order
+ */
+template <typename Stream, typename T>
+void write_value(Stream& stream, T value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/*!
+ * \brief Read a value from the stream, converting its byte order if
+ * necessary
+ */
+template <typename Stream, typename T>
+void read_value(Stream& stream, T& value, bool swap) {
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+
+    if (swap) {
+        swap_bytes(reinterpret_cast<char*>(&value), 1, sizeof(T));
+    }
+}
+
+/*!
+ * \brief The information read from the header of a binary file
+ */
+template <size_t D>
+struct header {
+    bool swap     = false;            ///< Indicates if the file was written with the other byte order
+    uint8_t flags = 0;                ///< The flags of the file
+    std::array<size_t, D> dimensions; ///< The dimensions of the values
+};
+
+/*!
+ * \brief Read-only stream over a memory buffer, with the subset of the
+ * std::istream interface used to read a header.
+ */
+struct memory_stream {
+    const char* data; ///< The buffer
+    size_t size;      ///< The size of the buffer
+    size_t position;  ///< The current position in the buffer
+    bool good;        ///< Indicates if all the reads were in bounds
+
+    /*!
+     * \brief Construct a stream over the given buffer
+     */
+    memory_stream(const char* buffer, size_t n) : data(buffer), size(n), position(0), good(true) {}
+
+    /*!
+     * \brief Read n bytes into out
+     */
+    void read(char* out, size_t n) {
+        if (good && n <= size - position) {
+            std::memcpy(out, data + position, n);
+            position += n;
+        } else {
+            good = false;
+        }
+    }
+
+    /*!
+     * \brief Skip n bytes
+     */
+    void ignore(size_t n) {
+        if (good && n <= size - position) {
+            position += n;
+        } else {
+            good = false;
+        }
+    }
+
+    /*!
+     * \brief Indicates if all the reads were in bounds
+     */
+    explicit operator bool() const {
+        return good;
+    }
+};
+
+/*!
+ * \brief Write the header of a binary file for values of type T with
+ * the given storage order and dimensions.
+ *
+ * The header is padded so that the values written after it are aligned
+ * on binary_format_alignment.
+ *
+ * \param stream The output stream
+ * \param dimensions The dimensions of the values
+ * \param flags The flags of the file
+ */
+template <typename T, order SO, typename Stream, size_t D>
+void write_header(Stream& stream, const std::array<size_t, D>& dimensions, uint8_t flags) {
+    stream.write(magic, sizeof(magic));
+    write_value(stream, byte_order);
+    write_value(stream, binary_format_version);
+    write_value(stream, uint8_t(type_of<T>()));
+    write_value(stream, uint8_t(sizeof(T)));
+    write_value(stream, uint8_t(SO == order::RowMajor ? 0 : 1));
+    write_value(stream, flags);
+    write_value(stream, uint16_t(D));
+    write_value(stream, uint32_t(binary_format_alignment));
+
+    for (auto d : dimensions) {
+        write_value(stream, uint64_t(d));
+    }
+
+    const char padding[binary_format_alignment] = {};
+    stream.write(padding, padding_size(header_size(D), binary_format_alignment));
+}
+
+/*!
+ * \brief Read and validate the header of a binary file for values of
+ * type T with the given storage order and number of dimensions.
+ *
+ * On success, the stream is positioned on the first value.
+ *
+ * \param stream The input stream
+ * \param header The header to fill
+ * \return binary_status::OK if the header is valid for the container, the reason of the failure otherwise
+ */
+template <typename T, order SO, typename Stream, size_t D>
+binary_status read_header(Stream& stream, header<D>& header) {
+    char file_magic[4];
+    stream.read(file_magic, sizeof(file_magic));
+
+    if (!stream) {
+        return binary_status::IO_ERROR;
+    }
+
+    if (!std::equal(file_magic, file_magic + 4, magic)) {
+        return binary_status::BAD_MAGIC;
+    }
+
+    uint32_t bom = 0;
+    read_value(stream, bom, false);
+
+    if (bom != byte_order && bom != swapped_order) {
+        return binary_status::BAD_MAGIC;
+    }
+
+    header.swap = bom == swapped_order;
+
+    uint16_t version   = 0;
+    uint8_t type       = 0;
+    uint8_t value_size = 0;
+    uint8_t storage    = 0;
+    uint16_t dims      = 0;
+    uint32_t alignment = 0;
+
+    read_value(stream, version, header.swap);
+    read_value(stream, type, header.swap);
+    read_value(stream, value_size, header.swap);
+    read_value(stream, storage, header.swap);
+    read_value(stream, header.flags, header.swap);
+    read_value(stream, dims, header.swap);
+    read_value(stream, alignment, header.swap);
+
+    if (!stream) {
+        return binary_status::IO_ERROR;
+    }
+
+    if (version == 0 || version > binary_format_version) {
+        return binary_status::BAD_VERSION;
+    }
+
+    if (type != uint8_t(type_of<T>()) || value_size != sizeof(T)) {
+        return binary_status::BAD_TYPE;
+    }
+
+    if (storage != (SO == order::RowMajor ? 0 : 1)) {
+        return binary_status::BAD_ORDER;
+    }
+
+    if (dims != D) {
+        return binary_status::BAD_DIMENSIONS;
+    }
+
+    for (auto& d : header.dimensions) {
+        uint64_t value = 0;
+        read_value(stream, value, header.swap);
+        d = value;
+    }
+
+    // Skip the padding before the values
+    stream.ignore(padding_size(header_size(dims), alignment));
+
+    if (!stream) {
+        return binary_status::IO_ERROR;
+    }
+
+    return binary_status::OK;
+}
+
+} //end of namespace binary_detail
+
+/*!
+ * \brief Save a dense container to the given stream in the versioned
+ * binary format.
+ *
+ * The memory of the container is written with a single call to the
+ * stream, there is no per-element overhead.
+ *
+ * \param stream The output stream (std::ostream-like)
+ * \param matrix The container to save
+ * \param checksum Indicates if a checksum of the values must be written
+ * \return binary_status::OK if the container was saved, binary_status::IO_ERROR otherwise
+ */
+template <typename Stream, typename E>
+binary_status save_binary(Stream& stream, const E& matrix, bool checksum = false) {
+    static_assert(is_dma<E>, "save_binary is only supported for containers with direct memory access");
+    static_assert(std::is_trivially_copyable_v<value_t<E>>, "save_binary is only supported for trivially copyable values");
+
+    using T = value_t<E>;
+
+    matrix.ensure_cpu_up_to_date();
+
+    const char* values = reinterpret_cast<const char*>(matrix.memory_start());
+    const size_t bytes = etl::size(matrix) * sizeof(T);
+
+    std::array<size_t, decay_traits<E>::dimensions()> dimensions;
+
+    for (size_t d = 0; d < dimensions.size(); ++d) {
+        dimensions[d] = etl::dim(matrix, d);
+    }
+
+    binary_detail::write_header<T, decay_traits<E>::storage_order>(stream, dimensions, checksum ? binary_detail::checksum_flag : uint8_t(0));
+
+    stream.write(values, bytes);
+
+    if (checksum) {
+        binary_detail::write_value(stream, binary_detail::checksum(values, bytes, false));
+    }
+
+    return stream ? binary_status::OK : binary_status::IO_ERROR;
+}
+
+/*!
+ * \brief Load a dense container from the given stream, in the
+ * versioned binary format.
+ *
+ * A dyn_matrix is resized to the dimensions of the file, the other
+ * containers must have the same dimensions as the file. The values are
+ * read with a single call to the stream.
+ *
+ * \param stream The input stream (std::istream-like)
+ * \param matrix The container to load
+ * \return binary_status::OK if the container was loaded, the reason of the failure otherwise
+ */
+template <typename Stream, typename E>
+binary_status load_binary(Stream& stream, E& matrix) {
+    static_assert(is_dma<E>, "load_binary is only supported for containers with direct memory access");
+    static_assert(std::is_trivially_copyable_v<value_t<E>>, "load_binary is only supported for trivially copyable values");
+
+    using T = value_t<E>;
+
+    binary_detail::header<decay_traits<E>::dimensions()> header;
+
+    auto status = binary_detail::read_header<T, decay_traits<E>::storage_order>(stream, header);
+
+    if (status != binary_status::OK) {
+        return status;
+    }
+
+    if constexpr (is_dyn_matrix<E>) {
+        matrix.resize_arr(header.dimensions);
+    } else {
+        for (size_t d = 0; d < header.dimensions.size(); ++d) {
+            if (header.dimensions[d] != etl::dim(matrix, d)) {
+                return binary_status::BAD_DIMENSIONS;
+            }
+        }
+    }
+
+    char* values       = reinterpret_cast<char*>(matrix.memory_start());
+    const size_t bytes = etl::size(matrix) * sizeof(T);
+
+    stream.read(values, bytes);
+
+    if (!stream) {
+        return binary_status::IO_ERROR;
+    }
+
+    if (header.flags & binary_detail::checksum_flag) {
+        uint64_t expected = 0;
+        binary_detail::read_value(stream, expected, header.swap);
+
+        if (!stream) {
+            return binary_status::IO_ERROR;
+        }
+
+        if (binary_detail::checksum(values, bytes, header.swap) != expected) {
+            return binary_status::BAD_CHECKSUM;
+        }
+    }
+
+    if (header.swap) {
+        constexpr size_t width = binary_detail::scalar_size<T>();
+        binary_detail::swap_bytes(values, bytes / width, width);
+    }
+
+    matrix.validate_cpu();
+    matrix.invalidate_gpu();
+
+    return binary_status::OK;
+}
+
+} //end of namespace etl
@@ -16,6 +16,7 @@
 #include "etl/impl/dot.hpp"
 #include "etl/impl/sum.hpp"
 #include "etl/impl/norm.hpp"
+#include "etl/impl/max_index.hpp"
 
 #include "etl/builder/binary_expression_builder.hpp"
 #include "etl/builder/wrapper_expression_builder.hpp"
@@ -692,6 +693,43 @@ value_t<E> amean(E&& values) {
     return asum(values) / etl::size(values);
 }
 
+/*!
+ * \brief Returns the mean and the variance of all the values contained
+ * in the given expression, computed in a single pass.
+ * \param values The expression to reduce
+ * \return A pair with the mean and the variance of the values of the expression
+ */
+template <typename E>
+std::pair<value_t<E>, value_t<E>> mean_variance(E&& values) {
+    static_assert(is_etl_expr<E>, "etl::mean_variance can only be used on ETL expressions");
+
+    //Reduction force evaluation
+    force(values);
+
+    auto moments = detail::moments_impl::apply(values);
+
+    // The moments of integral values are computed in floating point and
+    // truncated. The mean is the one of etl::mean (integer division) since
+    // the truncation of the floating point mean could differ by one.
+    if constexpr (std::is_integral_v<value_t<E>>) {
+        return {etl::mean(values), value_t<E>(moments.m2 / etl::size(values))};
+    } else {
+        return {value_t<E>(moments.mean), value_t<E>(moments.m2 / etl::size(values))};
+    }
+}
+
+/*!
+ * \brief Returns the variance of all the values contained in the given expression
+ * \param values The expression to reduce
+ * \return The variance of the values of the expression
+ */
+template <typename E>
+value_t<E> variance(E&& values) {
+    static_assert(is_etl_expr<E>, "etl::variance can only be used on ETL expressions");
+
+    return mean_variance(values).second;
+}
+
 /*!
  * \brief Returns the standard deviation of all the values contained in the given expression
  * \param values The expression to reduce
@@ -701,14 +739,13 @@ template <typename E>
 value_t<E> stddev(E&& values) {
     static_assert(is_etl_expr<E>, "etl::stddev can only be used on ETL expressions");
 
-    auto mean = etl::mean(values);
+    //Reduction force evaluation
+    force(values);
 
-    double std = 0.0;
-    for (auto value : values) {
-        std += (value - mean) * (value - mean);
-    }
+    auto moments = detail::moments_impl::apply(values);
 
-    return std::sqrt(std / etl::size(values));
+    // Integral values are only truncated after the square root
+    return value_t<E>(std::sqrt(moments.m2 / etl::size(values)));
 }
 
 /*!
@@ -758,15 +795,9 @@ size_t max_index(E&& values) {
     //Reduction force evaluation
     force(values);
 
-    size_t m = 0;
-
-    for (size_t i = 1; i < etl::size(values); ++i) {
-        if (values[i] > values[m]) {
-            m = i;
-        }
-    }
+    safe_ensure_cpu_up_to_date(values);
 
-    return m;
+    return detail::index_impl<true>::apply(values);
 }
 
 /*!
@@ -795,15 +826,9 @@ size_t min_index(E&& values) {
     //Reduction force evaluation
     force(values);
 
-    size_t m = 0;
+    safe_ensure_cpu_up_to_date(values);
 
-    for (size_t i = 1; i < etl::size(values); ++i) {
-        if (values[i] < values[m]) {
-            m = i;
-        }
-    }
-
-    return m;
+    return detail::index_impl<false>::apply(values);
 }
 
 /*!
@@ -820,6 +845,60 @@ detail::value_return_t<E> min(E&& values) {
     return values[m];
 }
 
+/*!
+ * \brief Returns the index of the maximum element of each row of the
+ * given matrix, computed in a single pass over the matrix.
+ *
+ * The rows are searched in parallel when the matrix is large enough.
+ *
+ * \param values The matrix to search
+ * \tparam I The type of the indices
+ * \return A vector with the index of the maximum element of each row
+ */
+template <typename E, typename I = size_t>
+etl::dyn_vector<I> batch_argmax(E&& values) {
+    static_assert(is_etl_expr<E>, "etl::batch_argmax can only be used on ETL expressions");
+    static_assert(is_2d<E>, "etl::batch_argmax is only defined for matrices");
+
+    //Reduction force evaluation
+    force(values);
+
+    safe_ensure_cpu_up_to_date(values);
+
+    etl::dyn_vector<I> indices(etl::dim<0>(values));
+
+    detail::index_impl<true>::apply_rows(values, indices);
+
+    return indices;
+}
+
+/*!
+ * \brief Returns the index of the minimum element of each row of the
+ * given matrix, computed in a single pass over the matrix.
+ *
+ * The rows are searched in parallel when the matrix is large enough.
+ *
+ * \param values The matrix to search
+ * \tparam I The type of the indices
+ * \return A vector with the index of the minimum element of each row
+ */
+template <typename E, typename I = size_t>
+etl::dyn_vector<I> batch_argmin(E&& values) {
+    static_assert(is_etl_expr<E>, "etl::batch_argmin can only be used on ETL expressions");
+    static_assert(is_2d<E>, "etl::batch_argmin is only defined for matrices");
+
+    //Reduction force evaluation
+    force(values);
+
+    safe_ensure_cpu_up_to_date(values);
+
+    etl::dyn_vector<I> indices(etl::dim<0>(values));
+
+    detail::index_impl<false>::apply_rows(values, indices);
+
+    return indices;
+}
+
 // Generate data
 
 /*!
@@ -16,6 +16,7 @@
 #pragma once
 
 #include "etl/impl/cce.hpp"
+#include "etl/impl/batch_norm.hpp"
 #include "etl/impl/bce.hpp"
 
 namespace etl::ml {
@@ -596,4 +597,85 @@ std::pair<value_t<O>, value_t<O>> cce(O&& output, L&& labels, value_t<O> alpha,
     return detail::cce_impl::apply(output, labels, alpha, beta);
 }
 
+/*!
+ * \brief Compute the softmax cross entropy loss of the logits and its
+ * gradient, in a single fused operation.
+ *
+ * The loss is the sum over the rows of -labels . log(softmax(logits)),
+ * computed in a numerically stable way, multiplied by scale. The
+ * gradient of the (unscaled) loss with respect to the logits,
+ * softmax(logits) - labels, is written in gradient. The softmax itself
+ * is never stored.
+ *
+ * \param logits The logits (2D row-major, one sample per row)
+ * \param labels The labels (2D row-major, same dimensions as the logits)
+ * \param gradient The output gradient (same dimensions as the logits)
+ * \param scale The scale of the loss
+ * \return The scaled softmax cross entropy loss
+ */
+template <typename O, typename L, typename G>
+value_t<O> softmax_cross_entropy(O&& logits, L&& labels, G&& gradient, value_t<O> scale = 1) {
+    static_assert(all_etl_expr<O, L, G>, "etl::softmax_cross_entropy can only be used on ETL expressions");
+    static_assert(decay_traits<O>::dimensions() == 2 && decay_traits<L>::dimensions() == 2, "etl::softmax_cross_entropy is only defined for 2D logits");
+    static_assert(all_row_major<O, L>, "etl::softmax_cross_entropy is only defined for row-major logits and labels");
+    static_assert(is_dma<G> && decay_traits<G>::storage_order == order::RowMajor, "etl::softmax_cross_entropy needs a row-major gradient container");
+
+    validate_assign(gradient, logits);
+    cpp_assert(etl::dim<0>(labels) == etl::dim<0>(logits) && etl::dim<1>(labels) == etl::dim<1>(logits), "Invalid dimensions for softmax_cross_entropy");
+
+    return detail::softmax_cross_entropy_impl::apply(logits, labels, gradient, scale);
+}
+
+/*!
+ * \brief Compute the batch normalization statistics of the input, in a
+ * single pass over the input.
+ *
+ * The mean and the (biased) variance of each channel are computed over
+ * the batch (2D input) or over the batch and the spatial dimensions (4D
+ * input), with Welford's algorithm.
+ *
+ * \param input The input (N x K or N x K x H x W)
+ * \param mean The output mean of each channel (K)
+ * \param var The output variance of each channel (K)
+ */
+template <typename I, typename M, typename V>
+void batch_norm_stats(I&& input, M&& mean, V&& var) {
+    static_assert(all_etl_expr<I, M, V>, "etl::batch_norm_stats can only be used on ETL expressions");
+    static_assert(decay_traits<I>::dimensions() == 2 || decay_traits<I>::dimensions() == 4, "etl::batch_norm_stats is only defined for 2D and 4D inputs");
+    static_assert(decay_traits<I>::storage_order == order::RowMajor, "etl::batch_norm_stats is only defined for row-major inputs");
+    static_assert(all_dma<M, V> && decay_traits<M>::dimensions() == 1 && decay_traits<V>::dimensions() == 1, "etl::batch_norm_stats needs vector containers for the statistics");
+
+    cpp_assert(etl::dim<0>(mean) == etl::dim<1>(input) && etl::dim<0>(var) == etl::dim<1>(input), "Invalid dimensions for batch_norm_stats");
+
+    detail::batch_norm_impl::stats(input, mean, var);
+}
+
+/*!
+ * \brief Normalize the input with the given statistics and apply the
+ * scale and the shift, in a single read-write pass over the input.
+ *
+ * output = gamma * (input - mean) / sqrt(var + epsilon) + beta
+ *
+ * \param input The input (N x K or N x K x H x W)
+ * \param mean The mean of each channel (K)
+ * \param var The variance of each channel (K)
+ * \param gamma The scale of each channel (K)
+ * \param beta The shift of each channel (K)
+ * \param output The output (same dimensions as the input, can be the input itself)
+ * \param epsilon The value added to the variance for stability
+ */
+template <typename I, typename M, typename V, typename G, typename B, typename O>
+void batch_norm_apply(I&& input, M&& mean, V&& var, G&& gamma, B&& beta, O&& output, value_t<I> epsilon = 1e-5) {
+    static_assert(all_etl_expr<I, M, V, G, B, O>, "etl::batch_norm_apply can only be used on ETL expressions");
+    static_assert(decay_traits<I>::dimensions() == 2 || decay_traits<I>::dimensions() == 4, "etl::batch_norm_apply is only defined for 2D and 4D inputs");
+    static_assert(decay_traits<I>::storage_order == order::RowMajor, "etl::batch_norm_apply is only defined for row-major inputs");
+    static_assert(is_dma<O> && decay_traits<O>::storage_order == order::RowMajor, "etl::batch_norm_apply needs a row-major output container");
+
+    validate_assign(output, input);
+    cpp_assert(etl::dim<0>(mean) == etl::dim<1>(input) && etl::dim<0>(var) == etl::dim<1>(input), "Invalid dimensions for batch_norm_apply");
+    cpp_assert(etl::dim<0>(gamma) == etl::dim<1>(input) && etl::dim<0>(beta) == etl::dim<1>(input), "Invalid dimensions for batch_norm_apply");
+
+    detail::batch_norm_impl::apply(input, mean, var, gamma, beta, output, epsilon);
+}
+
 } //end of namespace etl::ml
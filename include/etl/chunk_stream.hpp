@@ -0,0 +1,515 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Streaming of datasets larger than memory, by chunks of samples.
+ *
+ * The files use the binary format: the first dimension is the number of
+ * samples and the other dimensions are the dimensions of each sample.
+ * They can therefore also be loaded with load_binary or mapped with
+ * mapped_matrix.
+ */
+
+#pragma once
+
+#include <array>              //For the dimensions
+#include <fstream>            //For the files
+#include <string>             //For the path
+#include <thread>             //For the background reader
+#include <mutex>              //For the ring synchronization
+#include <condition_variable> //For the ring synchronization
+#include <deque>              //For the ring queues
+
+namespace etl {
+
+/*!
+ * \brief Writer of a dataset in the binary format, by chunks of samples.
+ *
+ * The number of samples does not need to be known in advance, it is
+ * written in the header when the writer is closed.
+ *
+ * \tparam T The value type
+ * \tparam D The number of dimensions of the dataset (including the samples)
+ */
+template <typename T, size_t D = 2>
+struct chunk_writer {
+    static_assert(D > 1, "chunk_writer needs at least two dimensions");
+    static_assert(std::is_trivially_copyable_v<T>, "chunk_writer is only supported for trivially copyable values");
+
+    /*!
+     * \brief Open the given file for writing
+     * \param path The path to the file
+     * \param sizes The dimensions of each sample
+     */
+    template <typename... S, cpp_enable_iff(sizeof...(S) == D - 1)>
+    explicit chunk_writer(const std::string& path, S... sizes) : _stream(path, std::ios::binary | std::ios::trunc), _dimensions{{0, static_cast<size_t>(sizes)...}} {
+        binary_detail::write_header<T, order::RowMajor>(_stream, _dimensions, 0);
+    }
+
+    chunk_writer(const chunk_writer& rhs) = delete;
+    chunk_writer& operator=(const chunk_writer& rhs) = delete;
+
+    /*!
+     * \brief Close the writer
+     */
+    ~chunk_writer() {
+        close();
+    }
+
+    /*!
+     * \brief Write samples to the file.
+     *
+     * The expression is either a single sample (D - 1 dimensions) or a
+     * batch of samples (D dimensions).
+     *
+     * \param samples The samples to write
+     * \return binary_status::OK if the samples were written, the reason of the failure otherwise
+     */
+    template <typename E>
+    binary_status write(const E& samples) {
+        static_assert(is_dma<E> && decay_traits<E>::storage_order == order::RowMajor, "chunk_writer::write needs row-major containers");
+        static_assert(std::is_same_v<value_t<E>, T>, "chunk_writer::write needs values of the same type");
+        static_assert(decay_traits<E>::dimensions() == D || decay_traits<E>::dimensions() == D - 1, "chunk_writer::write needs a sample or a batch");
+
+        constexpr size_t first = decay_traits<E>::dimensions() == D ? 1 : 0;
+
+        for (size_t d = first; d < decay_traits<E>::dimensions(); ++d) {
+            if (etl::dim(samples, d) != _dimensions[d + 1 - first]) {
+                return binary_status::BAD_DIMENSIONS;
+            }
+        }
+
+        samples.ensure_cpu_up_to_date();
+
+        _stream.write(reinterpret_cast<const char*>(samples.memory_start()), etl::size(samples) * sizeof(T));
+
+        if (!_stream) {
+            return binary_status::IO_ERROR;
+        }
+
+        _dimensions[0] += first ? etl::dim(samples, 0) : 1;
+
+        return binary_status::OK;
+    }
+
+    /*!
+     * \brief Returns the number of samples written so far
+     */
+    size_t samples() const noexcept {
+        return _dimensions[0];
+    }
+
+    /*!
+     * \brief Write the number of samples in the header and close the file.
+     *
+     * Closing an already closed writer does nothing.
+     *
+     * \return binary_status::OK if the file was completed, binary_status::IO_ERROR otherwise (including when the file could not be opened)
+     */
+    binary_status close() {
+        if (_closed) {
+            return binary_status::OK;
+        }
+
+        _closed = true;
+
+        if (!_stream.is_open()) {
+            return binary_status::IO_ERROR;
+        }
+
+        // The number of samples is the first dimension in the header
+        _stream.seekp(binary_detail::header_size(0));
+        binary_detail::write_value(_stream, uint64_t(_dimensions[0]));
+        _stream.close();
+
+        return _stream ? binary_status::OK : binary_status::IO_ERROR;
+    }
+
+private:
+    std::ofstream _stream;             ///< The output file
+    std::array<size_t, D> _dimensions; ///< The dimensions of the dataset
+    bool _closed = false;              ///< Indicates if the writer has been closed
+};
+
+/*!
+ * \brief Reader of a dataset in the binary format, by batches of
+ * samples.
+ *
+ * A background thread reads the next batches into a ring of buffers
+ * while the current batch is being used, so that reading the file
+ * overlaps with the computation. Only the buffers of the ring are ever
+ * in memory.
+ *
+ * Each batch is exposed as a custom_dyn_matrix view over a buffer of
+ * the ring, with the samples in the first dimension. The last batch may
+ * contain fewer samples. A view is valid until the next batch is
+ * requested.
+ *
+ * \code{.cpp}
+ * etl::chunk_reader<float> reader("features.etl", 256);
+ *
+ * for (auto& batch : reader) {
+ *     output = batch * weights;
+ * }
+ * \endcode
+ *
+ * \tparam T The value type
+ * \tparam D The number of dimensions of the dataset (including the samples)
+ */
+template <typename T, size_t D = 2>
+struct chunk_reader {
+    static_assert(D > 1, "chunk_reader needs at least two dimensions");
+    static_assert(std::is_trivially_copyable_v<T>, "chunk_reader is only supported for trivially copyable values");
+
+    using value_type = T;                                             ///< The value type
+    using batch_type = custom_dyn_matrix_impl<T, order::RowMajor, D>; ///< The type of the batch views
+
+    /*!
+     * \brief Input iterator over the batches of a reader
+     */
+    struct iterator {
+        using iterator_category = std::input_iterator_tag; ///< The iterator category
+        using value_type        = batch_type;              ///< The value type
+        using difference_type   = std::ptrdiff_t;          ///< The type of difference between two iterators
+        using pointer           = batch_type*;             ///< The pointer type
+        using reference         = batch_type&;             ///< The reference type
+
+        chunk_reader* reader = nullptr; ///< The reader, nullptr for the end
+
+        /*!
+         * \brief Returns the current batch
+         */
+        reference operator*() const {
+            return reader->batch();
+        }
+
+        /*!
+         * \brief Returns a pointer to the current batch
+         */
+        pointer operator->() const {
+            return &reader->batch();
+        }
+
+        /*!
+         * \brief Advance to the next batch
+         */
+        iterator& operator++() {
+            if (!reader->next()) {
+                reader = nullptr;
+            }
+
+            return *this;
+        }
+
+        /*!
+         * \brief Compare two iterators
+         */
+        bool operator==(const iterator& rhs) const {
+            return reader == rhs.reader;
+        }
+
+        /*!
+         * \brief Compare two iterators
+         */
+        bool operator!=(const iterator& rhs) const {
+            return reader != rhs.reader;
+        }
+    };
+
+    /*!
+     * \brief Open the given file and start reading the first batches.
+     *
+     * The status of the operation must be checked with status() before
+     * reading the batches.
+     *
+     * \param path The path to the file
+     * \param batch_size The maximum number of samples in each batch
+     * \param ring_size The number of buffers in the ring (at least 2 to overlap reading and computation)
+     */
+    chunk_reader(const std::string& path, size_t batch_size, size_t ring_size = 3) : _stream(path, std::ios::binary), _batch_size(batch_size) {
+        cpp_assert(batch_size > 0, "chunk_reader needs a positive batch size");
+        cpp_assert(ring_size > 0, "chunk_reader needs at least one buffer");
+
+        if (!_stream) {
+            _status = binary_status::IO_ERROR;
+            return;
+        }
+
+        binary_detail::header<D> header;
+
+        _status = binary_detail::read_header<T, order::RowMajor>(_stream, header);
+
+        if (_status != binary_status::OK) {
+            return;
+        }
+
+        _swap       = header.swap;
+        _dimensions = header.dimensions;
+        _start      = _stream.tellg();
+
+        _sample_size = 1;
+
+        for (size_t d = 1; d < D; ++d) {
+            _sample_size *= _dimensions[d];
+        }
+
+        _ring.reserve(ring_size);
+
+        for (size_t i = 0; i < ring_size; ++i) {
+            _ring.emplace_back(_batch_size * _sample_size);
+        }
+
+        start();
+    }
+
+    chunk_reader(const chunk_reader& rhs) = delete;
+    chunk_reader& operator=(const chunk_reader& rhs) = delete;
+
+    /*!
+     * \brief Stop the background thread and close the file
+     */
+    ~chunk_reader() {
+        stop();
+    }
+
+    /*!
+     * \brief Returns the status of the reader
+     * \return binary_status::OK if the file is valid and all the reads succeeded, the reason of the failure otherwise
+     */
+    binary_status status() const {
+        std::lock_guard<std::mutex> lock(_lock);
+        return _status;
+    }
+
+    /*!
+     * \brief Returns the number of samples in the file
+     */
+    size_t samples() const noexcept {
+        return _dimensions[0];
+    }
+
+    /*!
+     * \brief Returns the number of batches in the file
+     */
+    size_t batches() const noexcept {
+        return (_dimensions[0] + _batch_size - 1) / _batch_size;
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the dataset
+     */
+    size_t dim(size_t d) const noexcept {
+        return _dimensions[d];
+    }
+
+    /*!
+     * \brief Advance to the next batch.
+     *
+     * The buffer of the current batch is given back to the background
+     * thread. This waits until the next batch has been read.
+     *
+     * \return true if there is a next batch, false at the end of the file or if a read failed
+     */
+    bool next() {
+        std::unique_lock<std::mutex> lock(_lock);
+
+        if (_current != no_buffer) {
+            _free.push_back(_current);
+            _current = no_buffer;
+            _condition.notify_all();
+        }
+
+        _condition.wait(lock, [this] { return !_filled.empty() || _done; });
+
+        if (_filled.empty()) {
+            return false;
+        }
+
+        auto [index, samples] = _filled.front();
+        _filled.pop_front();
+
+        _current = index;
+
+        auto dimensions = _dimensions;
+        dimensions[0]   = samples;
+
+        _batch = make_batch(_ring[_current].memory_start(), dimensions);
+
+        return true;
+    }
+
+    /*!
+     * \brief Returns the current batch
+     */
+    batch_type& batch() noexcept {
+        return _batch;
+    }
+
+    /*!
+     * \brief Restart reading from the first sample
+     */
+    void rewind() {
+        // The background thread may still be updating the status
+        if (auto current = status(); current != binary_status::OK && current != binary_status::IO_ERROR) {
+            return;
+        }
+
+        stop();
+
+        _stream.clear();
+        _stream.seekg(_start);
+
+        const bool good = bool(_stream);
+
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            _status = good ? binary_status::OK : binary_status::IO_ERROR;
+        }
+
+        if (good) {
+            start();
+        }
+    }
+
+    /*!
+     * \brief Read the next batch and returns an iterator to it
+     */
+    iterator begin() {
+        return iterator{next() ? this : nullptr};
+    }
+
+    /*!
+     * \brief Returns the end iterator
+     */
+    iterator end() {
+        return iterator{};
+    }
+
+private:
+    static constexpr size_t no_buffer = std::numeric_limits<size_t>::max(); ///< Index indicating that no buffer is used
+
+    /*!
+     * \brief Returns a batch view over the given memory
+     * \param memory The memory of the batch
+     * \param dimensions The dimensions of the batch
+     */
+    static batch_type make_batch(T* memory, const std::array<size_t, D>& dimensions) {
+        return std::apply([memory](auto... dims) { return batch_type(memory, dims...); }, dimensions);
+    }
+
+    /*!
+     * \brief Start the background thread at the current position of the file
+     */
+    void start() {
+        _free.clear();
+        _filled.clear();
+
+        for (size_t i = 0; i < _ring.size(); ++i) {
+            _free.push_back(i);
+        }
+
+        _current = no_buffer;
+        _done    = false;
+        _stopped = false;
+        _batch   = make_batch(nullptr, {});
+
+        _thread = std::thread([this] { fill(); });
+    }
+
+    /*!
+     * \brief Stop the background thread
+     */
+    void stop() {
+        if (_thread.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                _stopped = true;
+            }
+
+            _condition.notify_all();
+            _thread.join();
+        }
+    }
+
+    /*!
+     * \brief Fill the free buffers of the ring with the next samples,
+     * until the end of the file
+     */
+    void fill() {
+        size_t remaining = _dimensions[0];
+
+        while (remaining) {
+            size_t index;
+
+            {
+                std::unique_lock<std::mutex> lock(_lock);
+                _condition.wait(lock, [this] { return !_free.empty() || _stopped; });
+
+                if (_stopped) {
+                    return;
+                }
+
+                index = _free.front();
+                _free.pop_front();
+            }
+
+            // The file is read outside of the lock, the consumer can use the other buffers
+            const size_t samples = std::min(remaining, _batch_size);
+            const size_t values  = samples * _sample_size;
+
+            char* buffer = reinterpret_cast<char*>(_ring[index].memory_start());
+
+            _stream.read(buffer, values * sizeof(T));
+
+            if (!_stream) {
+                std::lock_guard<std::mutex> lock(_lock);
+                _status = binary_status::IO_ERROR;
+                _done   = true;
+                _condition.notify_all();
+                return;
+            }
+
+            if (_swap) {
+                constexpr size_t width = binary_detail::scalar_size<T>();
+                binary_detail::swap_bytes(buffer, values * sizeof(T) / width, width);
+            }
+
+            remaining -= samples;
+
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                _filled.emplace_back(index, samples);
+                _condition.notify_all();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(_lock);
+        _done = true;
+        _condition.notify_all();
+    }
+
+    std::ifstream _stream;                         ///< The input file
+    std::streampos _start;                         ///< The position of the first value in the file
+    size_t _batch_size;                            ///< The maximum number of samples in a batch
+    size_t _sample_size   = 0;                     ///< The number of values in a sample
+    bool _swap            = false;                 ///< Indicates if the file has the other byte order
+    binary_status _status = binary_status::OK;     ///< The status of the reader
+    std::array<size_t, D> _dimensions = {};        ///< The dimensions of the dataset
+    std::vector<etl::dyn_vector<T>> _ring;         ///< The buffers of the ring
+    std::deque<size_t> _free;                      ///< The buffers available to the background thread
+    std::deque<std::pair<size_t, size_t>> _filled; ///< The buffers filled with samples (index, number of samples)
+    size_t _current   = no_buffer;                 ///< The buffer of the current batch
+    bool _done        = false;                     ///< Indicates that the background thread is done
+    bool _stopped     = false;                     ///< Indicates that the background thread must stop
+    batch_type _batch = make_batch(nullptr, {});   ///< The view of the current batch
+    std::thread _thread;                           ///< The background thread
+    mutable std::mutex _lock;                      ///< The lock protecting the ring
+    std::condition_variable _condition;            ///< The condition signaled when the ring changes
+};
+
+} //end of namespace etl
@@ -152,6 +152,24 @@ constexpr bool padding_impl = !ETL_NO_PADDING_IMPL_BOOL;
  */
 constexpr bool unroll_normal_loops = ETL_NO_UNROLL_NON_VECT_BOOL;
 
+/*!
+ * \brief Indicates if the blocks of the sum reductions are
+ * accumulated with compensated (Kahan) summation.
+ */
+constexpr bool compensated_sum = ETL_COMPENSATED_SUM_BOOL;
+
+/*!
+ * \brief Indicates if x * y + z expressions are evaluated with a fused
+ * multiply-add.
+ *
+ * The fused multiply-add rounds only once, the results can thus differ
+ * from the separate multiplication and addition in the last bit. The
+ * rewrite must be enabled with ETL_FMA_REWRITE and is only done when the
+ * target has FMA instructions, in order to get the same results in the
+ * scalar and vectorized evaluations.
+ */
+constexpr bool fma_rewrite = ETL_FMA_BOOL && ETL_FMA_REWRITE_BOOL;
+
 /*!
  * \brief Cache size of the machine.
  */
@@ -214,6 +232,11 @@ constexpr bool vec_enabled = avx512_enabled || avx_enabled || sse3_enabled;
  */
 constexpr bool intel_compiler = ETL_INTEL_COMPILER_BOOL;
 
+/*!
+ * \brief Indicates if files can be mapped in memory (POSIX mmap)
+ */
+constexpr bool mmap_enabled = ETL_MMAP_BOOL;
+
 /* Checks for parameters */
 
 static_assert(!is_parallel || parallel_support, "is_parallel can only work with parallel_support");
@@ -69,6 +69,13 @@ static_assert(false, "EGBLAS is only intended to work with CUBLAS, not alone");
 #endif
 #endif
 
+// ETL_FIND_SELECT is built on the manual selection of the implementations
+#ifdef ETL_FIND_SELECT
+#ifndef ETL_MANUAL_SELECT
+#define ETL_MANUAL_SELECT
+#endif
+#endif
+
 // Convert all the defines to booleans
 
 #ifdef ETL_MANUAL_SELECT
@@ -203,12 +210,30 @@ static_assert(false, "EGBLAS is only intended to work with CUBLAS, not alone");
 #define ETL_NO_UNROLL_NON_VECT_BOOL false
 #endif
 
+#ifdef ETL_COMPENSATED_SUM
+#define ETL_COMPENSATED_SUM_BOOL true
+#else
+#define ETL_COMPENSATED_SUM_BOOL false
+#endif
+
+#ifdef ETL_FMA_REWRITE
+#define ETL_FMA_REWRITE_BOOL true
+#else
+#define ETL_FMA_REWRITE_BOOL false
+#endif
+
 #ifdef __INTEL_COMPILER
 #define ETL_INTEL_COMPILER_BOOL true
 #else
 #define ETL_INTEL_COMPILER_BOOL false
 #endif
 
+#if defined(__unix__) || defined(__APPLE__)
+#define ETL_MMAP_BOOL true
+#else
+#define ETL_MMAP_BOOL false
+#endif
+
 // Vectorization detection
 
 #ifdef __AVX512F__
@@ -233,6 +258,12 @@ static_assert(false, "EGBLAS is only intended to work with CUBLAS, not alone");
 #define ETL_AVX2_BOOL false
 #endif
 
+#ifdef __FMA__
+#define ETL_FMA_BOOL true
+#else
+#define ETL_FMA_BOOL false
+#endif
+
 #ifdef __AVX__
 #define ETL_AVX_BOOL true
 #else
@@ -0,0 +1,195 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Streaming 1D convolution of long signals
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief A stateful streaming 1D convolver.
+ *
+ * The signal is given chunk by chunk and, for each chunk, the same
+ * number of samples of the full convolution of the signal with the
+ * kernel is produced. Concatenating the outputs of all the chunks and
+ * of the final flush gives the same result as conv_1d_full on the
+ * entire signal.
+ *
+ * The convolution is computed with the overlap-save method: the last
+ * kernel_size() - 1 input samples are kept between the chunks and each
+ * block is convolved by FFT with a cached spectrum of the kernel. The
+ * memory used is proportional to the block size and the kernel size,
+ * not to the length of the signal.
+ *
+ * \tparam T The value type of the signal
+ */
+template <typename T>
+struct conv_1d_stream {
+    static_assert(std::is_floating_point_v<T>, "conv_1d_stream is only supported for floating point");
+
+    using value_type   = T;               ///< The value type
+    using complex_type = etl::complex<T>; ///< The complex type of the spectrums
+
+    /*!
+     * \brief Construct a new streaming convolver
+     * \param kernel The kernel of the convolution
+     * \param block The maximum number of input samples processed by a single FFT
+     */
+    template <typename K>
+    conv_1d_stream(const K& kernel, size_t block) : k(etl::size(kernel)), l(block) {
+        static_assert(is_etl_expr<K>, "conv_1d_stream kernel must be an ETL expression");
+        static_assert(etl::dimensions<K>() == 1, "conv_1d_stream kernel must be 1D");
+
+        cpp_assert(k > 0, "conv_1d_stream kernel cannot be empty");
+        cpp_assert(l > 0, "conv_1d_stream block cannot be empty");
+
+        // Power of two transforms for the radix-2 FFT
+        n = 2;
+        while (n < l + k - 1) {
+            n *= 2;
+        }
+
+        buffer     = etl::allocate<T>(n);
+        result     = etl::allocate<T>(n);
+        spectrum   = etl::allocate<complex_type>(n / 2 + 1);
+        kernel_fft = etl::allocate<complex_type>(n / 2 + 1);
+
+        for (size_t i = 0; i < k; ++i) {
+            result[i] = kernel[i];
+        }
+
+        impl::standard::detail::rfft1_kernel(result.get(), n, kernel_fft.get());
+    }
+
+    /*!
+     * \brief Returns the size of the kernel
+     */
+    size_t kernel_size() const noexcept {
+        return k;
+    }
+
+    /*!
+     * \brief Returns the maximum number of input samples processed by a single FFT
+     */
+    size_t block_size() const noexcept {
+        return l;
+    }
+
+    /*!
+     * \brief Returns the size of the FFT used for each block
+     */
+    size_t fft_size() const noexcept {
+        return n;
+    }
+
+    /*!
+     * \brief Convolve the next chunk of the signal.
+     *
+     * The output must have the same size as the input chunk. The chunk
+     * can be of any size, it is processed by blocks of block_size()
+     * samples.
+     *
+     * \param input The next chunk of the signal
+     * \param output The output for the next samples of the convolution
+     */
+    template <typename I, typename O>
+    void push(const I& input, O&& output) {
+        static_assert(all_etl_expr<I, O>, "conv_1d_stream only supported for ETL expressions");
+        static_assert(etl::dimensions<I>() == 1 && etl::dimensions<O>() == 1, "conv_1d_stream only supports 1D chunks");
+
+        const size_t s = etl::size(input);
+
+        cpp_assert(etl::size(output) == s, "Invalid output size for conv_1d_stream");
+
+        for (size_t first = 0; first < s; first += l) {
+            const size_t m = std::min(l, s - first);
+
+            for (size_t i = 0; i < m; ++i) {
+                buffer[k - 1 + i] = input[first + i];
+            }
+
+            process(m);
+
+            for (size_t i = 0; i < m; ++i) {
+                output[first + i] = result[k - 1 + i];
+            }
+        }
+    }
+
+    /*!
+     * \brief Flush the remaining kernel_size() - 1 samples of the
+     * convolution and reset the state of the convolver.
+     * \param output The output for the last samples of the convolution
+     */
+    template <typename O>
+    void flush(O&& output) {
+        static_assert(is_etl_expr<O>, "conv_1d_stream only supported for ETL expressions");
+
+        cpp_assert(etl::size(output) == k - 1, "Invalid output size for conv_1d_stream::flush");
+
+        for (size_t first = 0; first < k - 1; first += l) {
+            const size_t m = std::min(l, k - 1 - first);
+
+            std::fill_n(buffer.get() + k - 1, m, T(0));
+
+            process(m);
+
+            for (size_t i = 0; i < m; ++i) {
+                output[first + i] = result[k - 1 + i];
+            }
+        }
+
+        reset();
+    }
+
+    /*!
+     * \brief Reset the state of the convolver, to start a new signal
+     */
+    void reset() {
+        std::fill_n(buffer.get(), n, T(0));
+    }
+
+private:
+    /*!
+     * \brief Convolve the current block of the buffer.
+     *
+     * The buffer contains the k - 1 previous samples followed by the m
+     * new samples. The m valid outputs are stored in result, starting
+     * at k - 1, and the history is shifted for the next block.
+     *
+     * \param m The number of new samples in the buffer
+     */
+    void process(size_t m) {
+        std::fill(buffer.get() + k - 1 + m, buffer.get() + n, T(0));
+
+        impl::standard::detail::rfft1_kernel(buffer.get(), n, spectrum.get());
+
+        for (size_t i = 0; i < n / 2 + 1; ++i) {
+            spectrum[i] *= kernel_fft[i];
+        }
+
+        impl::standard::detail::irfft1_kernel(spectrum.get(), n, result.get());
+
+        // Keep the last k - 1 samples as history for the next block
+        std::copy(buffer.get() + m, buffer.get() + m + k - 1, buffer.get());
+    }
+
+    size_t k; ///< The size of the kernel
+    size_t l; ///< The maximum number of samples per block
+    size_t n; ///< The size of the FFT
+
+    std::unique_ptr<T[]> buffer;                ///< The history followed by the current block
+    std::unique_ptr<T[]> result;                ///< The result of the inverse FFT
+    std::unique_ptr<complex_type[]> spectrum;   ///< The spectrum of the current block
+    std::unique_ptr<complex_type[]> kernel_fft; ///< The cached spectrum of the kernel
+};
+
+} //end of namespace etl
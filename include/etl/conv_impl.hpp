@@ -40,6 +40,34 @@ enum class conv4_impl {
     BLAS_MKL   ///< BLAS reduction
 };
 
+/*!
+ * \brief Returns the name of the given 4D convolution implementation
+ * \param impl The implementation
+ * \return The name of the implementation
+ */
+inline const char* to_string(conv4_impl impl) {
+    switch (impl) {
+        case conv4_impl::STD:
+            return "STD";
+        case conv4_impl::VEC:
+            return "VEC";
+        case conv4_impl::CUDNN:
+            return "CUDNN";
+        case conv4_impl::FFT_STD:
+            return "FFT_STD";
+        case conv4_impl::FFT_MKL:
+            return "FFT_MKL";
+        case conv4_impl::FFT_CUFFT:
+            return "FFT_CUFFT";
+        case conv4_impl::BLAS_VEC:
+            return "BLAS_VEC";
+        case conv4_impl::BLAS_MKL:
+            return "BLAS_MKL";
+    }
+
+    return "?";
+}
+
 /*!
  * \brief Enumeration describing the different multiple convolution implementations
  */
@@ -407,4 +407,53 @@ void swap(custom_dyn_matrix_impl<T, SO, D>& lhs, custom_dyn_matrix_impl<T, SO, D
     lhs.swap(rhs);
 }
 
+/*!
+ * \brief Serialize the given matrix using the given serializer
+ * \param os The serializer
+ * \param matrix The matrix to serialize
+ */
+template <typename Stream, typename T, order SO, size_t D>
+void serialize(serializer<Stream>& os, const custom_dyn_matrix_impl<T, SO, D>& matrix) {
+    for (size_t i = 0; i < etl::dimensions(matrix); ++i) {
+        os << matrix.dim(i);
+    }
+
+    matrix.ensure_cpu_up_to_date();
+
+    os.write(matrix.memory_start(), etl::size(matrix));
+}
+
+/*!
+ * \brief Deserialize the given matrix using the given serializer.
+ *
+ * The memory of a custom matrix cannot be reallocated, the serialized
+ * matrix must have the same dimensions. Otherwise, the values are not
+ * read, the matrix is left unchanged and the failbit of the stream is
+ * set.
+ *
+ * \param is The deserializer
+ * \param matrix The matrix to deserialize
+ */
+template <typename Stream, typename T, order SO, size_t D>
+void deserialize(deserializer<Stream>& is, custom_dyn_matrix_impl<T, SO, D>& matrix) {
+    bool same = true;
+
+    for (size_t i = 0; i < etl::dimensions(matrix); ++i) {
+        size_t d = 0;
+        is >> d;
+
+        same = same && d == matrix.dim(i);
+    }
+
+    if (!same || !is.stream) {
+        is.stream.setstate(std::ios_base::failbit);
+        return;
+    }
+
+    is.read(matrix.memory_start(), etl::size(matrix));
+
+    matrix.validate_cpu();
+    matrix.invalidate_gpu();
+}
+
 } //end of namespace etl
@@ -42,6 +42,23 @@ struct deserializer {
 
         return *this;
     }
+
+    /*!
+     * \brief Reads contiguous values from the stream, with a single read
+     * for arithmetic values
+     * \param values Pointer to the first value to read
+     * \param n The number of values to read
+     */
+    template <typename T>
+    void read(T* values, size_t n) {
+        if constexpr (std::is_arithmetic_v<T>) {
+            stream.read(reinterpret_cast<char_t*>(values), n * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                *this >> values[i];
+            }
+        }
+    }
 };
 
 } //end of namespace etl
@@ -36,4 +36,24 @@ std::string resolution_to_string() {
     }
 }
 
+/*!
+ * \brief Returns a human-readable string of the given duration
+ * \param ns The duration in nanoseconds
+ */
+inline std::string duration_string(double ns) {
+    char buffer[32];
+
+    if (ns >= 1e9) {
+        snprintf(buffer, sizeof(buffer), "%.3fs", ns / 1e9);
+    } else if (ns >= 1e6) {
+        snprintf(buffer, sizeof(buffer), "%.3fms", ns / 1e6);
+    } else if (ns >= 1e3) {
+        snprintf(buffer, sizeof(buffer), "%.3fus", ns / 1e3);
+    } else {
+        snprintf(buffer, sizeof(buffer), "%.0fns", ns);
+    }
+
+    return buffer;
+}
+
 } //end of namespace etl
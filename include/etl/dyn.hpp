@@ -682,9 +682,9 @@ void serialize(serializer<Stream>& os, const dyn_matrix_impl<T, SO, D>& matrix)
         os << matrix.dim(i);
     }
 
-    for (const auto& value : matrix) {
-        os << value;
-    }
+    matrix.ensure_cpu_up_to_date();
+
+    os.write(matrix.memory_start(), etl::size(matrix));
 }
 
 /*!
@@ -702,9 +702,10 @@ void deserialize(deserializer<Stream>& is, dyn_matrix_impl<T, SO, D>& matrix) {
 
     matrix.resize_arr(new_dimensions);
 
-    for (auto& value : matrix) {
-        is >> value;
-    }
+    is.read(matrix.memory_start(), etl::size(matrix));
+
+    matrix.validate_cpu();
+    matrix.invalidate_gpu();
 }
 
 } //end of namespace etl
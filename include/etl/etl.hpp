@@ -24,12 +24,15 @@
 #include "etl/sparse_storage.hpp"
 #include "etl/config.hpp"
 #include "etl/context.hpp"
+#include "etl/find_select.hpp"
 #include "etl/parallel_session.hpp"
 #include "etl/complex.hpp"
 #include "etl/vectorization.hpp"
 #include "etl/random.hpp"
 #include "etl/duration.hpp"
+#include "etl/util/profiler.hpp"
 #include "etl/threshold.hpp"
+#include "etl/tuning.hpp"
 #include "etl/thread_engine.hpp"
 #include "etl/memory.hpp"
 #include "etl/allocator.hpp"
@@ -70,6 +73,9 @@
 // The parallel utilies
 #include "etl/parallel_support.hpp"
 
+// Sparse triplets and element-wise kernels
+#include "etl/sparse_merge.hpp"
+
 // The evaluator
 #include "etl/evaluator.hpp"
 
@@ -105,12 +111,14 @@
 #include "etl/expr/dyn_prob_pool_2d_expr.hpp"
 #include "etl/expr/convmtx_2d_expr.hpp"
 #include "etl/expr/fft_expr.hpp"
+#include "etl/expr/rfft_expr.hpp"
 #include "etl/expr/gemm_expr.hpp"
 #include "etl/expr/gemv_expr.hpp"
 #include "etl/expr/gevm_expr.hpp"
 #include "etl/expr/outer_product_expr.hpp"
 #include "etl/expr/batch_outer_product_expr.hpp"
 #include "etl/expr/inv_expr.hpp"
+#include "etl/expr/solve_expr.hpp"
 #include "etl/expr/conv_1d_valid_expr.hpp"
 #include "etl/expr/conv_1d_same_expr.hpp"
 #include "etl/expr/conv_1d_full_expr.hpp"
@@ -196,9 +204,15 @@
 #include "etl/adapters/strictly_upper.hpp"
 #include "etl/adapters/uni_upper.hpp"
 
+// Streaming support
+#include "etl/conv_1d_stream.hpp"
+
 // Serialization support
 #include "etl/serializer.hpp"
 #include "etl/deserializer.hpp"
+#include "etl/binary_format.hpp"
+#include "etl/mapped_matrix.hpp"
+#include "etl/chunk_stream.hpp"
 
 // to_string support
 #include "etl/print.hpp"
@@ -24,12 +24,15 @@
 #include "etl/sparse_storage.hpp"
 #include "etl/config.hpp"
 #include "etl/context.hpp"
+#include "etl/find_select.hpp"
 #include "etl/parallel_session.hpp"
 #include "etl/complex.hpp"
 #include "etl/vectorization.hpp"
 #include "etl/random.hpp"
 #include "etl/duration.hpp"
+#include "etl/util/profiler.hpp"
 #include "etl/threshold.hpp"
+#include "etl/tuning.hpp"
 #include "etl/thread_engine.hpp"
 #include "etl/memory.hpp"
 #include "etl/allocator.hpp"
@@ -70,6 +73,9 @@
 // The parallel utilies
 #include "etl/parallel_support.hpp"
 
+// Sparse triplets and element-wise kernels
+#include "etl/sparse_merge.hpp"
+
 // The evaluator
 #include "etl/evaluator.hpp"
 
@@ -131,6 +137,9 @@
 // Serialization support
 #include "etl/serializer.hpp"
 #include "etl/deserializer.hpp"
+#include "etl/binary_format.hpp"
+#include "etl/mapped_matrix.hpp"
+#include "etl/chunk_stream.hpp"
 
 // to_string support
 #include "etl/print.hpp"
@@ -1178,7 +1178,9 @@ void std_assign_evaluate(Expr&& expr, Result&& result) {
     std::cout << result << "=" << expr << std::endl;
 #endif
 
-    if constexpr (direct_assign_compatible<Expr, Result>) {
+    if constexpr (is_sparse_mergeable<Expr, Result>) {
+        sparse_merge_assign(expr, result);
+    } else if constexpr (direct_assign_compatible<Expr, Result>) {
         standard_evaluator::assign_evaluate(expr, result);
     } else {
         inc_counter("eval:transpose");
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "etl/expr/base_temporary_expr.hpp"
+#include "etl/impl/embedding.hpp"
 
 namespace etl {
 
@@ -76,17 +77,21 @@ struct batch_embedding_gradients_expr : base_temporary_expr_tern<batch_embedding
 
         check(a, b, c, lhs);
 
-        const auto BB = etl::dim<0>(a);
-        const auto I  = etl::dim<1>(a);
-
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_rhs(b);
 
-        lhs = 0;
+        if constexpr (detail::embedding_impl::direct<B, L> && is_row_major<A>) {
+            detail::embedding_impl::scatter(a, b, lhs);
+        } else {
+            const auto BB = etl::dim<0>(a);
+            const auto I  = etl::dim<1>(a);
+
+            lhs = 0;
 
-        for (size_t bb = 0; bb < BB; ++bb) {
-            for (size_t i = 0; i < I; ++i) {
-                lhs(a(bb, i)) += b(bb)(i);
+            for (size_t bb = 0; bb < BB; ++bb) {
+                for (size_t i = 0; i < I; ++i) {
+                    lhs(a(bb, i)) += b(bb)(i);
+                }
             }
         }
     }
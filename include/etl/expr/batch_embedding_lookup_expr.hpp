@@ -8,6 +8,7 @@
 #pragma once
 
 #include "etl/expr/base_temporary_expr.hpp"
+#include "etl/impl/embedding.hpp"
 
 namespace etl {
 
@@ -78,12 +79,16 @@ struct batch_embedding_lookup_expr : base_temporary_expr_bin<batch_embedding_loo
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_rhs(b);
 
-        const auto BB = etl::dim<0>(a);
-        const auto I  = etl::dim<1>(a);
+        if constexpr (detail::embedding_impl::direct<B, L> && is_row_major<A>) {
+            detail::embedding_impl::gather(a, b, lhs);
+        } else {
+            const auto BB = etl::dim<0>(a);
+            const auto I  = etl::dim<1>(a);
 
-        for (size_t bb = 0; bb < BB; ++bb) {
-            for (size_t i = 0; i < I; ++i) {
-                lhs(bb)(i) = b(a(bb, i));
+            for (size_t bb = 0; bb < BB; ++bb) {
+                for (size_t i = 0; i < I; ++i) {
+                    lhs(bb)(i) = b(a(bb, i));
+                }
             }
         }
     }
@@ -18,23 +18,36 @@
 namespace etl {
 
 /*!
- * \brief A transposition expression.
- * \tparam A The transposed type
+ * \brief A 4D bias addition expression, with an optional fused
+ * activation.
+ * \tparam A The input type
+ * \tparam B The biases type
+ * \tparam F The activation operator (identity_op for none)
  */
-template <typename A, typename B>
-struct bias_add_4d_expr : base_temporary_expr_bin<bias_add_4d_expr<A, B>, A, B> {
+template <typename A, typename B, typename F>
+struct bias_add_4d_expr : base_temporary_expr_bin<bias_add_4d_expr<A, B, F>, A, B> {
     using value_type = value_t<A>;                               ///< The type of value of the expression
-    using this_type  = bias_add_4d_expr<A, B>;                   ///< The type of this expression
+    using this_type  = bias_add_4d_expr<A, B, F>;                ///< The type of this expression
     using base_type  = base_temporary_expr_bin<this_type, A, B>; ///< The base type
     using sub_traits = decay_traits<A>;                          ///< The traits of the sub type
 
     static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
 
+    /*!
+     * \brief Indicates if an activation is fused in the bias addition
+     */
+    static constexpr bool activated = !std::is_same_v<F, identity_op>;
+
+    /*!
+     * \brief Indicates if the activation can be vectorized
+     */
+    static constexpr bool vec_activation = !activated || F::template vectorizable<vector_mode>;
+
     /*!
      * \brief Indicates if the temporary expression can be directly evaluated
      * using only GPU.
      */
-    static constexpr bool gpu_computable = cudnn_enabled && all_floating<A, B> && all_homogeneous<A, B>;
+    static constexpr bool gpu_computable = cudnn_enabled && all_floating<A, B> && all_homogeneous<A, B> && !activated;
 
     /*!
      * \brief Construct a new expression
@@ -97,12 +110,12 @@ struct bias_add_4d_expr : base_temporary_expr_bin<bias_add_4d_expr<A, B>, A, B>
         if
             constexpr_select(impl == bias_add_impl::VEC) {
                 inc_counter("impl:vec");
-                impl::vec::bias_add_4d(smart_forward(a), smart_forward(b), lhs);
+                impl::vec::bias_add_4d<F>(smart_forward(a), smart_forward(b), lhs);
             }
         else if
             constexpr_select(impl == bias_add_impl::STD) {
                 inc_counter("impl:std");
-                impl::standard::bias_add_4d(smart_forward(a), smart_forward(b), lhs);
+                impl::standard::bias_add_4d<F>(smart_forward(a), smart_forward(b), lhs);
             }
         else if
             constexpr_select(impl == bias_add_impl::EGBLAS) {
@@ -184,7 +197,11 @@ struct bias_add_4d_expr : base_temporary_expr_bin<bias_add_4d_expr<A, B>, A, B>
      * \return the output stream
      */
     friend std::ostream& operator<<(std::ostream& os, const bias_add_4d_expr& expr) {
-        return os << "bias_add(" << expr._a << "," << expr._b << ")";
+        if constexpr (activated) {
+            return os << F::desc() << "(bias_add(" << expr._a << "," << expr._b << "))";
+        } else {
+            return os << "bias_add(" << expr._a << "," << expr._b << ")";
+        }
     }
 
 private:
@@ -200,14 +217,14 @@ private:
     template <typename C>
     static constexpr etl::bias_add_impl select_default_impl(bool no_gpu) {
         constexpr bool homo           = all_homogeneous<A, B, C>;
-        constexpr bool vec_possible   = vec_enabled && vectorize_impl && all_vectorizable<vector_mode, A, B, C> && homo;
-        constexpr bool cudnn_possible = cudnn_enabled && all_floating<A, B, C> && homo;
+        constexpr bool vec_possible   = vec_enabled && vectorize_impl && all_vectorizable<vector_mode, A, B, C> && homo && vec_activation;
+        constexpr bool cudnn_possible = cudnn_enabled && all_floating<A, B, C> && homo && !activated;
 
-        if (homo && is_single_precision<A> && impl::egblas::has_sbias_add_4d) {
+        if (homo && !activated && is_single_precision<A> && impl::egblas::has_sbias_add_4d) {
             return etl::bias_add_impl::EGBLAS;
         }
 
-        if (homo && is_double_precision<A> && impl::egblas::has_dbias_add_4d) {
+        if (homo && !activated && is_double_precision<A> && impl::egblas::has_dbias_add_4d) {
             return etl::bias_add_impl::EGBLAS;
         }
 
@@ -239,9 +256,8 @@ private:
             switch (forced) {
                 // EGBLAS cannot always be used
                 case bias_add_impl::EGBLAS:
-                    if (!all_homogeneous<
-                            A, B,
-                            C> || !((is_single_precision<A> && impl::egblas::has_sbias_add_4d) || (is_double_precision<A> && impl::egblas::has_sbias_add_4d))
+                    if (activated || !all_homogeneous<A, B, C>
+                        || !((is_single_precision<A> && impl::egblas::has_sbias_add_4d) || (is_double_precision<A> && impl::egblas::has_sbias_add_4d))
                         || local_context().cpu) {
                         std::cerr << "Forced selection to EGBLAS bias_add implementation, but not possible for this expression" << std::endl;
                         return def;
@@ -251,7 +267,7 @@ private:
 
                 //CUDNN cannot always be used
                 case bias_add_impl::CUDNN:
-                    if (!cudnn_enabled || !all_floating<A, B, C> || !all_homogeneous<A, B, C> || local_context().cpu) {
+                    if (activated || !cudnn_enabled || !all_floating<A, B, C> || !all_homogeneous<A, B, C> || local_context().cpu) {
                         std::cerr << "Forced selection to cUDNN bias_add implementation, but not possible for this expression" << std::endl;
                         return def;
                     }
@@ -260,7 +276,7 @@ private:
 
                 //VEC cannot always be used
                 case bias_add_impl::VEC:
-                    if (!vec_enabled || !vectorize_impl || !all_vectorizable<vector_mode, A, B, C> || !all_homogeneous<A, B, C>) {
+                    if (!vec_enabled || !vectorize_impl || !all_vectorizable<vector_mode, A, B, C> || !all_homogeneous<A, B, C> || !vec_activation) {
                         std::cerr << "Forced selection to VEC bias_add implementation, but not possible for this expression" << std::endl;
                         return def;
                     }
@@ -298,12 +314,12 @@ private:
  * \tparam A The input type
  * \tparam B The biases type
  */
-template <typename A, typename B>
-struct etl_traits<etl::bias_add_4d_expr<A, B>> {
-    using expr_t     = etl::bias_add_4d_expr<A, B>; ///< The expression type
-    using sub_expr_t = std::decay_t<A>;             ///< The sub expression type
-    using sub_traits = etl_traits<sub_expr_t>;      ///< The sub traits
-    using value_type = value_t<A>;                  ///< The value type of the expression
+template <typename A, typename B, typename F>
+struct etl_traits<etl::bias_add_4d_expr<A, B, F>> {
+    using expr_t     = etl::bias_add_4d_expr<A, B, F>; ///< The expression type
+    using sub_expr_t = std::decay_t<A>;                ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;         ///< The sub traits
+    using value_type = value_t<A>;                     ///< The value type of the expression
 
     static constexpr bool is_etl         = true;                                 ///< Indicates if the type is an ETL expression
     static constexpr bool is_transformer = false;                                ///< Indicates if the type is a transformer
@@ -381,12 +397,60 @@ struct etl_traits<etl::bias_add_4d_expr<A, B>> {
  * \return The transpose of the given expression.
  */
 template <typename E, typename B>
-bias_add_4d_expr<detail::build_type<E>, detail::build_type<B>> bias_add_4d(const E& x, const B& biases) {
+bias_add_4d_expr<detail::build_type<E>, detail::build_type<B>, identity_op> bias_add_4d(const E& x, const B& biases) {
     static_assert(all_etl_expr<E, B>, "etl::bias_add can only be used on ETL expressions");
     static_assert(is_4d<E>, "etl::bias_add is only defined for 4D input");
     static_assert(is_1d<B>, "etl::bias_add is only defined for 1D bias vector");
 
-    return bias_add_4d_expr<detail::build_type<E>, detail::build_type<B>>{x, biases};
+    return bias_add_4d_expr<detail::build_type<E>, detail::build_type<B>, identity_op>{x, biases};
+}
+
+/*!
+ * \brief Returns the rectified linear of the result of adding the bias [K] to
+ * the 4D matrix [N1, K, N2, N3], computed in a single pass
+ * \param x The 4D matrix
+ * \param biases The vector of biases
+ * \return The activated biased expression.
+ */
+template <typename E, typename B>
+bias_add_4d_expr<detail::build_type<E>, detail::build_type<B>, relu_unary_op<value_t<E>>> bias_add_4d_relu(const E& x, const B& biases) {
+    static_assert(all_etl_expr<E, B>, "etl::bias_add_4d_relu can only be used on ETL expressions");
+    static_assert(is_4d<E>, "etl::bias_add_4d_relu is only defined for 4D input");
+    static_assert(is_1d<B>, "etl::bias_add_4d_relu is only defined for 1D bias vector");
+
+    return bias_add_4d_expr<detail::build_type<E>, detail::build_type<B>, relu_unary_op<value_t<E>>>{x, biases};
+}
+
+/*!
+ * \brief Returns the logistic sigmoid of the result of adding the bias [K] to
+ * the 4D matrix [N1, K, N2, N3], computed in a single pass
+ * \param x The 4D matrix
+ * \param biases The vector of biases
+ * \return The activated biased expression.
+ */
+template <typename E, typename B>
+bias_add_4d_expr<detail::build_type<E>, detail::build_type<B>, sigmoid_unary_op<value_t<E>>> bias_add_4d_sigmoid(const E& x, const B& biases) {
+    static_assert(all_etl_expr<E, B>, "etl::bias_add_4d_sigmoid can only be used on ETL expressions");
+    static_assert(is_4d<E>, "etl::bias_add_4d_sigmoid is only defined for 4D input");
+    static_assert(is_1d<B>, "etl::bias_add_4d_sigmoid is only defined for 1D bias vector");
+
+    return bias_add_4d_expr<detail::build_type<E>, detail::build_type<B>, sigmoid_unary_op<value_t<E>>>{x, biases};
+}
+
+/*!
+ * \brief Returns the hyperbolic tangent of the result of adding the bias [K] to
+ * the 4D matrix [N1, K, N2, N3], computed in a single pass
+ * \param x The 4D matrix
+ * \param biases The vector of biases
+ * \return The activated biased expression.
+ */
+template <typename E, typename B>
+bias_add_4d_expr<detail::build_type<E>, detail::build_type<B>, tanh_unary_op<value_t<E>>> bias_add_4d_tanh(const E& x, const B& biases) {
+    static_assert(all_etl_expr<E, B>, "etl::bias_add_4d_tanh can only be used on ETL expressions");
+    static_assert(is_4d<E>, "etl::bias_add_4d_tanh is only defined for 4D input");
+    static_assert(is_1d<B>, "etl::bias_add_4d_tanh is only defined for 1D bias vector");
+
+    return bias_add_4d_expr<detail::build_type<E>, detail::build_type<B>, tanh_unary_op<value_t<E>>>{x, biases};
 }
 
 } //end of namespace etl
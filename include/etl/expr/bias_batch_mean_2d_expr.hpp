@@ -10,6 +10,7 @@
 #include "etl/expr/base_temporary_expr.hpp"
 
 #include "etl/impl/cudnn/bias_batch_mean.hpp"
+#include "etl/impl/batch_norm.hpp"
 
 namespace etl {
 
@@ -81,17 +82,33 @@ struct bias_batch_mean_2d_expr : base_temporary_expr_un<bias_batch_mean_2d_expr<
 
             standard_evaluator::pre_assign_rhs(a);
 
-            for (size_t k = 0; k < K; ++k) {
-                T mean(0);
+            if constexpr (all_row_major<A> && is_dma<L>) {
+                // Vectorized over the contiguous channels, in parallel
+                safe_ensure_cpu_up_to_date(a);
 
-                for (size_t b = 0; b < N; ++b) {
-                    mean += a(b, k);
-                }
+                detail::batch_norm_impl::batch_sum_2d<false>(a, a, lhs);
 
                 if constexpr (Mean) {
-                    lhs(k) = mean / N;
-                } else {
-                    lhs(k) = mean;
+                    for (size_t k = 0; k < K; ++k) {
+                        lhs(k) /= N;
+                    }
+                }
+
+                lhs.validate_cpu();
+                lhs.invalidate_gpu();
+            } else {
+                for (size_t k = 0; k < K; ++k) {
+                    T mean(0);
+
+                    for (size_t b = 0; b < N; ++b) {
+                        mean += a(b, k);
+                    }
+
+                    if constexpr (Mean) {
+                        lhs(k) = mean / N;
+                    } else {
+                        lhs(k) = mean;
+                    }
                 }
             }
         }
@@ -10,6 +10,7 @@
 #include "etl/expr/base_temporary_expr.hpp"
 
 #include "etl/impl/cudnn/bias_batch_mean.hpp"
+#include "etl/impl/batch_norm.hpp"
 
 namespace etl {
 
@@ -83,14 +84,29 @@ struct bias_batch_var_2d_expr : base_temporary_expr_bin<bias_batch_var_2d_expr<A
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_rhs(b);
 
-        for (size_t k = 0; k < K; ++k) {
-            T mean(0);
+        if constexpr (all_row_major<A> && is_dma<L>) {
+            // Vectorized over the contiguous channels, in parallel
+            safe_ensure_cpu_up_to_date(a);
+            safe_ensure_cpu_up_to_date(b);
 
-            for (size_t bb = 0; bb < N; ++bb) {
-                mean += (a(bb, k) - b(k)) * (a(bb, k) - b(k));
+            detail::batch_norm_impl::batch_sum_2d<true>(a, b, lhs);
+
+            for (size_t k = 0; k < K; ++k) {
+                lhs(k) /= N;
             }
 
-            lhs(k) = mean / N;
+            lhs.validate_cpu();
+            lhs.invalidate_gpu();
+        } else {
+            for (size_t k = 0; k < K; ++k) {
+                T mean(0);
+
+                for (size_t bb = 0; bb < N; ++bb) {
+                    mean += (a(bb, k) - b(k)) * (a(bb, k) - b(k));
+                }
+
+                lhs(k) = mean / N;
+            }
         }
     }
 
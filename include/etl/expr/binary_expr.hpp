@@ -9,6 +9,205 @@
 
 namespace etl {
 
+namespace detail {
+
+/*!
+ * \brief The position of a subexpression common to both sides of a binary
+ * expression E op R.
+ */
+enum class binary_cse {
+    NONE,      ///< No common subexpression
+    BOTH,      ///< E op E
+    RIGHT_LHS, ///< E op (E op2 X)
+    RIGHT_RHS, ///< E op (X op2 E)
+    LEFT_LHS,  ///< (E op2 X) op E
+    LEFT_RHS   ///< (X op2 E) op E
+};
+
+/*!
+ * \brief Traits indicating if the given expression can be evaluated only
+ * once when it appears on both sides of a binary expression.
+ *
+ * This is the case for deterministic unary expressions, the identity of
+ * their sub expressions is tested at runtime with unary_expr::same_as.
+ */
+template <typename E>
+struct cse_candidate : std::false_type {};
+
+/*!
+ * \copydoc cse_candidate
+ */
+template <typename T, typename Expr, typename UnaryOp>
+struct cse_candidate<unary_expr<T, Expr, UnaryOp>> : std::bool_constant<std::is_lvalue_reference_v<Expr> && UnaryOp::thread_safe> {};
+
+/*!
+ * \copydoc cse_candidate
+ */
+template <typename T, typename Expr>
+struct cse_candidate<unary_expr<T, Expr, identity_op>> : std::false_type {};
+
+/*!
+ * \copydoc cse_candidate
+ */
+template <typename T, typename Expr>
+struct cse_candidate<unary_expr<T, Expr, transform_op>> : std::false_type {};
+
+/*!
+ * \copydoc cse_candidate
+ */
+template <typename T, typename Expr, typename Op>
+struct cse_candidate<unary_expr<T, Expr, stateful_op<Op>>> : std::false_type {};
+
+/*!
+ * \brief Find the subexpression common to the two sides of a binary
+ * expression
+ * \tparam L The decayed type of the left hand side
+ * \tparam R The decayed type of the right hand side
+ */
+template <typename L, typename R>
+constexpr binary_cse select_binary_cse() {
+    if constexpr (cse_candidate<L>::value && std::is_same_v<L, R>) {
+        return binary_cse::BOTH;
+    } else if constexpr (cse_candidate<L>::value && is_binary_expr<R>) {
+        if constexpr (std::is_same_v<L, typename etl_traits<R>::left_expr_t>) {
+            return binary_cse::RIGHT_LHS;
+        } else if constexpr (std::is_same_v<L, typename etl_traits<R>::right_expr_t>) {
+            return binary_cse::RIGHT_RHS;
+        } else {
+            return binary_cse::NONE;
+        }
+    } else if constexpr (cse_candidate<R>::value && is_binary_expr<L>) {
+        if constexpr (std::is_same_v<R, typename etl_traits<L>::left_expr_t>) {
+            return binary_cse::LEFT_LHS;
+        } else if constexpr (std::is_same_v<R, typename etl_traits<L>::right_expr_t>) {
+            return binary_cse::LEFT_RHS;
+        } else {
+            return binary_cse::NONE;
+        }
+    } else {
+        return binary_cse::NONE;
+    }
+}
+
+/*!
+ * \brief Traits indicating if the given expression is an element-wise
+ * multiplication that can be fused in a multiply-add.
+ */
+template <typename E>
+struct fma_candidate : std::false_type {};
+
+/*!
+ * \copydoc fma_candidate
+ */
+template <typename T, typename L, typename R>
+struct fma_candidate<binary_expr<T, L, mul_binary_op<T>, R>>
+        : std::bool_constant<(std::is_same_v<T, float> || std::is_same_v<T, double>)
+                             && select_binary_cse<std::decay_t<L>, std::decay_t<R>>() == binary_cse::NONE> {};
+
+/*!
+ * \brief Element accessor through operator[] used to evaluate common
+ * subexpressions.
+ */
+struct cse_index_access {
+    size_t i; ///< The index
+
+    /*!
+     * \brief Returns the element of the given expression
+     */
+    template <typename E>
+    ETL_STRONG_INLINE(auto) get(const E& e) const {
+        return e[i];
+    }
+
+    /*!
+     * \brief Apply the given operator
+     */
+    template <typename Op, typename X, typename Y>
+    static ETL_STRONG_INLINE(auto) apply(const X& lhs, const Y& rhs) {
+        return Op::apply(lhs, rhs);
+    }
+
+    /*!
+     * \brief Compute a * b + c with a single rounding
+     */
+    template <typename X>
+    static ETL_STRONG_INLINE(X) fmadd(X a, X b, X c) {
+        return std::fma(a, b, c);
+    }
+};
+
+/*!
+ * \brief Element accessor through read_flat used to evaluate common
+ * subexpressions.
+ */
+struct cse_flat_access {
+    size_t i; ///< The index
+
+    /*!
+     * \brief Returns the element of the given expression
+     */
+    template <typename E>
+    ETL_STRONG_INLINE(auto) get(const E& e) const {
+        return e.read_flat(i);
+    }
+
+    /*!
+     * \brief Apply the given operator
+     */
+    template <typename Op, typename X, typename Y>
+    static ETL_STRONG_INLINE(auto) apply(const X& lhs, const Y& rhs) {
+        return Op::apply(lhs, rhs);
+    }
+
+    /*!
+     * \brief Compute a * b + c with a single rounding
+     */
+    template <typename X>
+    static ETL_STRONG_INLINE(X) fmadd(X a, X b, X c) {
+        return std::fma(a, b, c);
+    }
+};
+
+/*!
+ * \brief Vector accessor used to evaluate common subexpressions.
+ * \tparam V The vectorization mode
+ * \tparam Unaligned Indicates if unaligned loads are used
+ */
+template <typename V, bool Unaligned>
+struct cse_load_access {
+    size_t i; ///< The index
+
+    /*!
+     * \brief Returns the vector of elements of the given expression
+     */
+    template <typename E>
+    ETL_STRONG_INLINE(auto) get(const E& e) const {
+        if constexpr (Unaligned) {
+            return e.template loadu<V>(i);
+        } else {
+            return e.template load<V>(i);
+        }
+    }
+
+    /*!
+     * \brief Apply the given operator
+     */
+    template <typename Op, typename X, typename Y>
+    static ETL_STRONG_INLINE(auto) apply(const X& lhs, const Y& rhs) {
+        return Op::template load<V>(lhs, rhs);
+    }
+
+    /*!
+     * \brief Compute a * b + c with a single rounding
+     */
+    template <typename X>
+    static ETL_STRONG_INLINE(X) fmadd(X a, X b, X c) {
+        return V::fmadd(a, b, c);
+    }
+};
+
+} //end of namespace detail
+
 /*!
  * \brief A binary expression
  *
@@ -75,6 +274,103 @@ public:
     binary_expr& operator=(const binary_expr& e) = delete;
     binary_expr& operator=(binary_expr&& e) = delete;
 
+private:
+    /*!
+     * \brief The subexpression common to both sides
+     */
+    static constexpr detail::binary_cse cse = detail::select_binary_cse<std::decay_t<LeftExpr>, std::decay_t<RightExpr>>();
+
+    /*!
+     * \brief Indicates if the expression is a multiply-add that can be
+     * fused (x * y + z or z + x * y)
+     */
+    static constexpr bool fma = fma_rewrite && std::is_same_v<BinaryOp, plus_binary_op<T>> && cse == detail::binary_cse::NONE
+                                && (detail::fma_candidate<std::decay_t<LeftExpr>>::value || detail::fma_candidate<std::decay_t<RightExpr>>::value);
+
+    /*!
+     * \brief Compute the value of the expression with the given accessor,
+     * evaluating only once the subexpression common to both sides when
+     * they refer to the same expression.
+     * \param access The accessor to the elements of the sub expressions
+     * \return the value of the expression
+     */
+    template <typename Access>
+    ETL_STRONG_INLINE(auto) cse_compute(const Access& access) const {
+        if constexpr (cse == detail::binary_cse::BOTH) {
+            if (lhs.same_as(rhs)) {
+                auto x = access.get(lhs);
+                return access.template apply<BinaryOp>(x, x);
+            }
+        } else if constexpr (cse == detail::binary_cse::RIGHT_LHS || cse == detail::binary_cse::RIGHT_RHS) {
+            using sub_op = typename etl_traits<std::decay_t<RightExpr>>::op_t;
+
+            if constexpr (cse == detail::binary_cse::RIGHT_LHS) {
+                if (lhs.same_as(rhs.get_lhs())) {
+                    auto x = access.get(lhs);
+                    return access.template apply<BinaryOp>(x, access.template apply<sub_op>(x, access.get(rhs.get_rhs())));
+                }
+            } else {
+                if (lhs.same_as(rhs.get_rhs())) {
+                    auto x = access.get(lhs);
+                    return access.template apply<BinaryOp>(x, access.template apply<sub_op>(access.get(rhs.get_lhs()), x));
+                }
+            }
+        } else {
+            using sub_op = typename etl_traits<std::decay_t<LeftExpr>>::op_t;
+
+            if constexpr (cse == detail::binary_cse::LEFT_LHS) {
+                if (rhs.same_as(lhs.get_lhs())) {
+                    auto x = access.get(rhs);
+                    return access.template apply<BinaryOp>(access.template apply<sub_op>(x, access.get(lhs.get_rhs())), x);
+                }
+            } else {
+                if (rhs.same_as(lhs.get_rhs())) {
+                    auto x = access.get(rhs);
+                    return access.template apply<BinaryOp>(access.template apply<sub_op>(access.get(lhs.get_lhs()), x), x);
+                }
+            }
+        }
+
+        return access.template apply<BinaryOp>(access.get(lhs), access.get(rhs));
+    }
+
+    /*!
+     * \brief Compute the multiply-add expression with a single fused
+     * multiply-add
+     * \param access The accessor to the elements of the sub expressions
+     * \return the value (or the vector of values) of the expression
+     */
+    template <typename Access>
+    ETL_STRONG_INLINE(auto) fma_compute(const Access& access) const {
+        if constexpr (detail::fma_candidate<std::decay_t<LeftExpr>>::value) {
+            return access.fmadd(access.get(lhs.get_lhs()), access.get(lhs.get_rhs()), access.get(rhs));
+        } else {
+            return access.fmadd(access.get(rhs.get_lhs()), access.get(rhs.get_rhs()), access.get(lhs));
+        }
+    }
+
+    /*!
+     * \brief Indicates if the common subexpression of both sides is the
+     * same expression and is thus evaluated only once.
+     */
+    bool has_common_subexpression() const {
+        if constexpr (cse == detail::binary_cse::BOTH) {
+            return lhs.same_as(rhs);
+        } else if constexpr (cse == detail::binary_cse::RIGHT_LHS) {
+            return lhs.same_as(rhs.get_lhs());
+        } else if constexpr (cse == detail::binary_cse::RIGHT_RHS) {
+            return lhs.same_as(rhs.get_rhs());
+        } else if constexpr (cse == detail::binary_cse::LEFT_LHS) {
+            return rhs.same_as(lhs.get_lhs());
+        } else if constexpr (cse == detail::binary_cse::LEFT_RHS) {
+            return rhs.same_as(lhs.get_rhs());
+        } else {
+            return false;
+        }
+    }
+
+public:
+
     /*!
      * \brief Test if this expression aliases with the given expression
      * \param other The other expression to test
@@ -93,7 +389,13 @@ public:
      * \return a reference to the element at the given index.
      */
     value_type operator[](size_t i) const {
-        return BinaryOp::apply(lhs[i], rhs[i]);
+        if constexpr (cse != detail::binary_cse::NONE) {
+            return cse_compute(detail::cse_index_access{i});
+        } else if constexpr (fma) {
+            return fma_compute(detail::cse_index_access{i});
+        } else {
+            return BinaryOp::apply(lhs[i], rhs[i]);
+        }
     }
 
     /*!
@@ -103,7 +405,13 @@ public:
      * \return the value at the given index.
      */
     value_type read_flat(size_t i) const {
-        return BinaryOp::apply(lhs.read_flat(i), rhs.read_flat(i));
+        if constexpr (cse != detail::binary_cse::NONE) {
+            return cse_compute(detail::cse_flat_access{i});
+        } else if constexpr (fma) {
+            return fma_compute(detail::cse_flat_access{i});
+        } else {
+            return BinaryOp::apply(lhs.read_flat(i), rhs.read_flat(i));
+        }
     }
 
     /*!
@@ -115,7 +423,13 @@ public:
     template <typename V = default_vec>
     ETL_STRONG_INLINE(vec_type<V>)
     load(size_t i) const {
-        return BinaryOp::template load<V>(lhs.template load<V>(i), rhs.template load<V>(i));
+        if constexpr (cse != detail::binary_cse::NONE) {
+            return cse_compute(detail::cse_load_access<V, false>{i});
+        } else if constexpr (fma) {
+            return fma_compute(detail::cse_load_access<V, false>{i});
+        } else {
+            return BinaryOp::template load<V>(lhs.template load<V>(i), rhs.template load<V>(i));
+        }
     }
 
     /*!
@@ -127,7 +441,13 @@ public:
     template <typename V = default_vec>
     ETL_STRONG_INLINE(vec_type<V>)
     loadu(size_t i) const {
-        return BinaryOp::template load<V>(lhs.template loadu<V>(i), rhs.template loadu<V>(i));
+        if constexpr (cse != detail::binary_cse::NONE) {
+            return cse_compute(detail::cse_load_access<V, true>{i});
+        } else if constexpr (fma) {
+            return fma_compute(detail::cse_load_access<V, true>{i});
+        } else {
+            return BinaryOp::template load<V>(lhs.template loadu<V>(i), rhs.template loadu<V>(i));
+        }
     }
 
     /*!
@@ -265,6 +585,15 @@ public:
     void visit(detail::evaluator_visitor& visitor) const {
         lhs.visit(visitor);
         rhs.visit(visitor);
+
+        // The rewrites are counted once per evaluation, not per element
+        if constexpr (cse != detail::binary_cse::NONE) {
+            if (has_common_subexpression()) {
+                inc_counter("rewrite:cse");
+            }
+        } else if constexpr (fma) {
+            inc_counter("rewrite:fma");
+        }
     }
 
     /*!
@@ -326,6 +655,7 @@ struct etl_traits<etl::binary_expr<T, LE, BinaryOp, RE>> {
     using expr_t       = etl::binary_expr<T, LE, BinaryOp, RE>; ///< The type of the expression
     using left_expr_t  = std::decay_t<LE>;                      ///< The type of the left expression
     using right_expr_t = std::decay_t<RE>;                      ///< The type of the right expression
+    using op_t         = BinaryOp;                              ///< The binary operator
     using value_type   = T;                                     ///< The value type
 
     static constexpr bool left_directed =
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "etl/expr/base_temporary_expr.hpp"
+#include "etl/impl/embedding.hpp"
 
 namespace etl {
 
@@ -79,10 +80,14 @@ struct embedding_gradients_expr : base_temporary_expr_tern<embedding_gradients_e
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_rhs(b);
 
-        lhs = 0;
+        if constexpr (detail::embedding_impl::direct<B, L>) {
+            detail::embedding_impl::scatter(a, b, lhs);
+        } else {
+            lhs = 0;
 
-        for (size_t i = 0; i < I; ++i) {
-            lhs(a(i)) += b(i);
+            for (size_t i = 0; i < I; ++i) {
+                lhs(a(i)) += b(i);
+            }
         }
     }
 
@@ -241,4 +246,38 @@ embedding_gradients_expr<detail::build_type<I>, detail::build_type<E>, detail::b
     return embedding_gradients_expr<detail::build_type<I>, detail::build_type<E>, detail::build_type<W>>{value, errors, vocab};
 }
 
+/*!
+ * \brief Compute the row-sparse gradients of an embedding vocabulary.
+ *
+ * Instead of a dense vocabulary-sized matrix, only the rows that are
+ * indexed are computed: rows is filled with the sorted unique indices
+ * and the u-th row of values with the sum of the errors of the index
+ * rows[u]. Each unique row is accumulated by a single thread.
+ *
+ * \param value The input sequence (1D) or batch of sequences (2D)
+ * \param errors The errors of the embeddings (2D or 3D)
+ * \param rows The output unique indices
+ * \param values The output gradients of each unique index
+ */
+template <typename I, typename E, typename T>
+void sparse_embedding_gradients(const I& value, const E& errors, std::vector<size_t>& rows, etl::dyn_matrix<T, 2>& values) {
+    static_assert(all_etl_expr<I, E>, "etl::sparse_embedding_gradients can only be used on ETL expressions");
+    static_assert(is_1d<I> || is_2d<I>, "etl::sparse_embedding_gradients is only defined for 1d or 2d input");
+    static_assert(decay_traits<E>::dimensions() == decay_traits<I>::dimensions() + 1, "Invalid dimensions for etl::sparse_embedding_gradients");
+    static_assert(is_dma<E> && is_row_major<E> && is_row_major<I>, "etl::sparse_embedding_gradients needs direct row-major errors");
+    static_assert(std::is_same_v<T, value_t<E>>, "etl::sparse_embedding_gradients needs values of the same type as the errors");
+
+    cpp_assert(etl::dim<0>(value) == etl::dim<0>(errors), "Invalid dimensions for etl::sparse_embedding_gradients");
+    cpp_assert(etl::size(value) * etl::dim<decay_traits<E>::dimensions() - 1>(errors) == etl::size(errors),
+               "Invalid dimensions for etl::sparse_embedding_gradients");
+
+    etl::force(value);
+    etl::force(errors);
+
+    safe_ensure_cpu_up_to_date(value);
+    safe_ensure_cpu_up_to_date(errors);
+
+    detail::embedding_impl::sparse_scatter(value, errors, rows, values);
+}
+
 } //end of namespace etl
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "etl/expr/base_temporary_expr.hpp"
+#include "etl/impl/embedding.hpp"
 
 namespace etl {
 
@@ -78,8 +79,12 @@ struct embedding_lookup_expr : base_temporary_expr_bin<embedding_lookup_expr<A,
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_rhs(b);
 
-        for (size_t i = 0; i < I; ++i) {
-            lhs(i) = b(a(i));
+        if constexpr (detail::embedding_impl::direct<B, L>) {
+            detail::embedding_impl::gather(a, b, lhs);
+        } else {
+            for (size_t i = 0; i < I; ++i) {
+                lhs(i) = b(a(i));
+            }
         }
     }
 
@@ -16,9 +16,48 @@
 #include "etl/impl/vec/gemm.hpp"
 #include "etl/impl/vec/gemm_conv.hpp"
 #include "etl/impl/cublas/gemm.hpp"
+#include "etl/impl/std/spmm.hpp"
+#include "etl/impl/vec/spmm.hpp"
+#include "etl/impl/structured_gemm.hpp"
 
 namespace etl {
 
+template <typename A, typename B, bool Strassen>
+struct gemm_expr;
+
+namespace detail {
+
+/*!
+ * \brief Indicates if the given operand of a matrix-matrix multiplication
+ * is a plain dense expression, without any structure to exploit
+ */
+template <typename E>
+constexpr bool plain_gemm_operand = !is_sparse_matrix<E> && !is_diagonal_matrix<E> && !structured_gemm_impl::triangular<E>;
+
+/*!
+ * \brief Traits indicating if the given expression is a dense
+ * matrix-matrix multiplication that can be reordered as part of a chain
+ * of multiplications.
+ */
+template <typename E>
+struct chain_gemm_impl : std::false_type {};
+
+/*!
+ * \copydoc chain_gemm_impl
+ */
+template <typename A, typename B>
+struct chain_gemm_impl<gemm_expr<A, B, false>> : std::bool_constant<plain_gemm_operand<A> && plain_gemm_operand<B>> {};
+
+/*!
+ * \brief Indicates if the given expression is a dense matrix-matrix
+ * multiplication that can be reordered as part of a chain of
+ * multiplications.
+ */
+template <typename E>
+constexpr bool chain_gemm = chain_gemm_impl<std::decay_t<E>>::value;
+
+} //end of namespace detail
+
 /*!
  * \brief A transposition expression.
  * \tparam A The transposed type
@@ -36,7 +75,25 @@ struct gemm_expr : base_temporary_expr_bin<gemm_expr<A, B, Strassen>, A, B> {
      * \brief Indicates if the temporary expression can be directly evaluated
      * using only GPU.
      */
-    static constexpr bool gpu_computable = cublas_enabled && all_homogeneous<A, B>;
+    static constexpr bool gpu_computable = cublas_enabled && all_homogeneous<A, B> && !is_sparse_matrix<A> && !is_sparse_matrix<B>;
+
+    /*!
+     * \brief Indicates if the operands are directly given to the dense
+     * kernels. In that case, the transposed operands are not evaluated
+     * (the kernels use their transposed variants) and the chains of
+     * multiplications are reordered.
+     */
+    static constexpr bool fused = !Strassen && detail::plain_gemm_operand<A> && detail::plain_gemm_operand<B>;
+
+    /*!
+     * \brief Indicates if the product is the end of a chain (X * Y) * B
+     */
+    static constexpr bool left_chain = fused && detail::chain_gemm<A>;
+
+    /*!
+     * \brief Indicates if the product is the start of a chain A * (X * Y)
+     */
+    static constexpr bool right_chain = fused && !left_chain && detail::chain_gemm<B>;
 
     /*!
      * \brief Construct a new expression
@@ -156,6 +213,44 @@ struct gemm_expr : base_temporary_expr_bin<gemm_expr<A, B, Strassen>, A, B> {
         return select_default_gemm_impl<AA, BB, C>(false);
     }
 
+#endif
+
+#ifdef ETL_FIND_SELECT
+
+    /*!
+     * \brief Returns the implementations of GEMM that are timed in
+     * ETL_FIND_SELECT mode
+     *
+     * When CUBLAS would be selected, no implementation is timed and the
+     * selection is left unchanged.
+     *
+     * \return The candidate implementations
+     */
+    template <typename AA, typename BB, typename C>
+    static const std::vector<gemm_impl>& find_gemm_candidates() {
+        static const std::vector<gemm_impl> gpu_candidates;
+
+        if (select_default_gemm_impl<AA, BB, C>(local_context().cpu) == gemm_impl::CUBLAS) {
+            return gpu_candidates;
+        }
+
+        static const std::vector<gemm_impl> candidates = []() {
+            std::vector<gemm_impl> impls{gemm_impl::STD};
+
+            if (vec_enabled && vectorize_impl && all_homogeneous<AA, BB, C> && all_vectorizable_t<vector_mode, AA, BB, C>) {
+                impls.push_back(gemm_impl::VEC);
+            }
+
+            if (cblas_enabled && all_homogeneous<AA, BB, C>) {
+                impls.push_back(gemm_impl::BLAS);
+            }
+
+            return impls;
+        }();
+
+        return candidates;
+    }
+
 #endif
 
     /*!
@@ -298,6 +393,77 @@ struct gemm_expr : base_temporary_expr_bin<gemm_expr<A, B, Strassen>, A, B> {
         }
     }
 
+    /*!
+     * \brief Compute C = A * B when at least one of the operands is a
+     * sparse matrix
+     * \param a The lhs matrix
+     * \param b The rhs matrix
+     * \param c The output matrix
+     */
+    template <typename AA, typename BB, typename C>
+    static void apply_sparse(AA&& a, BB&& b, C&& c) {
+        if constexpr (is_sparse_matrix<AA> && is_sparse_matrix<BB>) {
+            // The rhs is made dense, the product is then a SpMM
+            dyn_matrix_impl<value_t<BB>, order::RowMajor, 2> t_b(etl::dim<0>(b), etl::dim<1>(b));
+            t_b = b;
+
+            apply_sparse(a, t_b, c);
+        } else if constexpr (is_sparse_matrix<AA>) {
+            decltype(auto) t_b = smart_forward(b);
+
+            using TB = decltype(t_b);
+
+            if constexpr (vec_enabled && vectorize_impl && all_homogeneous<AA, TB, C> && all_dma<TB, C> && all_row_major<TB, C>
+                          && all_vectorizable<vector_mode, TB, C>) {
+                inc_counter("impl:vec");
+                etl::impl::vec::spmm(a, t_b, c);
+            } else {
+                inc_counter("impl:std");
+                etl::impl::standard::spmm(a, t_b, c);
+            }
+        } else {
+            inc_counter("impl:std");
+            etl::impl::standard::dense_spmm(smart_forward(a), b, c);
+        }
+    }
+
+    /*!
+     * \brief Compute C = X * Y * Z in the order with the least number of
+     * operations.
+     *
+     * (X * Y) * Z costs m * k * n + m * n * p multiply-adds and X * (Y * Z)
+     * costs k * n * p + m * k * p, with X of dimensions m x k, Y of
+     * dimensions k x n and Z of dimensions n x p.
+     *
+     * \param x The X matrix
+     * \param y The Y matrix
+     * \param z The Z matrix
+     * \param c The C matrix (output)
+     */
+    template <typename X, typename Y, typename Z, typename C>
+    static void apply_chain(const X& x, const Y& y, const Z& z, C&& c) {
+        const size_t m = etl::dim<0>(x);
+        const size_t k = etl::dim<1>(x);
+        const size_t n = etl::dim<1>(y);
+        const size_t p = etl::dim<1>(z);
+
+        using tmp_type = dyn_matrix_impl<value_t<C>, decay_traits<C>::storage_order, 2>;
+
+        if (k * n * p + m * k * p < m * k * n + m * n * p) {
+            inc_counter("gemm:chain_right");
+
+            tmp_type t(k, p);
+            (y * z).assign_to(t);
+            (x * t).assign_to(c);
+        } else {
+            inc_counter("gemm:chain_left");
+
+            tmp_type t(m, n);
+            (x * y).assign_to(t);
+            (t * z).assign_to(c);
+        }
+    }
+
     /*!
      * \brief Assign to a matrix of the same storage order
      * \param c The expression to which assign
@@ -311,9 +477,36 @@ struct gemm_expr : base_temporary_expr_bin<gemm_expr<A, B, Strassen>, A, B> {
 
         check(a, b, c);
 
-        if constexpr (!Strassen) {
+        // The chains are computed as several products
+        if constexpr (left_chain) {
+            apply_chain(a.a(), a.b(), b, c);
+            return;
+        } else if constexpr (right_chain) {
+            apply_chain(a, b.a(), b.b(), c);
+            return;
+        }
+
+        profile_scope scope("gemm");
+
+        scope.shape(a, b);
+        scope.flops(2 * etl::dim<0>(a) * etl::dim<1>(a) * etl::dim<1>(b));
+        scope.bytes(sizeof(value_t<C>) * (etl::size(a) + etl::size(b) + etl::size(c)));
+
+        if constexpr (is_sparse_matrix<A> || is_sparse_matrix<B>) {
+            scope.implementation("SPARSE");
+            apply_sparse(a, b, c);
+        } else if constexpr (!Strassen && detail::structured_gemm_impl::select<A, B, C>) {
+            scope.implementation("STRUCTURED");
+            detail::structured_gemm_impl::apply(a, b, c);
+        } else if constexpr (!Strassen) {
+#ifdef ETL_FIND_SELECT
+            auto found = find_select("gemm", find_gemm_candidates<A, B, C>(), [&]() { apply_raw(a, b, c); }, a, b, c);
+#endif
+
+            scope.implementation(to_string(select_gemm_impl<A, B, C>()));
             apply_raw(a, b, c);
         } else {
+            scope.implementation("STRASSEN");
             etl::impl::standard::strassen_mm_mul(smart_forward(a), smart_forward(b), c);
         }
     }
@@ -363,6 +556,52 @@ struct gemm_expr : base_temporary_expr_bin<gemm_expr<A, B, Strassen>, A, B> {
         std_mod_evaluate(*this, lhs);
     }
 
+    // Internals
+
+    /*!
+     * \brief Apply the given visitor to an operand of the product.
+     *
+     * The transposed operands and the chains of multiplications are not
+     * evaluated, only their sub expressions.
+     *
+     * \param e The operand
+     * \param visitor The visitor to apply
+     */
+    template <typename E>
+    static void visit_operand(const E& e, detail::evaluator_visitor& visitor) {
+        if constexpr (is_transpose_expr<E>) {
+            e.a().visit(visitor);
+        } else if constexpr (detail::chain_gemm<E>) {
+            visit_operand(e.a(), visitor);
+            visit_operand(e.b(), visitor);
+        } else {
+            e.visit(visitor);
+        }
+    }
+
+    /*!
+     * \brief Apply the given visitor to this expression and its descendants.
+     * \param visitor The visitor to apply
+     */
+    void visit(detail::evaluator_visitor& visitor) const {
+        if constexpr (fused) {
+            // If the expression is already evaluated, no need to
+            // recurse through the tree
+            if (*this->evaluated) {
+                return;
+            }
+
+            this->allocate_temporary();
+
+            visit_operand(this->a(), visitor);
+            visit_operand(this->b(), visitor);
+
+            this->evaluate();
+        } else {
+            base_type::visit(visitor);
+        }
+    }
+
     /*!
      * \brief Print a representation of the expression on the given stream
      * \param os The output stream
@@ -15,6 +15,8 @@
 #include "etl/impl/vec/gemv.hpp"
 #include "etl/impl/vec/gemm_conv.hpp"
 #include "etl/impl/cublas/gemm.hpp"
+#include "etl/impl/std/spmm.hpp"
+#include "etl/impl/vec/spmm.hpp"
 
 namespace etl {
 
@@ -35,7 +37,7 @@ struct gemv_expr : base_temporary_expr_bin<gemv_expr<A, B>, A, B> {
      * \brief Indicates if the temporary expression can be directly evaluated
      * using only GPU.
      */
-    static constexpr bool gpu_computable = cublas_enabled && all_homogeneous<A, B>;
+    static constexpr bool gpu_computable = cublas_enabled && all_homogeneous<A, B> && !is_sparse_matrix<A>;
 
     /*!
      * \brief Construct a new expression
@@ -234,7 +236,21 @@ struct gemv_expr : base_temporary_expr_bin<gemv_expr<A, B>, A, B> {
 
         check(this->a(), this->b(), c);
 
-        apply_raw(this->a(), this->b(), c);
+        if constexpr (is_sparse_matrix<A>) {
+            decltype(auto) t_b = smart_forward(this->b());
+
+            using TB = decltype(t_b);
+
+            if constexpr (vec_enabled && vectorize_impl && all_homogeneous<A, TB, C> && all_floating<A, TB, C> && all_dma<TB, C>) {
+                inc_counter("impl:vec");
+                etl::impl::vec::spmv(this->a(), t_b, c);
+            } else {
+                inc_counter("impl:std");
+                etl::impl::standard::spmv(this->a(), t_b, c);
+            }
+        } else {
+            apply_raw(this->a(), this->b(), c);
+        }
     }
 
     /*!
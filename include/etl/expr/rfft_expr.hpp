@@ -0,0 +1,333 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+namespace etl {
+
+/*!
+ * \brief A real Fast-Fourrier-Transform expression.
+ *
+ * Contrary to fft_expr, the last dimension of the expression is not
+ * the same as the one of its sub expression: only half the spectrum
+ * of a real signal is stored (the other half being given by
+ * Hermitian symmetry).
+ *
+ * \tparam A The sub type
+ * \tparam T The value type
+ * \tparam Impl The implementation functor
+ */
+template <typename A, typename T, typename Impl>
+struct rfft_expr : base_temporary_expr_un<rfft_expr<A, T, Impl>, A> {
+    using value_type = T;                                    ///< The type of value of the expression
+    using this_type  = rfft_expr<A, T, Impl>;                ///< The type of this expression
+    using base_type  = base_temporary_expr_un<this_type, A>; ///< The base type
+    using sub_traits = decay_traits<A>;                      ///< The traits of the sub type
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The sub expression
+     */
+    explicit rfft_expr(A a) : base_type(a) {
+        //Nothing else to init
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param c The expression to which assign
+     */
+    template <typename C>
+    void assign_to(C&& c) const {
+        static_assert(all_etl_expr<A, C>, "rfft only supported for ETL expressions");
+        static_assert(etl::dimensions<A>() == etl::dimensions<C>(), "rfft must be applied on matrices of same dimensionality");
+
+        Impl::apply(this->a(), c);
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const rfft_expr& expr) {
+        return os << "rfft(" << expr._a << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a real FFT expression
+ * \tparam A The sub type
+ */
+template <typename A, typename T, typename Impl>
+struct etl_traits<etl::rfft_expr<A, T, Impl>> {
+    using expr_t     = etl::rfft_expr<A, T, Impl>; ///< The expression type
+    using sub_expr_t = std::decay_t<A>;            ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;     ///< The sub traits
+    using value_type = T;                          ///< The value type of the expression
+
+    static constexpr size_t D = sub_traits::dimensions(); ///< The number of dimensions of this expressions
+
+    static constexpr bool is_etl         = true;                      ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                     ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                     ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                     ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = sub_traits::is_fast;       ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                     ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                      ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                     ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                      ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                     ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                     ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                      ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                      ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                     ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = sub_traits::storage_order; ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return DD == D - 1 ? Impl::dim(decay_traits<A>::template dim<DD>()) : decay_traits<A>::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        return d == D - 1 ? Impl::dim(etl::dim(e._a, d)) : etl::dim(e._a, d);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return (sub_traits::size(e._a) / etl::dim(e._a, D - 1)) * dim(e, D - 1);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return (sub_traits::size() / sub_traits::template dim<D - 1>()) * dim<D - 1>();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return D;
+    }
+};
+
+//Helpers to compute the type of the result
+
+namespace detail {
+
+/*!
+ * \brief The output value type of a real FFT based on the input
+ */
+template <typename A>
+using rfft_value_type = std::complex<value_t<A>>;
+
+/*!
+ * \brief The output value type of a real Inverse FFT based on the input
+ */
+template <typename A>
+using irfft_value_type = typename value_t<A>::value_type;
+
+} //end of namespace detail
+
+/*!
+ * \brief Creates an expression representing the 1D real Fast-Fourrier-Transform of the given expression
+ *
+ * Only the N / 2 + 1 first coefficients of the transform are computed.
+ *
+ * \param a The input expression
+ * \return an expression representing the 1D real FFT of a
+ */
+template <typename A>
+rfft_expr<detail::build_type<A>, detail::rfft_value_type<A>, detail::rfft1_impl> rfft_1d(A&& a) {
+    static_assert(is_etl_expr<A>, "FFT only supported for ETL expressions");
+    static_assert(is_floating<A>, "rfft only supported for real expressions");
+    static_assert(decay_traits<A>::dimensions() == 1, "rfft_1d requires 1D vectors");
+
+    return rfft_expr<detail::build_type<A>, detail::rfft_value_type<A>, detail::rfft1_impl>{a};
+}
+
+/*!
+ * \brief Creates an expression representing the 1D real Inverse Fast-Fourrier-Transform of the given expression.
+ *
+ * The input contains the M first coefficients of the transform of a
+ * real signal of size 2 * (M - 1).
+ *
+ * \param a The input expression
+ * \return an expression representing the 1D real inverse FFT of a
+ */
+template <typename A>
+rfft_expr<detail::build_type<A>, detail::irfft_value_type<A>, detail::irfft1_impl> irfft_1d(A&& a) {
+    static_assert(is_etl_expr<A>, "FFT only supported for ETL expressions");
+    static_assert(is_complex<A>, "irfft only supported for complex expressions");
+    static_assert(decay_traits<A>::dimensions() == 1, "irfft_1d requires 1D vectors");
+
+    return rfft_expr<detail::build_type<A>, detail::irfft_value_type<A>, detail::irfft1_impl>{a};
+}
+
+/*!
+ * \brief Computes the 1D real Inverse Fast-Fourrier-Transform of the given expression, the result will be stored in c
+ *
+ * The size of the transform is given by the size of c, this makes it
+ * possible to invert the transform of odd-sized signals.
+ *
+ * \param a The input expression
+ * \param c The result
+ * \return c
+ */
+template <typename A, typename C>
+decltype(auto) irfft_1d(A&& a, C&& c) {
+    static_assert(all_etl_expr<A, C>, "FFT only supported for ETL expressions");
+    static_assert(is_complex<A>, "irfft only supported for complex expressions");
+    static_assert(is_dma<C>, "irfft_1d(a, c) requires a direct output");
+    static_assert(decay_traits<A>::dimensions() == 1 && decay_traits<C>::dimensions() == 1, "irfft_1d requires 1D vectors");
+    cpp_assert(etl::size(c) / 2 + 1 == etl::size(a), "Invalid size for irfft_1d");
+
+    detail::irfft1_impl::apply(a, c);
+    return std::forward<C>(c);
+}
+
+/*!
+ * \brief Creates an expression representing the 2D real Fast-Fourrier-Transform of the given expression
+ *
+ * Only the N2 / 2 + 1 first columns of the transform are computed.
+ *
+ * \param a The input expression
+ * \return an expression representing the 2D real FFT of a
+ */
+template <typename A>
+rfft_expr<detail::build_type<A>, detail::rfft_value_type<A>, detail::rfft2_impl> rfft_2d(A&& a) {
+    static_assert(is_etl_expr<A>, "FFT only supported for ETL expressions");
+    static_assert(is_floating<A>, "rfft only supported for real expressions");
+    static_assert(decay_traits<A>::dimensions() == 2, "rfft_2d requires 2D matrices");
+
+    return rfft_expr<detail::build_type<A>, detail::rfft_value_type<A>, detail::rfft2_impl>{a};
+}
+
+/*!
+ * \brief Creates an expression representing the 2D real Inverse Fast-Fourrier-Transform of the given expression.
+ *
+ * The input contains the M2 first columns of the transform of a
+ * real matrix of M1 * 2 * (M2 - 1).
+ *
+ * \param a The input expression
+ * \return an expression representing the 2D real inverse FFT of a
+ */
+template <typename A>
+rfft_expr<detail::build_type<A>, detail::irfft_value_type<A>, detail::irfft2_impl> irfft_2d(A&& a) {
+    static_assert(is_etl_expr<A>, "FFT only supported for ETL expressions");
+    static_assert(is_complex<A>, "irfft only supported for complex expressions");
+    static_assert(decay_traits<A>::dimensions() == 2, "irfft_2d requires 2D matrices");
+
+    return rfft_expr<detail::build_type<A>, detail::irfft_value_type<A>, detail::irfft2_impl>{a};
+}
+
+/*!
+ * \brief Computes the 2D real Inverse Fast-Fourrier-Transform of the given expression, the result will be stored in c
+ *
+ * The size of the transform is given by the dimensions of c, this
+ * makes it possible to invert the transform of odd-sized matrices.
+ *
+ * \param a The input expression
+ * \param c The result
+ * \return c
+ */
+template <typename A, typename C>
+decltype(auto) irfft_2d(A&& a, C&& c) {
+    static_assert(all_etl_expr<A, C>, "FFT only supported for ETL expressions");
+    static_assert(is_complex<A>, "irfft only supported for complex expressions");
+    static_assert(is_dma<C>, "irfft_2d(a, c) requires a direct output");
+    static_assert(decay_traits<A>::dimensions() == 2 && decay_traits<C>::dimensions() == 2, "irfft_2d requires 2D matrices");
+    cpp_assert(etl::dim<0>(c) == etl::dim<0>(a) && etl::dim<1>(c) / 2 + 1 == etl::dim<1>(a), "Invalid dimensions for irfft_2d");
+
+    detail::irfft2_impl::apply(a, c);
+    return std::forward<C>(c);
+}
+
+} //end of namespace etl
@@ -0,0 +1,290 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+//Get the implementations
+#include "etl/impl/solve.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing the solution of a linear system
+ * \tparam A The type of the matrix of the system
+ * \tparam B The type of the right-hand sides
+ * \tparam Mode The structure assumed for the matrix
+ */
+template <typename A, typename B, detail::solve_mode Mode>
+struct solve_expr : base_temporary_expr_bin<solve_expr<A, B, Mode>, A, B> {
+    using value_type = value_t<A>;                               ///< The type of value of the expression
+    using this_type  = solve_expr<A, B, Mode>;                   ///< The type of this expression
+    using base_type  = base_temporary_expr_bin<this_type, A, B>; ///< The base type
+    using sub_traits = decay_traits<B>;                          ///< The traits of the right-hand sides
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The matrix of the system
+     * \param b The right-hand sides
+     */
+    explicit solve_expr(A a, B b) : base_type(a, b) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the dimensions of the system
+     * \param a The matrix of the system
+     * \param b The right-hand sides
+     * \param c The solution
+     */
+    template <typename C>
+    static void check([[maybe_unused]] const A& a, [[maybe_unused]] const B& b, [[maybe_unused]] const C& c) {
+        static_assert(etl::dimensions<A>() == 2, "The matrix of solve must be a 2d matrix");
+        static_assert(etl::dimensions<B>() == etl::dimensions<C>(), "The solution of solve must have the dimensions of the right-hand sides");
+
+        if constexpr (all_fast<A, B, C>) {
+            static_assert(etl::dim<0, A>() == etl::dim<1, A>(), "The matrix of solve must be square");
+            static_assert(etl::dim<0, A>() == etl::dim<0, B>(), "Invalid dimensions for solve");
+            static_assert(decay_traits<B>::size() == decay_traits<C>::size(), "Invalid dimensions for solve");
+        } else {
+            cpp_assert(etl::dim<0>(a) == etl::dim<1>(a), "The matrix of solve must be square");
+            cpp_assert(etl::dim<0>(a) == etl::dim<0>(b), "Invalid dimensions for solve");
+            cpp_assert(etl::size(b) == etl::size(c), "Invalid dimensions for solve");
+        }
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param c The expression to which assign
+     */
+    template <typename C>
+    void assign_to(C&& c) const {
+        static_assert(all_etl_expr<A, B, C>, "solve only supported for ETL expressions");
+        static_assert(all_row_major<A, B, C>, "solve only supported for row-major matrices");
+
+        auto& a = this->a();
+        auto& b = this->b();
+
+        check(a, b, c);
+
+        detail::solve_impl::apply<Mode>(smart_forward(a), smart_forward(b), c);
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const solve_expr& expr) {
+        return os << "solve(" << expr._a << ", " << expr._b << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a solve expression
+ * \tparam A The type of the matrix of the system
+ * \tparam B The type of the right-hand sides
+ * \tparam Mode The structure assumed for the matrix
+ */
+template <typename A, typename B, detail::solve_mode Mode>
+struct etl_traits<etl::solve_expr<A, B, Mode>> {
+    using expr_t     = etl::solve_expr<A, B, Mode>; ///< The expression type
+    using sub_expr_t = std::decay_t<B>;             ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;      ///< The sub traits
+    using value_type = value_t<A>;                  ///< The value type of the expression
+
+    static constexpr size_t D = sub_traits::dimensions(); ///< The number of dimensions of this expressions
+
+    static constexpr bool is_etl         = true;                                   ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                                  ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                                  ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                                  ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = sub_traits::is_fast;                    ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                                  ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                                   ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                                  ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                                   ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                                  ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                                  ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                                   ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                                   ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                                  ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = sub_traits::storage_order;              ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return sub_traits::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        return sub_traits::dim(e._b, d);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return sub_traits::size(e._b);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return sub_traits::size();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return D;
+    }
+};
+
+/*!
+ * \brief Creates an expression representing the solution X of the
+ * linear system A * X = B.
+ *
+ * Lower and upper triangular adapters are solved by substitution,
+ * symmetric adapters through their Cholesky decomposition and the other
+ * matrices through their LU decomposition with partial pivoting.
+ *
+ * \param a The square matrix of the system
+ * \param b The right-hand sides, a vector or a matrix with one
+ * right-hand side per column
+ * \return an expression representing the solution of the system
+ */
+template <typename A, typename B>
+solve_expr<detail::build_type<A>, detail::build_type<B>, detail::solve_mode::general> solve(const A& a, const B& b) {
+    static_assert(all_etl_expr<A, B>, "etl::solve can only be used on ETL expressions");
+    static_assert(is_2d<A>, "etl::solve is only defined for 2d matrices");
+    static_assert(is_floating<A>, "etl::solve is only supported for floating point matrices");
+
+    return solve_expr<detail::build_type<A>, detail::build_type<B>, detail::solve_mode::general>{a, b};
+}
+
+/*!
+ * \brief Creates an expression representing the solution X of the
+ * linear system L * X = B, with L lower triangular.
+ *
+ * Only the lower part of the matrix is read.
+ *
+ * \param a The square lower triangular matrix of the system
+ * \param b The right-hand sides, a vector or a matrix with one
+ * right-hand side per column
+ * \return an expression representing the solution of the system
+ */
+template <typename A, typename B>
+solve_expr<detail::build_type<A>, detail::build_type<B>, detail::solve_mode::lower> solve_lower(const A& a, const B& b) {
+    static_assert(all_etl_expr<A, B>, "etl::solve_lower can only be used on ETL expressions");
+    static_assert(is_2d<A>, "etl::solve_lower is only defined for 2d matrices");
+    static_assert(is_floating<A>, "etl::solve_lower is only supported for floating point matrices");
+
+    return solve_expr<detail::build_type<A>, detail::build_type<B>, detail::solve_mode::lower>{a, b};
+}
+
+/*!
+ * \brief Creates an expression representing the solution X of the
+ * linear system U * X = B, with U upper triangular.
+ *
+ * Only the upper part of the matrix is read.
+ *
+ * \param a The square upper triangular matrix of the system
+ * \param b The right-hand sides, a vector or a matrix with one
+ * right-hand side per column
+ * \return an expression representing the solution of the system
+ */
+template <typename A, typename B>
+solve_expr<detail::build_type<A>, detail::build_type<B>, detail::solve_mode::upper> solve_upper(const A& a, const B& b) {
+    static_assert(all_etl_expr<A, B>, "etl::solve_upper can only be used on ETL expressions");
+    static_assert(is_2d<A>, "etl::solve_upper is only defined for 2d matrices");
+    static_assert(is_floating<A>, "etl::solve_upper is only supported for floating point matrices");
+
+    return solve_expr<detail::build_type<A>, detail::build_type<B>, detail::solve_mode::upper>{a, b};
+}
+
+} //end of namespace etl
@@ -70,6 +70,8 @@ public:
      */
     template <typename L>
     void assign_to(L&& lhs) const {
+        profile_scope scope("timed(=)");
+
         auto start_time = etl::timer_clock::now();
 
         value.assign_to(lhs);
@@ -86,6 +88,8 @@ public:
      */
     template <typename L>
     void assign_add_to(L&& lhs) const {
+        profile_scope scope("timed(+=)");
+
         auto start_time = etl::timer_clock::now();
 
         value.assign_add_to(lhs);
@@ -102,6 +106,8 @@ public:
      */
     template <typename L>
     void assign_sub_to(L&& lhs) const {
+        profile_scope scope("timed(-=)");
+
         auto start_time = etl::timer_clock::now();
 
         value.assign_sub_to(lhs);
@@ -118,6 +124,8 @@ public:
      */
     template <typename L>
     void assign_mul_to(L&& lhs) const {
+        profile_scope scope("timed(*=)");
+
         auto start_time = etl::timer_clock::now();
 
         value.assign_mul_to(lhs);
@@ -134,6 +142,8 @@ public:
      */
     template <typename L>
     void assign_div_to(L&& lhs) const {
+        profile_scope scope("timed(/=)");
+
         auto start_time = etl::timer_clock::now();
 
         value.assign_div_to(lhs);
@@ -150,6 +160,8 @@ public:
      */
     template <typename L>
     void assign_mod_to(L&& lhs) const {
+        profile_scope scope("timed(%=)");
+
         auto start_time = etl::timer_clock::now();
 
         value.assign_mod_to(lhs);
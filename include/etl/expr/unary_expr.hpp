@@ -202,6 +202,24 @@ public:
         return value.alias(rhs);
     }
 
+    /*!
+     * \brief Test if this expression computes the same values as the given
+     * expression.
+     *
+     * This is only detected when both expressions refer to the same sub
+     * expression object.
+     *
+     * \param rhs The other expression to test
+     * \return true if the two expressions are known to compute the same values, false otherwise
+     */
+    bool same_as(const unary_expr& rhs) const noexcept {
+        if constexpr (std::is_lvalue_reference_v<Expr>) {
+            return &value == &rhs.value;
+        } else {
+            return false;
+        }
+    }
+
     /*!
      * \brief Return a GPU computed version of this expression
      * \return a GPU-computed ETL expression for this expression
@@ -454,9 +454,9 @@ void swap(fast_matrix_impl<T, ST, SO, Dims...>& lhs, fast_matrix_impl<T, ST, SO,
  */
 template <typename Stream, typename T, typename ST, order SO, size_t... Dims>
 void serialize(serializer<Stream>& os, const fast_matrix_impl<T, ST, SO, Dims...>& matrix) {
-    for (const auto& value : matrix) {
-        os << value;
-    }
+    matrix.ensure_cpu_up_to_date();
+
+    os.write(matrix.memory_start(), etl::size(matrix));
 }
 
 /*!
@@ -466,9 +466,10 @@ void serialize(serializer<Stream>& os, const fast_matrix_impl<T, ST, SO, Dims...
  */
 template <typename Stream, typename T, typename ST, order SO, size_t... Dims>
 void deserialize(deserializer<Stream>& os, fast_matrix_impl<T, ST, SO, Dims...>& matrix) {
-    for (auto& value : matrix) {
-        os >> value;
-    }
+    os.read(matrix.memory_start(), etl::size(matrix));
+
+    matrix.validate_cpu();
+    matrix.invalidate_gpu();
 }
 
 } //end of namespace etl
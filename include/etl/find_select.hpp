@@ -0,0 +1,238 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Benchmark-on-first-use selection of the implementations
+ * (ETL_FIND_SELECT).
+ *
+ * The first time an operation is evaluated with a given type of operands
+ * and given dimensions, each of its eligible implementations is timed
+ * and the fastest one is kept in a cache. The following evaluations with
+ * the same key directly use the cached implementation.
+ *
+ * The selected implementation is applied by forcing the selector of the
+ * local context, as in ETL_MANUAL_SELECT (which is implied by this mode).
+ * An implementation forced by the user always takes precedence.
+ *
+ * This covers gemm, the 4D valid convolutions, the multi 2D valid
+ * convolutions and the 1D and 2D FFTs (and their inverses). Pooling is
+ * not covered, its only alternative to STD is CUDNN.
+ *
+ * Only the CPU implementations are timed. When the default selection is a
+ * GPU implementation (CUBLAS, CUDNN or CUFFT), the selection is left
+ * unchanged.
+ */
+
+#pragma once
+
+#ifdef ETL_FIND_SELECT
+
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
+namespace etl {
+
+/*!
+ * \brief The number of timed runs of each implementation, the fastest
+ * run is kept
+ */
+constexpr size_t find_select_runs = 2;
+
+/*!
+ * \brief The key of a cached selection
+ */
+struct find_select_key {
+    const char* op;           ///< The name of the operation
+    std::type_index type;     ///< The type of the operands
+    std::vector<size_t> dims; ///< The dimensions of the operands
+
+    /*!
+     * \brief Compare two keys for equality
+     */
+    bool operator==(const find_select_key& rhs) const {
+        return type == rhs.type && dims == rhs.dims && !std::strcmp(op, rhs.op);
+    }
+};
+
+/*!
+ * \brief The hash of a selection key
+ */
+struct find_select_hash {
+    /*!
+     * \brief Compute the hash of the given key
+     */
+    size_t operator()(const find_select_key& key) const {
+        size_t seed = key.type.hash_code();
+
+        for (const char* c = key.op; *c; ++c) {
+            seed = seed * 31 + size_t(*c);
+        }
+
+        for (auto d : key.dims) {
+            seed ^= d + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        }
+
+        return seed;
+    }
+};
+
+/*!
+ * \brief The cache of the selected implementations
+ */
+struct find_select_cache {
+    std::unordered_map<find_select_key, size_t, find_select_hash> selected; ///< The index of the selected implementation of each key
+    std::mutex lock;                                                        ///< The lock protecting the cache
+};
+
+/*!
+ * \brief Returns the global cache of the selected implementations
+ */
+inline find_select_cache& get_find_select_cache() {
+    static find_select_cache cache;
+    return cache;
+}
+
+/*!
+ * \brief Clear the cache of the selected implementations
+ */
+inline void reset_find_select() {
+    auto& cache = get_find_select_cache();
+
+    std::lock_guard<std::mutex> l(cache.lock);
+    cache.selected.clear();
+}
+
+/*!
+ * \brief Returns the number of cached selections
+ */
+inline size_t find_select_size() {
+    auto& cache = get_find_select_cache();
+
+    std::lock_guard<std::mutex> l(cache.lock);
+    return cache.selected.size();
+}
+
+/*!
+ * \brief RAII helper forcing the selector of the local context to the
+ * found implementation
+ */
+template <typename Impl>
+struct find_select_context {
+    forced_impl<Impl> old_selector; ///< The previous value of the selector
+    bool active = false;            ///< Indicates if the selector is forced by this context
+
+    find_select_context() = default;
+
+    /*!
+     * \brief Force the selector to the given implementation
+     * \param impl The implementation to use
+     */
+    explicit find_select_context(Impl impl) : old_selector(detail::get_forced_impl<Impl>()), active(true) {
+        auto& selector = detail::get_forced_impl<Impl>();
+
+        selector.impl   = impl;
+        selector.forced = true;
+    }
+
+    find_select_context(const find_select_context& rhs) = delete;
+    find_select_context& operator=(const find_select_context& rhs) = delete;
+
+    /*!
+     * \brief Restore the selector
+     */
+    ~find_select_context() {
+        if (active) {
+            detail::get_forced_impl<Impl>() = old_selector;
+        }
+    }
+};
+
+/*!
+ * \brief Find the fastest implementation of an operation for the given
+ * operands.
+ *
+ * If the key is not yet in the cache, the functor is run with each of
+ * the candidates forced and the fastest is stored. The returned context
+ * forces the found implementation until its destruction.
+ *
+ * \param op The name of the operation (a string literal)
+ * \param candidates The eligible implementations
+ * \param functor The functor running the operation with the forced implementation
+ * \param exprs The operands of the operation (their type and dimensions are the key)
+ *
+ * \return a context forcing the found implementation, inactive if the
+ * implementation is already forced or if there is a single candidate
+ */
+template <typename Impl, typename Functor, typename... E>
+find_select_context<Impl> find_select(const char* op, const std::vector<Impl>& candidates, Functor&& functor, const E&... exprs) {
+    if (detail::get_forced_impl<Impl>().forced || candidates.size() < 2) {
+        return find_select_context<Impl>();
+    }
+
+    find_select_key key{op, std::type_index(typeid(std::tuple<std::decay_t<E>...>)), {}};
+
+    auto add_dims = [&key](const auto& expr) {
+        for (size_t d = 0; d < dimensions(expr); ++d) {
+            key.dims.push_back(dim(expr, d));
+        }
+    };
+
+    (add_dims(exprs), ...);
+
+    auto& cache = get_find_select_cache();
+
+    {
+        std::lock_guard<std::mutex> l(cache.lock);
+
+        auto it = cache.selected.find(key);
+
+        if (it != cache.selected.end()) {
+            return find_select_context<Impl>(candidates[it->second]);
+        }
+    }
+
+    // Time each candidate, without holding the lock since the operation
+    // may itself need to find its implementations
+
+    size_t best      = 0;
+    double best_time = std::numeric_limits<double>::max();
+
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        find_select_context<Impl> forced(candidates[i]);
+
+        for (size_t r = 0; r < find_select_runs; ++r) {
+            auto start = std::chrono::steady_clock::now();
+
+            functor();
+
+            const double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            if (time < best_time) {
+                best      = i;
+                best_time = time;
+            } else if (time > 2.0 * best_time) {
+                // Do not insist on a clearly slower implementation
+                break;
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> l(cache.lock);
+        cache.selected.emplace(std::move(key), best);
+    }
+
+    return find_select_context<Impl>(candidates[best]);
+}
+
+} //end of namespace etl
+
+#endif
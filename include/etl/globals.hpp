@@ -591,7 +591,8 @@ value_t<E> determinant(E&& expr) {
  * \param L The L matrix (Lower Diagonal)
  * \param U The U matrix (Upper Diagonal)
  * \param P The P matrix (Pivot Permutation Matrix)
- * \return true if the decomposition suceeded, false otherwise
+ * \return true if the decomposition suceeded, false if the matrices are
+ * not square or not of the same dimension
  */
 template <typename AT, typename LT, typename UT, typename PT>
 bool lu(const AT& A, LT& L, UT& U, PT& P) {
@@ -602,7 +603,7 @@ bool lu(const AT& A, LT& L, UT& U, PT& P) {
 
     // All matrices must be of the same dimension
     if (etl::dim(A, 0) != etl::dim(L, 0) || etl::dim(A, 0) != etl::dim(U, 0) || etl::dim(A, 0) != etl::dim(P, 0)) {
-        return true;
+        return false;
     }
 
     detail::lu_impl::apply(A, L, U, P);
@@ -610,6 +611,131 @@ bool lu(const AT& A, LT& L, UT& U, PT& P) {
     return true;
 }
 
+/*!
+ * \brief Compact decomposition of the matrix so that P * A = L * U
+ *
+ * The strict lower part of LU contains L (whose diagonal is implicitly
+ * one) and its upper part contains U. At the step i, the row i was
+ * exchanged with the row pivots[i].
+ *
+ * \param A The A matrix
+ * \param LU The compact L and U matrices
+ * \param pivots The pivot indices
+ * \return true if the decomposition suceeded, false if the matrices are
+ * not square or if A is singular
+ */
+template <typename AT, typename LUT>
+bool lu(const AT& A, LUT& LU, std::vector<size_t>& pivots) {
+    static_assert(detail::blocked_decomposition<AT>, "The compact LU decomposition is only supported for floating point matrices");
+
+    // All matrices must be square and of the same dimension
+    if (!is_square(A) || !is_square(LU) || etl::dim(A, 0) != etl::dim(LU, 0)) {
+        return false;
+    }
+
+    return detail::lu_impl::apply(A, LU, pivots);
+}
+
+/*!
+ * \brief Cholesky decomposition of the symmetric positive definite
+ * matrix so that A = L * L^T
+ *
+ * Only the lower part of A is read.
+ *
+ * \param A The A matrix
+ * \param L The L matrix (Lower Triangular)
+ * \return true if the decomposition suceeded, false if the matrices are
+ * not square or if A is not positive definite
+ */
+template <typename AT, typename LT>
+bool cholesky(const AT& A, LT& L) {
+    static_assert(detail::blocked_decomposition<AT>, "The Cholesky decomposition is only supported for floating point matrices");
+
+    // All matrices must be square and of the same dimension
+    if (!is_square(A) || !is_square(L) || etl::dim(A, 0) != etl::dim(L, 0)) {
+        return false;
+    }
+
+    return detail::cholesky_impl::apply(A, L);
+}
+
+/*!
+ * \brief Eigendecomposition of the symmetric matrix so that
+ * A = V * diag(values) * V^T
+ *
+ * Only the lower part of A is read.
+ *
+ * \param A The A matrix (n x n)
+ * \param values The eigenvalues in ascending order (n)
+ * \param vectors The V matrix, with one eigenvector per column (n x n)
+ * \return true if the decomposition suceeded, false if the matrices do not
+ * have compatible dimensions or if the algorithm did not converge
+ */
+template <typename AT, typename ET, typename VT>
+bool eigen_sym(const AT& A, ET& values, VT& vectors) {
+    static_assert(detail::blocked_decomposition<AT>, "The symmetric eigendecomposition is only supported for floating point matrices");
+
+    if (!is_square(A) || !is_square(vectors) || etl::dim(A, 0) != etl::dim(vectors, 0) || etl::size(values) != etl::dim(A, 0)) {
+        return false;
+    }
+
+    return detail::eigen_sym_impl::apply(A, values, vectors);
+}
+
+/*!
+ * \brief Truncated singular value decomposition so that
+ * A ~ U * diag(s) * V^T, computed with a randomized range finder.
+ *
+ * The number of singular values computed is the size of s.
+ *
+ * \param A The A matrix (m x n)
+ * \param U The left singular vectors (m x k)
+ * \param s The largest singular values in descending order (k)
+ * \param V The right singular vectors (n x k)
+ * \param g The random generator
+ * \return true if the decomposition suceeded, false if the matrices do not
+ * have compatible dimensions or if the algorithm did not converge
+ */
+template <typename AT, typename UT, typename ST, typename VT, typename G>
+bool svd(const AT& A, UT& U, ST& s, VT& V, G&& g) {
+    static_assert(detail::blocked_decomposition<AT>, "The SVD is only supported for floating point matrices");
+
+    const size_t k = etl::size(s);
+
+    if (!k || k > std::min(etl::dim(A, 0), etl::dim(A, 1))) {
+        return false;
+    }
+
+    if (etl::dim(U, 0) != etl::dim(A, 0) || etl::dim(U, 1) != k || etl::dim(V, 0) != etl::dim(A, 1) || etl::dim(V, 1) != k) {
+        return false;
+    }
+
+    return detail::svd_impl::apply(A, U, s, V, g);
+}
+
+/*!
+ * \brief Truncated singular value decomposition so that
+ * A ~ U * diag(s) * V^T, computed with a randomized range finder.
+ *
+ * The number of singular values computed is the size of s. The random
+ * engine is seeded at each call, so that several decompositions can run
+ * concurrently.
+ *
+ * \param A The A matrix (m x n)
+ * \param U The left singular vectors (m x k)
+ * \param s The largest singular values in descending order (k)
+ * \param V The right singular vectors (n x k)
+ * \return true if the decomposition suceeded, false if the matrices do not
+ * have compatible dimensions or if the algorithm did not converge
+ */
+template <typename AT, typename UT, typename ST, typename VT>
+bool svd(const AT& A, UT& U, ST& s, VT& V) {
+    std::random_device rd;
+    etl::random_engine g(rd());
+
+    return svd(A, U, s, V, g);
+}
+
 /*!
  * \brief Decomposition the matrix so that A = Q * R
  * \param A The A matrix (mxn)
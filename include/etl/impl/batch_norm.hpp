@@ -0,0 +1,189 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the batch normalization kernels.
+ *
+ * The statistics are computed in parallel over the channels and the
+ * normalization in parallel over the rows (2D) or the (batch, channel)
+ * blocks (4D). The contiguous axis is vectorized.
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/std/batch_norm.hpp"
+#include "etl/impl/vec/batch_norm.hpp"
+
+namespace etl::detail {
+
+/*!
+ * \brief Batch normalization implementation
+ */
+struct batch_norm_impl {
+    /*!
+     * \brief The number of channels given at once to a thread, a
+     * multiple of every vector size so that the threads never write the
+     * same cache line.
+     */
+    static constexpr size_t channel_group = 16;
+
+    /*!
+     * \brief Indicates if the vectorized kernels can be used for the given expressions
+     */
+    template <typename... E>
+    static constexpr bool vectorized = vec_enabled && all_vectorizable<vector_mode, E...> && all_floating<E...>;
+
+    /*!
+     * \brief Dispatch groups of channels in parallel
+     * \param functor The functor to call with a range of channels
+     * \param K The number of channels
+     * \param work The total number of elements to process
+     */
+    template <typename Functor>
+    static void dispatch_channels(Functor&& functor, size_t K, size_t work) {
+        const size_t groups = (K + channel_group - 1) / channel_group;
+
+        auto batch_fun = [&](size_t first, size_t last) { functor(first * channel_group, std::min(last * channel_group, K)); };
+
+        engine_dispatch_1d_serial(batch_fun, 0, groups, engine_select_parallel(work, tuning().parallel_threshold) && groups > 1);
+    }
+
+    /*!
+     * \brief Compute the sum over the batch of each column of a 2D
+     * input, or the sum of the squared deviations from shift if Squared
+     * is true.
+     * \param input The input (N x K)
+     * \param shift The values subtracted from each column (K)
+     * \param output The output (K)
+     */
+    template <bool Squared, typename I, typename B, typename O>
+    static void batch_sum_2d(const I& input, const B& shift, O& output) {
+        const size_t K = etl::dim<1>(input);
+
+        auto functor = [&](size_t first, size_t last) {
+            if constexpr (vectorized<I, B, O>) {
+                impl::vec::batch_sum_2d<default_vec, Squared>(input, shift, output, first, last);
+            } else {
+                impl::standard::batch_sum_2d<Squared>(input, shift, output, first, last);
+            }
+        };
+
+        dispatch_channels(functor, K, etl::size(input));
+    }
+
+    /*!
+     * \brief Compute the mean and the (biased) variance of each channel
+     * of the input, in a single pass.
+     * \param input The input (N x K or N x K x H x W)
+     * \param mean The output mean (K)
+     * \param var The output variance (K)
+     */
+    template <typename I, typename M, typename V>
+    static void stats(const I& input, M& mean, V& var) {
+        etl::force(input);
+        safe_ensure_cpu_up_to_date(input);
+
+        const size_t K = etl::dim<1>(input);
+
+        auto functor = [&](size_t first, size_t last) {
+            if constexpr (decay_traits<I>::dimensions() == 2) {
+                if constexpr (vectorized<I, M, V>) {
+                    impl::vec::batch_norm_stats_2d<default_vec>(input, mean, var, first, last);
+                } else {
+                    impl::standard::batch_norm_stats_2d(input, mean, var, first, last);
+                }
+            } else {
+                if constexpr (vectorized<I, M, V>) {
+                    impl::vec::batch_norm_stats_4d<default_vec>(input, mean, var, first, last);
+                } else {
+                    impl::standard::batch_norm_stats_4d(input, mean, var, first, last);
+                }
+            }
+        };
+
+        dispatch_channels(functor, K, etl::size(input));
+
+        mean.validate_cpu();
+        mean.invalidate_gpu();
+        var.validate_cpu();
+        var.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Normalize the input with the given statistics, scale and
+     * shift, in a single read-write pass.
+     *
+     * output = gamma * (input - mean) / sqrt(var + epsilon) + beta
+     *
+     * \param input The input (N x K or N x K x H x W)
+     * \param mean The mean of each channel (K)
+     * \param var The variance of each channel (K)
+     * \param gamma The scale of each channel (K)
+     * \param beta The shift of each channel (K)
+     * \param output The output (same dimensions as the input, can be the input)
+     * \param epsilon The value added to the variance
+     */
+    template <typename I, typename M, typename V, typename G, typename B, typename O>
+    static void apply(const I& input, const M& mean, const V& var, const G& gamma, const B& beta, O& output, value_t<I> epsilon) {
+        using T = value_t<I>;
+
+        etl::force(input);
+        etl::force(mean);
+        etl::force(var);
+        etl::force(gamma);
+        etl::force(beta);
+
+        safe_ensure_cpu_up_to_date(input);
+        safe_ensure_cpu_up_to_date(mean);
+        safe_ensure_cpu_up_to_date(var);
+        safe_ensure_cpu_up_to_date(gamma);
+        safe_ensure_cpu_up_to_date(beta);
+
+        const size_t N = etl::dim<0>(input);
+        const size_t K = etl::dim<1>(input);
+
+        // The normalization is folded in a single scale and shift per channel
+        etl::dyn_vector<T> scale(K);
+        etl::dyn_vector<T> shift(K);
+
+        for (size_t k = 0; k < K; ++k) {
+            using std::sqrt;
+
+            scale[k] = gamma[k] / sqrt(var[k] + epsilon);
+            shift[k] = beta[k] - mean[k] * scale[k];
+        }
+
+        if constexpr (decay_traits<I>::dimensions() == 2) {
+            auto batch_fun = [&](size_t first, size_t last) {
+                if constexpr (vectorized<I, O>) {
+                    impl::vec::batch_norm_apply_2d<default_vec>(input, scale, shift, output, first, last);
+                } else {
+                    impl::standard::batch_norm_apply_2d(input, scale, shift, output, first, last);
+                }
+            };
+
+            engine_dispatch_1d_serial(batch_fun, 0, N, engine_select_parallel(etl::size(input), tuning().parallel_threshold) && N > 1);
+        } else {
+            auto batch_fun = [&](size_t first, size_t last) {
+                if constexpr (vectorized<I, O>) {
+                    impl::vec::batch_norm_apply_4d<default_vec>(input, scale, shift, output, first, last);
+                } else {
+                    impl::standard::batch_norm_apply_4d(input, scale, shift, output, first, last);
+                }
+            };
+
+            engine_dispatch_1d_serial(batch_fun, 0, N * K, engine_select_parallel(etl::size(input), tuning().parallel_threshold) && N * K > 1);
+        }
+
+        output.validate_cpu();
+        output.invalidate_gpu();
+    }
+};
+
+} //end of namespace etl::detail
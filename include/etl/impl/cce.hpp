@@ -17,6 +17,7 @@
 
 //Include the implementations
 #include "etl/impl/std/cce.hpp"
+#include "etl/impl/vec/cce.hpp"
 #include "etl/impl/egblas/cce.hpp"
 
 namespace etl::detail {
@@ -156,4 +157,60 @@ struct cce_error_impl {
     }
 };
 
+/*!
+ * \brief Fused softmax cross entropy implementation
+ */
+struct softmax_cross_entropy_impl {
+    /*!
+     * \brief Compute the softmax cross entropy loss of the rows [first, last)
+     */
+    template <typename O, typename L, typename G>
+    static value_t<O> kernel(const O& logits, const L& labels, G& gradient, size_t first, size_t last) {
+        using T = value_t<O>;
+
+        if constexpr (vec_enabled && all_vectorizable<vector_mode, O, L, G> && all_homogeneous<O, L, G> && is_floating<O> && exp_unary_op<T>::template vectorizable<vector_mode>) {
+            return impl::vec::softmax_cross_entropy_kernel<default_vec>(logits, labels, gradient, first, last);
+        } else {
+            return impl::standard::softmax_cross_entropy_kernel(logits, labels, gradient, first, last);
+        }
+    }
+
+    /*!
+     * \brief Apply the functor to the logits and labels
+     * \param logits The logits
+     * \param labels The labels
+     * \param gradient The gradient of the loss with respect to the logits
+     * \param scale The scale of the loss
+     * \return the scaled loss
+     */
+    template <typename O, typename L, typename G>
+    static value_t<O> apply(const O& logits, const L& labels, G& gradient, value_t<O> scale) {
+        using T = value_t<O>;
+
+        etl::force(logits);
+        etl::force(labels);
+
+        safe_ensure_cpu_up_to_date(logits);
+        safe_ensure_cpu_up_to_date(labels);
+
+        const size_t m = etl::dim<0>(logits);
+        const size_t n = etl::dim<1>(logits);
+
+        T loss(0);
+
+        if (n) {
+            auto batch_fun = [&](size_t first, size_t last) { return kernel(logits, labels, gradient, first, last); };
+            auto acc_fun   = [&loss](T value) { loss += value; };
+
+            // The threshold is given in elements, the rows are dispatched
+            engine_dispatch_1d_acc<T>(batch_fun, acc_fun, 0, m, std::max<size_t>(2, tuning().cce_parallel_threshold / n));
+        }
+
+        gradient.validate_cpu();
+        gradient.invalidate_gpu();
+
+        return scale * loss;
+    }
+};
+
 } //end of namespace etl::detail
@@ -0,0 +1,93 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Common helpers for the reductions (pairwise summation and
+ * moments).
+ */
+
+#pragma once
+
+namespace etl::impl::common {
+
+/*!
+ * \brief The number of elements reduced directly by a kernel in the
+ * pairwise reductions. This must be a multiple of every vector size
+ * so that the blocks stay aligned.
+ */
+constexpr size_t pairwise_block = 1024;
+
+/*!
+ * \brief Reduce the range [first, last) by recursively splitting it
+ * in two halves (on block boundaries) until the blocks are small
+ * enough to be reduced directly by the kernel.
+ *
+ * The rounding error grows with the logarithm of the number of
+ * blocks instead of linearly with the number of elements.
+ *
+ * \param first The beginning of the range
+ * \param last The end of the range
+ * \param kernel The functor reducing a block directly
+ * \param combine The functor combining two partial results
+ * \return the result of the reduction
+ */
+template <typename R, typename Kernel, typename Combine>
+R pairwise_reduce(size_t first, size_t last, Kernel&& kernel, Combine&& combine) {
+    if (last - first <= pairwise_block) {
+        return kernel(first, last);
+    }
+
+    const size_t blocks = (last - first + pairwise_block - 1) / pairwise_block;
+    const size_t middle = first + (blocks / 2) * pairwise_block;
+
+    return combine(pairwise_reduce<R>(first, middle, kernel, combine), pairwise_reduce<R>(middle, last, kernel, combine));
+}
+
+/*!
+ * \brief The type used to compute the moments of values of type T.
+ *
+ * The moments of integral values are computed in double precision,
+ * since their mean and their deviations are not integral.
+ */
+template <typename T>
+using moments_value_t = std::conditional_t<std::is_integral_v<T>, double, T>;
+
+/*!
+ * \brief The first moments of a set of values
+ */
+template <typename T>
+struct moments {
+    size_t count = 0; ///< The number of values
+    T mean       = 0; ///< The mean of the values
+    T m2         = 0; ///< The sum of the squared deviations from the mean
+};
+
+/*!
+ * \brief Combine the moments of two sets of values (Chan et al.)
+ * \param a The moments of the first set
+ * \param b The moments of the second set
+ * \return The moments of the union of the two sets
+ */
+template <typename T>
+moments<T> combine_moments(const moments<T>& a, const moments<T>& b) {
+    if (!a.count) {
+        return b;
+    }
+
+    if (!b.count) {
+        return a;
+    }
+
+    const size_t count = a.count + b.count;
+    const T delta      = b.mean - a.mean;
+    const T ratio      = T(b.count) / T(count);
+
+    return {count, a.mean + delta * ratio, a.m2 + b.m2 + delta * delta * T(a.count) * ratio};
+}
+
+} //end of namespace etl::impl::common
@@ -30,8 +30,19 @@ struct conv4_valid_impl {
             impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, S1, S2, P1, P2);
         } else {
 #endif
+#ifdef ETL_FIND_SELECT
+            auto found = find_select("conv4_valid", find_conv4_valid_candidates<I, K, C>(), [&]() { apply(input, kernel, conv); }, input, kernel, conv);
+#endif
+
             auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+            profile_scope scope("conv4_valid");
+
+            scope.implementation(to_string(impl));
+            scope.shape(input, kernel);
+            scope.flops(2 * etl::size(conv) * etl::dim<1>(kernel) * etl::dim<2>(kernel) * etl::dim<3>(kernel));
+            scope.bytes(sizeof(value_t<I>) * (etl::size(input) + etl::size(kernel) + etl::size(conv)));
+
             if (impl == etl::conv4_impl::CUDNN) {
                 impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, S1, S2, P1, P2);
             } else if (impl == etl::conv4_impl::BLAS_VEC) {
@@ -69,8 +80,19 @@ struct conv4_valid_flipped_impl {
             impl::cudnn::conv4_forward_flipped(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, S1, S2, P1, P2);
         } else {
 #endif
+#ifdef ETL_FIND_SELECT
+            auto found = find_select("conv4_valid_flipped", find_conv4_valid_candidates<I, K, C>(), [&]() { apply(input, kernel, conv); }, input, kernel, conv);
+#endif
+
             auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+            profile_scope scope("conv4_valid_flipped");
+
+            scope.implementation(to_string(impl));
+            scope.shape(input, kernel);
+            scope.flops(2 * etl::size(conv) * etl::dim<1>(kernel) * etl::dim<2>(kernel) * etl::dim<3>(kernel));
+            scope.bytes(sizeof(value_t<I>) * (etl::size(input) + etl::size(kernel) + etl::size(conv)));
+
             if (impl == etl::conv4_impl::CUDNN) {
                 impl::cudnn::conv4_forward_flipped(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, S1, S2, P1, P2);
             } else if (impl == etl::conv4_impl::BLAS_VEC) {
@@ -25,7 +25,7 @@ namespace etl::detail {
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-constexpr etl::conv4_impl select_default_conv4_valid_impl(bool no_gpu, size_t i1, size_t i2, size_t k1, size_t k2) {
+inline etl::conv4_impl select_default_conv4_valid_impl(bool no_gpu, size_t i1, size_t i2, size_t k1, size_t k2) {
     //Note: since the constexpr values will be known at compile time, the
     //conditions will be a lot simplified
 
@@ -43,8 +43,8 @@ constexpr etl::conv4_impl select_default_conv4_valid_impl(bool no_gpu, size_t i1
     }
 
     // Small kernels
-    if (k1 == k2 && k1 <= 5) {
-        if (impl::vec::conv2_possible<vector_mode, I, K, C> && i1 == i2 && i1 > 100) {
+    if (k1 == k2 && k1 <= tuning().conv4_small_kernel_threshold) {
+        if (impl::vec::conv2_possible<vector_mode, I, K, C> && i1 == i2 && i1 > tuning().conv4_vec_image_threshold) {
             return etl::conv4_impl::VEC;
         } else {
             if (cblas_enabled) {
@@ -416,7 +416,7 @@ inline etl::conv4_impl select_conv4_full_impl(size_t k1, size_t k2) {
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-constexpr etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
+inline etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
     return select_default_conv4_valid_impl<I, K, C>(false, i1, i2, k1, k2);
 }
 
@@ -467,4 +467,46 @@ constexpr etl::conv4_impl select_conv4_full_impl(size_t k1, size_t k2) {
 
 #endif
 
+#ifdef ETL_FIND_SELECT
+
+/*!
+ * \brief Returns the implementations of the 4D valid conv of I and K in C
+ * that are timed in ETL_FIND_SELECT mode
+ *
+ * When CUDNN would be selected, no implementation is timed and the
+ * selection is left unchanged.
+ *
+ * \tparam I The input type
+ * \tparam K The kernel type
+ * \tparam C The conv type
+ * \return the candidate implementations
+ */
+template <typename I, typename K, typename C>
+const std::vector<etl::conv4_impl>& find_conv4_valid_candidates() {
+    static const std::vector<etl::conv4_impl> gpu_candidates;
+
+    if (impl::cudnn::conv_possible<I, K, C> && !local_context().cpu) {
+        return gpu_candidates;
+    }
+
+    static const std::vector<etl::conv4_impl> candidates = []() {
+        std::vector<etl::conv4_impl> impls{etl::conv4_impl::STD};
+
+        if (impl::vec::conv2_possible<vector_mode, I, K, C>) {
+            impls.push_back(etl::conv4_impl::VEC);
+            impls.push_back(etl::conv4_impl::BLAS_VEC);
+        }
+
+        if (impl::blas::blas_conv2_possible<I, K, C>) {
+            impls.push_back(etl::conv4_impl::BLAS_MKL);
+        }
+
+        return impls;
+    }();
+
+    return candidates;
+}
+
+#endif
+
 } //end of namespace etl::detail
@@ -27,6 +27,10 @@ struct conv2_valid_multi_impl {
      */
     template <typename I, typename K, typename C>
     static void apply(I&& input, K&& kernel, C&& conv) {
+#ifdef ETL_FIND_SELECT
+        auto found = find_select("conv2_valid_multi", find_conv_valid_multi_candidates<I, K, C>(), [&]() { apply(input, kernel, conv); }, input, kernel, conv);
+#endif
+
         constexpr_select auto impl = select_conv_valid_multi_impl<I, K, C>();
 
         if
@@ -78,6 +82,10 @@ struct conv2_valid_multi_flipped_impl {
      */
     template <typename I, typename K, typename C>
     static void apply(I&& input, K&& kernel, C&& conv) {
+#ifdef ETL_FIND_SELECT
+        auto found = find_select("conv2_valid_multi_flipped", find_conv_valid_multi_candidates<I, K, C>(), [&]() { apply(input, kernel, conv); }, input, kernel, conv);
+#endif
+
         constexpr_select auto impl = select_conv_valid_multi_impl<I, K, C>();
 
         if
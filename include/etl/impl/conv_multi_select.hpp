@@ -233,4 +233,50 @@ constexpr etl::conv_multi_impl select_conv_valid_multi_multi_impl() {
 
 #endif
 
+#ifdef ETL_FIND_SELECT
+
+/*!
+ * \brief Returns the implementations of the conv multi of I and K in C
+ * that are timed in ETL_FIND_SELECT mode
+ *
+ * When CUDNN would be selected, no implementation is timed and the
+ * selection is left unchanged.
+ *
+ * \tparam I The input type
+ * \tparam K The kernel type
+ * \tparam C The conv type
+ * \return the candidate implementations
+ */
+template <typename I, typename K, typename C>
+const std::vector<etl::conv_multi_impl>& find_conv_valid_multi_candidates() {
+    static const std::vector<etl::conv_multi_impl> gpu_candidates;
+
+    if (select_default_conv_valid_multi<I, K, C>(local_context().cpu) == etl::conv_multi_impl::CUDNN) {
+        return gpu_candidates;
+    }
+
+    static const std::vector<etl::conv_multi_impl> candidates = []() {
+        std::vector<etl::conv_multi_impl> impls{etl::conv_multi_impl::STD};
+
+        if (impl::vec::conv2_possible<vector_mode, I, K, C>) {
+            impls.push_back(etl::conv_multi_impl::VEC);
+            impls.push_back(etl::conv_multi_impl::BLAS_VEC);
+        }
+
+        if (impl::blas::blas_conv2_possible<I, K, C>) {
+            impls.push_back(etl::conv_multi_impl::BLAS_MKL);
+        }
+
+        if (impl::blas::conv2_possible<I, K, C>) {
+            impls.push_back(etl::conv_multi_impl::VALID_FFT_MKL);
+        }
+
+        return impls;
+    }();
+
+    return candidates;
+}
+
+#endif
+
 } //end of namespace etl::detail
@@ -14,13 +14,52 @@
 
 //Include the implementations
 #include "etl/impl/std/decomposition.hpp"
+#include "etl/impl/vec/decomposition.hpp"
+#include "etl/impl/vec/eigen.hpp"
+#include "etl/impl/vec/svd.hpp"
 
 namespace etl::detail {
 
 /*!
- * \brief Functor for euclidean norm
+ * \brief Indicates if the blocked decompositions can be used for the
+ * given matrix type
+ */
+template <typename AT>
+constexpr bool blocked_decomposition = is_floating<AT>;
+
+/*!
+ * \brief Functor for LU decomposition
  */
 struct lu_impl {
+    /*!
+     * \brief Compute the compact LU decomposition of A with partial
+     * pivoting
+     * \param A The input matrix
+     * \param LU The compact L and U matrices (output)
+     * \param pivots The pivot indices (output)
+     * \return false if the matrix is singular, true otherwise
+     */
+    template <typename AT, typename LUT>
+    static bool apply(const AT& A, LUT& LU, std::vector<size_t>& pivots) {
+        using T = value_t<AT>;
+
+        const size_t n = etl::dim<0>(A);
+
+        etl::dyn_matrix<T, 2> work(n, n);
+        work = A;
+        work.ensure_cpu_up_to_date();
+
+        pivots.resize(n);
+
+        const bool regular = etl::impl::vec::lu(work.memory_start(), n, pivots.data());
+
+        work.invalidate_gpu();
+
+        LU = work;
+
+        return regular;
+    }
+
     /*!
      * \brief Apply the functor to A, L, U, P
      * \param A The input matrix
@@ -30,7 +69,171 @@ struct lu_impl {
      */
     template <typename AT, typename LT, typename UT, typename PT>
     static void apply(const AT& A, LT& L, UT& U, PT& P) {
-        etl::impl::standard::lu(A, L, U, P);
+        if constexpr (blocked_decomposition<AT>) {
+            using T = value_t<AT>;
+
+            const size_t n = etl::dim<0>(A);
+
+            etl::dyn_matrix<T, 2> LU(n, n);
+            std::vector<size_t> pivots;
+
+            apply(A, LU, pivots);
+
+            std::vector<size_t> perm(n);
+            std::iota(perm.begin(), perm.end(), 0);
+
+            for (size_t i = 0; i < n; ++i) {
+                std::swap(perm[i], perm[pivots[i]]);
+            }
+
+            L = 0;
+            U = 0;
+            P = 0;
+
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < i; ++j) {
+                    L(i, j) = LU(i, j);
+                }
+
+                L(i, i) = 1;
+
+                for (size_t j = i; j < n; ++j) {
+                    U(i, j) = LU(i, j);
+                }
+
+                P(i, perm[i]) = 1;
+            }
+        } else {
+            etl::impl::standard::lu(A, L, U, P);
+        }
+    }
+};
+
+/*!
+ * \brief Functor for Cholesky decomposition
+ */
+struct cholesky_impl {
+    /*!
+     * \brief Apply the functor to A, L
+     * \param A The input matrix, only its lower part is read
+     * \param L The L decomposition (output)
+     * \return false if the matrix is not positive definite, true otherwise
+     */
+    template <typename AT, typename LT>
+    static bool apply(const AT& A, LT& L) {
+        using T = value_t<AT>;
+
+        const size_t n = etl::dim<0>(A);
+
+        etl::dyn_matrix<T, 2> work(n, n);
+        work = A;
+        work.ensure_cpu_up_to_date();
+
+        const bool positive = etl::impl::vec::cholesky(work.memory_start(), n);
+
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = i + 1; j < n; ++j) {
+                work(i, j) = T(0);
+            }
+        }
+
+        work.invalidate_gpu();
+
+        L = work;
+
+        return positive;
+    }
+};
+
+/*!
+ * \brief Functor for the eigendecomposition of symmetric matrices
+ */
+struct eigen_sym_impl {
+    /*!
+     * \brief Apply the functor to A, values, vectors
+     * \param A The symmetric input matrix, only its lower part is read
+     * \param values The eigenvalues in ascending order (output)
+     * \param vectors The eigenvectors, one per column (output)
+     * \return false if the algorithm did not converge, true otherwise
+     */
+    template <typename AT, typename ET, typename VT>
+    static bool apply(const AT& A, ET& values, VT& vectors) {
+        using T = value_t<AT>;
+
+        const size_t n = etl::dim<0>(A);
+
+        etl::dyn_matrix<T, 2> work(n, n);
+        etl::dyn_matrix<T, 2> v(n, n);
+        etl::dyn_vector<T> e(n);
+
+        work = A;
+        work.ensure_cpu_up_to_date();
+
+        const bool converged = etl::impl::vec::eigen_sym(work.memory_start(), n, e.memory_start(), v.memory_start());
+
+        e.invalidate_gpu();
+        v.invalidate_gpu();
+
+        values  = e;
+        vectors = v;
+
+        return converged;
+    }
+};
+
+/*!
+ * \brief Functor for the truncated singular value decomposition
+ */
+struct svd_impl {
+    /*!
+     * \brief The number of random vectors used in addition to the
+     * number of singular values
+     */
+    static constexpr size_t oversampling = 10;
+
+    /*!
+     * \brief The number of power iterations refining the range of the
+     * matrix
+     */
+    static constexpr size_t power_iterations = 2;
+
+    /*!
+     * \brief Apply the functor to A, U, s, V
+     * \param A The input matrix (m x n)
+     * \param U The left singular vectors (output, m x k)
+     * \param s The singular values in descending order (output, k)
+     * \param V The right singular vectors (output, n x k)
+     * \param g The random generator
+     * \return false if the algorithm did not converge, true otherwise
+     */
+    template <typename AT, typename UT, typename ST, typename VT, typename G>
+    static bool apply(const AT& A, UT& U, ST& s, VT& V, G& g) {
+        using T = value_t<AT>;
+
+        const size_t m = etl::dim<0>(A);
+        const size_t n = etl::dim<1>(A);
+        const size_t k = etl::size(s);
+
+        etl::dyn_matrix<T, 2> work(m, n);
+        etl::dyn_matrix<T, 2> u(m, k);
+        etl::dyn_matrix<T, 2> v(n, k);
+        etl::dyn_vector<T> sv(k);
+
+        work = A;
+        work.ensure_cpu_up_to_date();
+
+        const bool converged = etl::impl::vec::randomized_svd(work.memory_start(), m, n, k, u.memory_start(), sv.memory_start(), v.memory_start(), g,
+                                                              oversampling, power_iterations);
+
+        u.invalidate_gpu();
+        v.invalidate_gpu();
+        sv.invalidate_gpu();
+
+        U = u;
+        s = sv;
+        V = v;
+
+        return converged;
     }
 };
 
@@ -46,7 +249,38 @@ struct qr_impl {
      */
     template <typename AT, typename QT, typename RT>
     static void apply(AT& A, QT& Q, RT& R) {
-        etl::impl::standard::qr(A, Q, R);
+        if constexpr (blocked_decomposition<AT>) {
+            using T = value_t<AT>;
+
+            const size_t m = etl::dim<0>(A);
+            const size_t n = etl::dim<1>(A);
+
+            etl::dyn_matrix<T, 2> work(m, n);
+            etl::dyn_matrix<T, 2> q(m, m);
+            std::vector<T> tau(std::min(m, n));
+
+            work = A;
+            work.ensure_cpu_up_to_date();
+
+            etl::impl::vec::householder_qr(work.memory_start(), m, n, tau.data());
+            etl::impl::vec::householder_q(work.memory_start(), m, n, tau.data(), q.memory_start(), m);
+
+            work.invalidate_gpu();
+            q.invalidate_gpu();
+
+            // R is the upper part of the factored matrix
+
+            for (size_t i = 0; i < m; ++i) {
+                for (size_t j = 0; j < std::min(i, n); ++j) {
+                    work(i, j) = T(0);
+                }
+            }
+
+            Q = q;
+            R = work;
+        } else {
+            etl::impl::standard::qr(A, Q, R);
+        }
     }
 };
 
@@ -0,0 +1,233 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Implementation of the embedding gather and scatter kernels.
+ *
+ * The gather copies whole rows of the vocabulary, prefetching the rows
+ * of the next indices, in parallel over the indices. The scatter groups
+ * the indices by vocabulary row so that each row is accumulated by a
+ * single thread, without atomics.
+ */
+
+#pragma once
+
+namespace etl::detail {
+
+/*!
+ * \brief Embedding implementation
+ */
+struct embedding_impl {
+    /*!
+     * \brief The number of indices between the row being copied and the
+     * row being prefetched.
+     */
+    static constexpr size_t prefetch_distance = 4;
+
+    /*!
+     * \brief Indicates if the row kernels can be used for the given
+     * vocabulary and output
+     *
+     * The rows are copied and accumulated through raw pointers, which
+     * needs the same value type on both sides.
+     */
+    template <typename V, typename O>
+    static constexpr bool direct = all_dma<V, O> && all_row_major<V, O> && all_homogeneous<V, O>;
+
+    /*!
+     * \brief Prefetch a row of the vocabulary in cache
+     * \param row Pointer to the first element of the row
+     * \param n The number of elements of the row
+     */
+    template <typename T>
+    static void prefetch_row([[maybe_unused]] const T* row, [[maybe_unused]] size_t n) {
+#if defined(__GNUC__) || defined(__clang__)
+        const char* first = reinterpret_cast<const char*>(row);
+        const char* last  = reinterpret_cast<const char*>(row + n);
+
+        for (; first < last; first += 64) {
+            __builtin_prefetch(first, 0, 3);
+        }
+#endif
+    }
+
+    /*!
+     * \brief Gather the rows of the vocabulary selected by the indices.
+     *
+     * The n-th row of the output is the row indices[n] of the
+     * vocabulary. The indices can have any number of dimensions, they
+     * are taken in row-major order.
+     *
+     * \param indices The indices
+     * \param vocab The vocabulary (V x D)
+     * \param output The output (N x D, flattened)
+     */
+    template <typename I, typename V, typename O>
+    static void gather(const I& indices, const V& vocab, O& output) {
+        const size_t N = etl::size(indices);
+        const size_t D = etl::dim<1>(vocab);
+
+        const auto* vocab_m = vocab.memory_start();
+        auto* out_m         = output.memory_start();
+
+        auto batch_fun = [&](size_t first, size_t last) {
+            for (size_t n = first; n < std::min(last, first + prefetch_distance); ++n) {
+                prefetch_row(vocab_m + size_t(indices[n]) * D, D);
+            }
+
+            for (size_t n = first; n < last; ++n) {
+                if (n + prefetch_distance < last) {
+                    prefetch_row(vocab_m + size_t(indices[n + prefetch_distance]) * D, D);
+                }
+
+                const auto* row = vocab_m + size_t(indices[n]) * D;
+
+                std::copy(row, row + D, out_m + n * D);
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, N, engine_select_parallel(N * D, tuning().parallel_threshold) && N > 1);
+
+        output.validate_cpu();
+        output.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Group the positions of the indices by vocabulary row.
+     *
+     * \param indices The indices
+     * \param order Filled with the positions of the indices sorted by index
+     * \param groups Filled with the start of each group of positions
+     * sharing the same index in order, followed by the number of indices
+     */
+    template <typename I>
+    static void group(const I& indices, std::vector<size_t>& order, std::vector<size_t>& groups) {
+        const size_t N = etl::size(indices);
+
+        std::vector<std::pair<size_t, size_t>> keys(N);
+
+        for (size_t n = 0; n < N; ++n) {
+            keys[n] = {size_t(indices[n]), n};
+        }
+
+        std::sort(keys.begin(), keys.end());
+
+        order.resize(N);
+        groups.clear();
+
+        for (size_t n = 0; n < N; ++n) {
+            if (n == 0 || keys[n].first != keys[n - 1].first) {
+                groups.push_back(n);
+            }
+
+            order[n] = keys[n].second;
+        }
+
+        groups.push_back(N);
+    }
+
+    /*!
+     * \brief Sum the error rows of the given groups.
+     *
+     * The group g is summed into the row target(g) of out_m. Since a
+     * group is handled by a single thread, no synchronization is
+     * necessary.
+     *
+     * \param errors_m The errors (N x D)
+     * \param out_m The output memory
+     * \param D The number of columns
+     * \param order The positions sorted by index
+     * \param groups The start of each group
+     * \param target Functor returning the output row of a group
+     */
+    template <typename T, typename Target>
+    static void accumulate(const T* errors_m, T* out_m, size_t D, const std::vector<size_t>& order, const std::vector<size_t>& groups, Target&& target) {
+        const size_t G = groups.size() - 1;
+
+        auto batch_fun = [&](size_t first, size_t last) {
+            for (size_t g = first; g < last; ++g) {
+                T* out = out_m + target(g) * D;
+
+                const auto* src = errors_m + order[groups[g]] * D;
+
+                std::copy(src, src + D, out);
+
+                for (size_t p = groups[g] + 1; p < groups[g + 1]; ++p) {
+                    src = errors_m + order[p] * D;
+
+                    for (size_t d = 0; d < D; ++d) {
+                        out[d] += src[d];
+                    }
+                }
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, G, engine_select_parallel(order.size() * D, tuning().parallel_threshold) && G > 1);
+    }
+
+    /*!
+     * \brief Accumulate the errors into the dense gradients of the
+     * vocabulary.
+     *
+     * The rows of the gradients that are not indexed are set to zero.
+     *
+     * \param indices The indices (N, flattened)
+     * \param errors The errors (N x D, flattened)
+     * \param output The gradients (V x D)
+     */
+    template <typename I, typename E, typename O>
+    static void scatter(const I& indices, const E& errors, O& output) {
+        std::vector<size_t> order;
+        std::vector<size_t> groups;
+
+        group(indices, order, groups);
+
+        output = 0;
+
+        accumulate(errors.memory_start(), output.memory_start(), etl::dim<1>(output), order, groups, [&](size_t g) { return size_t(indices[order[groups[g]]]); });
+
+        output.validate_cpu();
+        output.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Accumulate the errors into row-sparse gradients of the
+     * vocabulary.
+     *
+     * \param indices The indices (N, flattened)
+     * \param errors The errors (N x D, flattened)
+     * \param rows Filled with the sorted unique indices
+     * \param values Filled with the summed errors of each unique index (U x D)
+     */
+    template <typename I, typename E, typename T>
+    static void sparse_scatter(const I& indices, const E& errors, std::vector<size_t>& rows, etl::dyn_matrix<T, 2>& values) {
+        const size_t D = etl::dim<decay_traits<E>::dimensions() - 1>(errors);
+
+        std::vector<size_t> order;
+        std::vector<size_t> groups;
+
+        group(indices, order, groups);
+
+        const size_t G = groups.size() - 1;
+
+        rows.resize(G);
+
+        for (size_t g = 0; g < G; ++g) {
+            rows[g] = size_t(indices[order[groups[g]]]);
+        }
+
+        values = etl::dyn_matrix<T, 2>(G, D);
+
+        accumulate(errors.memory_start(), values.memory_start(), D, order, groups, [](size_t g) { return g; });
+
+        values.validate_cpu();
+        values.invalidate_gpu();
+    }
+};
+
+} //end of namespace etl::detail
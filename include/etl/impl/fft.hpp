@@ -289,6 +289,63 @@ constexpr fft_impl select_fft2_many_impl() {
 
 #endif
 
+#ifdef ETL_FIND_SELECT
+
+/*!
+ * \brief Returns the implementations of FFT that are timed in
+ * ETL_FIND_SELECT mode
+ *
+ * When CUFFT would be selected, no implementation is timed and the
+ * selection is left unchanged.
+ *
+ * \param def The default implementation of the operation
+ * \return the candidate implementations
+ */
+inline const std::vector<fft_impl>& find_fft_candidates(fft_impl def) {
+    static const std::vector<fft_impl> gpu_candidates;
+
+    if (def == fft_impl::CUFFT) {
+        return gpu_candidates;
+    }
+
+    static const std::vector<fft_impl> candidates = []() {
+        std::vector<fft_impl> impls{fft_impl::STD};
+
+        if (mkl_enabled) {
+            impls.push_back(fft_impl::MKL);
+        }
+
+        return impls;
+    }();
+
+    return candidates;
+}
+
+/*!
+ * \brief Find the fastest implementation of an FFT of a into c
+ *
+ * An in-place transform cannot be run several times, it is left to the
+ * default selection.
+ *
+ * \param op The name of the operation (a string literal)
+ * \param def The default implementation of the operation
+ * \param functor The functor running the operation
+ * \param a The input of the transform
+ * \param c The output of the transform
+ *
+ * \return a context forcing the found implementation
+ */
+template <typename Functor, typename A, typename C>
+find_select_context<fft_impl> find_fft_select(const char* op, fft_impl def, Functor&& functor, const A& a, const C& c) {
+    if (a.alias(c)) {
+        return find_select_context<fft_impl>();
+    }
+
+    return find_select(op, find_fft_candidates(def), functor, a, c);
+}
+
+#endif
+
 /*!
  * \brief Functor for 1D FFT
  */
@@ -307,6 +364,10 @@ struct fft1_impl {
      */
     template <typename A, typename C>
     static void apply(A&& a, C&& c) {
+#ifdef ETL_FIND_SELECT
+        auto found = find_fft_select("fft1", select_default_fft1_impl(local_context().cpu), [&]() { apply(a, c); }, a, c);
+#endif
+
         constexpr_select auto impl = select_fft1_impl();
 
         if
@@ -345,6 +406,10 @@ struct ifft1_impl {
      */
     template <typename A, typename C>
     static void apply(A&& a, C&& c) {
+#ifdef ETL_FIND_SELECT
+        auto found = find_fft_select("ifft1", select_default_ifft1_impl(local_context().cpu), [&]() { apply(a, c); }, a, c);
+#endif
+
         constexpr_select auto impl = select_ifft1_impl();
 
         if
@@ -383,6 +448,10 @@ struct ifft1_real_impl {
      */
     template <typename A, typename C>
     static void apply(A&& a, C&& c) {
+#ifdef ETL_FIND_SELECT
+        auto found = find_fft_select("ifft1_real", select_default_ifft1_impl(local_context().cpu), [&]() { apply(a, c); }, a, c);
+#endif
+
         constexpr_select auto impl = select_ifft1_impl();
 
         if
@@ -421,6 +490,10 @@ struct fft2_impl {
      */
     template <typename A, typename C>
     static void apply(A&& a, C&& c) {
+#ifdef ETL_FIND_SELECT
+        auto found = find_fft_select("fft2", select_default_fft2_impl(local_context().cpu), [&]() { apply(a, c); }, a, c);
+#endif
+
         constexpr_select auto impl = select_fft2_impl();
 
         if
@@ -459,6 +532,10 @@ struct ifft2_impl {
      */
     template <typename A, typename C>
     static void apply(A&& a, C&& c) {
+#ifdef ETL_FIND_SELECT
+        auto found = find_fft_select("ifft2", select_default_fft2_impl(local_context().cpu), [&]() { apply(a, c); }, a, c);
+#endif
+
         constexpr_select auto impl = select_fft2_impl();
 
         if
@@ -497,6 +574,10 @@ struct ifft2_real_impl {
      */
     template <typename A, typename C>
     static void apply(A&& a, C&& c) {
+#ifdef ETL_FIND_SELECT
+        auto found = find_fft_select("ifft2_real", select_default_fft2_impl(local_context().cpu), [&]() { apply(a, c); }, a, c);
+#endif
+
         constexpr_select auto impl = select_fft2_impl();
 
         if
@@ -669,4 +750,107 @@ struct ifft2_many_impl {
     }
 };
 
+/*!
+ * \brief Functor for 1D real FFT
+ *
+ * The real transforms are only implemented in the standard
+ * implementation.
+ */
+struct rfft1_impl {
+    /*!
+     * \brief Returns the last dimension of the result
+     * \param n The last dimension of the input
+     * \return The last dimension of the result
+     */
+    static constexpr size_t dim(size_t n) {
+        return n / 2 + 1;
+    }
+
+    /*!
+     * \brief Apply the functor
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        inc_counter("impl:std");
+        etl::impl::standard::rfft1(smart_forward(a), c);
+    }
+};
+
+/*!
+ * \brief Functor for 1D real IFFT
+ */
+struct irfft1_impl {
+    /*!
+     * \brief Returns the last dimension of the result
+     * \param n The last dimension of the input
+     * \return The last dimension of the result
+     */
+    static constexpr size_t dim(size_t n) {
+        return 2 * (n - 1);
+    }
+
+    /*!
+     * \brief Apply the functor
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        inc_counter("impl:std");
+        etl::impl::standard::irfft1(smart_forward(a), c);
+    }
+};
+
+/*!
+ * \brief Functor for 2D real FFT
+ */
+struct rfft2_impl {
+    /*!
+     * \brief Returns the last dimension of the result
+     * \param n The last dimension of the input
+     * \return The last dimension of the result
+     */
+    static constexpr size_t dim(size_t n) {
+        return n / 2 + 1;
+    }
+
+    /*!
+     * \brief Apply the functor
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        inc_counter("impl:std");
+        etl::impl::standard::rfft2(smart_forward(a), c);
+    }
+};
+
+/*!
+ * \brief Functor for 2D real IFFT
+ */
+struct irfft2_impl {
+    /*!
+     * \brief Returns the last dimension of the result
+     * \param n The last dimension of the input
+     * \return The last dimension of the result
+     */
+    static constexpr size_t dim(size_t n) {
+        return 2 * (n - 1);
+    }
+
+    /*!
+     * \brief Apply the functor
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <typename A, typename C>
+    static void apply(A&& a, C&& c) {
+        inc_counter("impl:std");
+        etl::impl::standard::irfft2(smart_forward(a), c);
+    }
+};
+
 } //end of namespace etl::detail
@@ -0,0 +1,146 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the "max_index" and "min_index" reductions.
+ *
+ * The search is vectorized when the sum implementation is not forced
+ * to STD and the expression is vectorizable. Large expressions are
+ * split into contiguous chunks searched in parallel, the chunk results
+ * being combined in order to keep the index of the first extremum.
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/std/max_index.hpp"
+#include "etl/impl/vec/max_index.hpp"
+
+namespace etl::detail {
+
+/*!
+ * \brief Functor for the index of the maximum (or minimum) element
+ * \tparam Max true to search the maximum, false to search the minimum
+ */
+template <bool Max>
+struct index_impl {
+    /*!
+     * \brief Returns the index of the first extremum of a in [first, last)
+     * \param a The expression to search
+     * \param first The beginning of the range
+     * \param last The end of the range
+     * \return The index of the first extremum of the range
+     */
+    template <typename A>
+    static size_t kernel(const A& a, size_t first, size_t last) {
+        constexpr_select const auto impl = select_sum_impl<A>();
+
+        if
+            constexpr_select(impl != etl::sum_impl::STD && vec_enabled && all_vectorizable<vector_mode, A> && is_floating<A>) {
+                return etl::impl::vec::index_kernel<default_vec, Max>(a, first, last);
+            }
+        else {
+            return etl::impl::standard::index_kernel<Max>(a, first, last);
+        }
+    }
+
+    /*!
+     * \brief Indicates if the first value is strictly better than the second
+     */
+    template <typename T>
+    static bool better(const T& a, const T& b) {
+        return Max ? a > b : a < b;
+    }
+
+    /*!
+     * \brief Apply the functor to a
+     * \param a The expression to search
+     * \return the index of the first extremum of a
+     */
+    template <typename A>
+    static size_t apply(const A& a) {
+        const size_t n = etl::size(a);
+
+        if (!n) {
+            return 0;
+        }
+
+        if (engine_select_parallel(n, index_parallel_threshold)) {
+            // Chunks are multiple of 64 elements to not share cache lines
+            const size_t chunks = etl::threads;
+            const size_t chunk  = ((n + chunks - 1) / chunks + 63) & ~size_t(63);
+
+            std::vector<size_t> results(chunks, n);
+
+            auto batch_fun = [&](size_t first, size_t last) {
+                for (size_t c = first; c < last; ++c) {
+                    const size_t b = c * chunk;
+
+                    if (b < n) {
+                        results[c] = kernel(a, b, std::min(b + chunk, n));
+                    }
+                }
+            };
+
+            engine_dispatch_1d_serial(batch_fun, 0, chunks, true);
+
+            size_t m = results[0];
+
+            for (size_t c = 1; c < chunks && results[c] < n; ++c) {
+                if (better(a[results[c]], a[m])) {
+                    m = results[c];
+                }
+            }
+
+            return m;
+        }
+
+        return kernel(a, 0, n);
+    }
+
+    /*!
+     * \brief Compute the index of the extremum of each row of the matrix a
+     * \param a The matrix to search
+     * \param c The vector of indices
+     */
+    template <typename A, typename C>
+    static void apply_rows(const A& a, C& c) {
+        const size_t m = etl::dim<0>(a);
+        const size_t n = etl::dim<1>(a);
+
+        if (!n) {
+            c = 0;
+            return;
+        }
+
+        auto batch_fun = [&](size_t first, size_t last) {
+            if constexpr (is_row_major<A>) {
+                for (size_t i = first; i < last; ++i) {
+                    c[i] = kernel(a, i * n, (i + 1) * n) - i * n;
+                }
+            } else {
+                // The elements of a row are not contiguous
+                for (size_t i = first; i < last; ++i) {
+                    size_t best = 0;
+
+                    for (size_t j = 1; j < n; ++j) {
+                        if (better(a(i, j), a(i, best))) {
+                            best = j;
+                        }
+                    }
+
+                    c[i] = best;
+                }
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, m, engine_select_parallel(m * n, index_parallel_threshold) && m > 1);
+    }
+};
+
+} //end of namespace etl::detail
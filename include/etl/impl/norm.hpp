@@ -28,7 +28,17 @@ struct norm_impl {
      */
     template <typename A>
     static value_t<A> apply(const A& a) {
-        return etl::impl::standard::norm(a);
+        constexpr_select const auto impl = select_sum_impl<A>();
+
+        if
+            constexpr_select(impl != etl::sum_impl::STD && vec_enabled && all_vectorizable<vector_mode, A>) {
+                inc_counter("impl:vec");
+                return etl::impl::vec::norm(a);
+            }
+        else {
+            inc_counter("impl:std");
+            return etl::impl::standard::norm(a);
+        }
     }
 };
 
@@ -0,0 +1,158 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the linear systems solvers.
+ *
+ * Triangular matrices are solved directly, symmetric matrices through
+ * their Cholesky decomposition and the other matrices through their LU
+ * decomposition. The right-hand sides are never inverted.
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/vec/decomposition.hpp"
+#include "etl/impl/vec/solve.hpp"
+
+namespace etl::detail {
+
+/*!
+ * \brief The structure assumed for the matrix of a linear system
+ */
+enum class solve_mode {
+    general, ///< The structure is deduced from the type of the matrix
+    lower,   ///< The matrix is lower triangular
+    upper    ///< The matrix is upper triangular
+};
+
+/*!
+ * \brief Functor for the linear systems solvers
+ */
+struct solve_impl {
+    /*!
+     * \brief Indicates if the given matrix type is lower triangular
+     */
+    template <typename AT>
+    static constexpr bool lower = is_lower_matrix<AT> || is_uni_lower_matrix<AT> || is_diagonal_matrix<AT>;
+
+    /*!
+     * \brief Indicates if the given matrix type is upper triangular
+     */
+    template <typename AT>
+    static constexpr bool upper = is_upper_matrix<AT> || is_uni_upper_matrix<AT>;
+
+    /*!
+     * \brief Indicates if the given matrix type has a unit diagonal
+     */
+    template <typename AT>
+    static constexpr bool unit = is_uni_lower_matrix<AT> || is_uni_upper_matrix<AT>;
+
+    /*!
+     * \brief Solve A * X = B and store X in C
+     *
+     * The result is undefined if A is singular.
+     *
+     * \param A The square matrix of the system
+     * \param B The right-hand sides (a vector or a matrix with one
+     * right-hand side per column)
+     * \param C The solution (output, same dimensions as B)
+     * \tparam Mode The structure assumed for A
+     */
+    template <solve_mode Mode, typename AT, typename BT, typename CT>
+    static void apply(const AT& A, const BT& B, CT& C) {
+        using T = value_t<AT>;
+
+        etl::force(A);
+        etl::force(B);
+
+        safe_ensure_cpu_up_to_date(A);
+        safe_ensure_cpu_up_to_date(B);
+
+        const size_t n = etl::dim<0>(A);
+        const size_t m = n ? etl::size(B) / n : 0;
+
+        etl::dyn_matrix<T, 2> x(n, m);
+
+        for (size_t i = 0; i < n * m; ++i) {
+            x[i] = B.read_flat(i);
+        }
+
+        if constexpr (Mode == solve_mode::lower || Mode == solve_mode::upper || lower<AT> || upper<AT>) {
+            constexpr bool is_lower = Mode == solve_mode::lower || (Mode == solve_mode::general && lower<AT>);
+
+            if constexpr (is_dma<AT> && is_row_major<AT>) {
+                etl::impl::vec::trsm<is_lower, unit<AT>>(A.memory_start(), n, x.memory_start(), m);
+            } else {
+                etl::dyn_matrix<T, 2> work(n, n);
+                work = A;
+                work.ensure_cpu_up_to_date();
+
+                etl::impl::vec::trsm<is_lower, unit<AT>>(work.memory_start(), n, x.memory_start(), m);
+            }
+        } else {
+            etl::dyn_matrix<T, 2> work(n, n);
+            work = A;
+            work.ensure_cpu_up_to_date();
+
+            T* w = work.memory_start();
+
+            bool solved = false;
+
+            if constexpr (is_symmetric_matrix<AT>) {
+                // L is kept in the lower part and L^T is mirrored in the upper part
+                if (etl::impl::vec::cholesky(w, n)) {
+                    for (size_t i = 0; i < n; ++i) {
+                        for (size_t j = 0; j < i; ++j) {
+                            w[j * n + i] = w[i * n + j];
+                        }
+                    }
+
+                    etl::impl::vec::trsm<true, false>(w, n, x.memory_start(), m);
+                    etl::impl::vec::trsm<false, false>(w, n, x.memory_start(), m);
+
+                    solved = true;
+                } else {
+                    // Not positive definite, fall back to LU
+                    work = A;
+                    work.ensure_cpu_up_to_date();
+                }
+            }
+
+            if (!solved) {
+                std::vector<size_t> pivots(n);
+
+                etl::impl::vec::lu(w, n, pivots.data());
+
+                T* xm = x.memory_start();
+
+                for (size_t i = 0; i < n; ++i) {
+                    if (pivots[i] != i) {
+                        std::swap_ranges(xm + i * m, xm + (i + 1) * m, xm + pivots[i] * m);
+                    }
+                }
+
+                etl::impl::vec::trsm<true, true>(w, n, xm, m);
+                etl::impl::vec::trsm<false, false>(w, n, xm, m);
+            }
+        }
+
+        if constexpr (is_dma<CT>) {
+            std::copy_n(x.memory_start(), n * m, C.memory_start());
+
+            C.validate_cpu();
+            C.invalidate_gpu();
+        } else {
+            for (size_t i = 0; i < n * m; ++i) {
+                C[i] = x[i];
+            }
+        }
+    }
+};
+
+} //end of namespace etl::detail
@@ -0,0 +1,190 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the batch normalization kernels
+ */
+
+#pragma once
+
+#include "etl/impl/common/reduce.hpp"
+
+namespace etl::impl::standard {
+
+/*!
+ * \brief Compute the sum over the batch of the (shifted and squared)
+ * values of the channels [first, last) of a 2D input.
+ *
+ * The input is traversed row by row, each row being contiguous.
+ *
+ * \param input The input (N x K)
+ * \param shift The value subtracted from each channel (only used if Squared)
+ * \param output The output (K)
+ * \param first The first channel
+ * \param last The end of the channels
+ * \tparam Squared If true, the squares of the shifted values are summed
+ */
+template <bool Squared, typename I, typename B, typename O>
+void batch_sum_2d([[maybe_unused]] const I& input, [[maybe_unused]] const B& shift, O& output, size_t first, size_t last) {
+    const size_t N = etl::dim<0>(input);
+    const size_t K = etl::dim<1>(input);
+
+    for (size_t k = first; k < last; ++k) {
+        output[k] = 0;
+    }
+
+    for (size_t b = 0; b < N; ++b) {
+        for (size_t k = first; k < last; ++k) {
+            if constexpr (Squared) {
+                const auto x = input[b * K + k] - shift[k];
+                output[k] += x * x;
+            } else {
+                output[k] += input[b * K + k];
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Compute the mean and the (biased) variance over the batch of
+ * the channels [first, last) of a 2D input, in a single pass.
+ *
+ * The statistics are updated with Welford's algorithm while the input
+ * is traversed row by row.
+ *
+ * \param input The input (N x K)
+ * \param mean The output mean (K)
+ * \param var The output variance (K)
+ * \param first The first channel
+ * \param last The end of the channels
+ */
+template <typename I, typename M, typename V>
+void batch_norm_stats_2d(const I& input, M& mean, V& var, size_t first, size_t last) {
+    using T = value_t<I>;
+
+    const size_t N = etl::dim<0>(input);
+    const size_t K = etl::dim<1>(input);
+
+    for (size_t k = first; k < last; ++k) {
+        mean[k] = 0;
+        var[k]  = 0;
+    }
+
+    for (size_t b = 0; b < N; ++b) {
+        const T inv = T(1) / T(b + 1);
+
+        for (size_t k = first; k < last; ++k) {
+            const T x     = input[b * K + k];
+            const T delta = x - mean[k];
+
+            mean[k] += delta * inv;
+            var[k] += delta * (x - mean[k]);
+        }
+    }
+
+    for (size_t k = first; k < last; ++k) {
+        var[k] /= T(N);
+    }
+}
+
+/*!
+ * \brief Compute the mean and the (biased) variance over the batch and
+ * the spatial dimensions of the channels [first, last) of a 4D input,
+ * in a single pass.
+ *
+ * Each contiguous (batch, channel) block is reduced while it is in
+ * cache and the blocks are combined with Welford's algorithm.
+ *
+ * \param input The input (N x K x H x W)
+ * \param mean The output mean (K)
+ * \param var The output variance (K)
+ * \param first The first channel
+ * \param last The end of the channels
+ */
+template <typename I, typename M, typename V>
+void batch_norm_stats_4d(const I& input, M& mean, V& var, size_t first, size_t last) {
+    using T = value_t<I>;
+
+    const size_t N = etl::dim<0>(input);
+    const size_t K = etl::dim<1>(input);
+    const size_t S = etl::dim<2>(input) * etl::dim<3>(input);
+
+    for (size_t k = first; k < last; ++k) {
+        common::moments<T> m;
+
+        for (size_t b = 0; b < N; ++b) {
+            const size_t base = (b * K + k) * S;
+
+            T sum(0);
+
+            for (size_t i = base; i < base + S; ++i) {
+                sum += input[i];
+            }
+
+            const T block_mean = sum / T(S);
+
+            T m2(0);
+
+            for (size_t i = base; i < base + S; ++i) {
+                m2 += (input[i] - block_mean) * (input[i] - block_mean);
+            }
+
+            m = common::combine_moments(m, common::moments<T>{S, block_mean, m2});
+        }
+
+        mean[k] = m.mean;
+        var[k]  = m.count ? m.m2 / T(m.count) : T(0);
+    }
+}
+
+/*!
+ * \brief Normalize the rows [first, last) of a 2D input with the given
+ * per-channel scale and shift
+ * \param input The input (N x K)
+ * \param scale The per-channel scale (K)
+ * \param shift The per-channel shift (K)
+ * \param output The output (N x K)
+ * \param first The first row
+ * \param last The end of the rows
+ */
+template <typename I, typename S, typename O>
+void batch_norm_apply_2d(const I& input, const S& scale, const S& shift, O& output, size_t first, size_t last) {
+    const size_t K = etl::dim<1>(input);
+
+    for (size_t b = first; b < last; ++b) {
+        for (size_t k = 0; k < K; ++k) {
+            output[b * K + k] = input[b * K + k] * scale[k] + shift[k];
+        }
+    }
+}
+
+/*!
+ * \brief Normalize the (batch, channel) blocks [first, last) of a 4D
+ * input with the given per-channel scale and shift
+ * \param input The input (N x K x H x W)
+ * \param scale The per-channel scale (K)
+ * \param shift The per-channel shift (K)
+ * \param output The output (N x K x H x W)
+ * \param first The first block
+ * \param last The end of the blocks
+ */
+template <typename I, typename S, typename O>
+void batch_norm_apply_4d(const I& input, const S& scale, const S& shift, O& output, size_t first, size_t last) {
+    const size_t K  = etl::dim<1>(input);
+    const size_t SS = etl::dim<2>(input) * etl::dim<3>(input);
+
+    for (size_t bk = first; bk < last; ++bk) {
+        const size_t k = bk % K;
+
+        for (size_t i = bk * SS; i < (bk + 1) * SS; ++i) {
+            output[i] = input[i] * scale[k] + shift[k];
+        }
+    }
+}
+
+} //end of namespace etl::impl::standard
@@ -15,18 +15,23 @@
 namespace etl::impl::standard {
 
 /*!
- * \brief Compute the bias addition of a and b and store the result in c
+ * \brief Compute the bias addition of a and b, apply the activation F
+ * (if any) and store the result in c
  * \param lhs The a expression
  * \param rhs The b expression
  * \param c The c expression
  */
-template <typename A, typename B, typename C>
+template <typename F = identity_op, typename A, typename B, typename C>
 void bias_add_4d(const A& lhs, const B& rhs, C&& c) {
     for (size_t i = 0; i < etl::dim<0>(lhs); ++i) {
         for (size_t j = 0; j < etl::dim<1>(lhs); ++j) {
             for (size_t k = 0; k < etl::dim<2>(lhs); ++k) {
                 for (size_t l = 0; l < etl::dim<3>(lhs); ++l) {
-                    c(i, j, k, l) = lhs(i, j, k, l) + rhs(j);
+                    if constexpr (std::is_same_v<F, identity_op>) {
+                        c(i, j, k, l) = lhs(i, j, k, l) + rhs(j);
+                    } else {
+                        c(i, j, k, l) = F::apply(lhs(i, j, k, l) + rhs(j));
+                    }
                 }
             }
         }
@@ -45,4 +45,63 @@ std::pair<value_t<O>, value_t<O>> cce(const O& output, const L& labels, value_t<
     return std::make_pair(cce_loss(output, labels, alpha), cce_error(output, labels, beta));
 }
 
+/*!
+ * \brief Compute the softmax cross entropy loss and its gradient for
+ * the rows [first, last) of the logits.
+ *
+ * For each row, the logits are read twice: once for the maximum and once
+ * for the exponentials (written directly in the gradient) and the dot
+ * product of the labels with the shifted logits. The gradient row is
+ * then normalized while it is still in cache.
+ *
+ * \param logits The logits (2D)
+ * \param labels The labels (2D)
+ * \param gradient The gradient (softmax(logits) - labels)
+ * \param first The first row
+ * \param last The end of the rows
+ * \return the sum of the cross entropy losses of the rows
+ */
+template <typename O, typename L, typename G>
+value_t<O> softmax_cross_entropy_kernel(const O& logits, const L& labels, G& gradient, size_t first, size_t last) {
+    using T = value_t<O>;
+
+    const size_t n = etl::dim<1>(logits);
+
+    T loss(0);
+
+    for (size_t r = first; r < last; ++r) {
+        const size_t b = r * n;
+
+        T m = logits[b];
+
+        for (size_t j = b + 1; j < b + n; ++j) {
+            m = std::max(m, logits[j]);
+        }
+
+        T s   = 0;
+        T dot = 0;
+        T sum = 0;
+
+        for (size_t j = b; j < b + n; ++j) {
+            const T x = logits[j] - m;
+
+            gradient[j] = std::exp(x);
+            s += gradient[j];
+            dot += labels[j] * x;
+            sum += labels[j];
+        }
+
+        const T inv_s = T(1) / s;
+
+        for (size_t j = b; j < b + n; ++j) {
+            gradient[j] = gradient[j] * inv_s - labels[j];
+        }
+
+        // -sum(labels * (x - log(s))), with x the logits shifted by the maximum
+        loss += sum * std::log(s) - dot;
+    }
+
+    return loss;
+}
+
 } //end of namespace etl::impl::standard
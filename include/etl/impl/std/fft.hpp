@@ -562,6 +562,16 @@ void fft_n(const In* r_in, etl::complex<T>* r_out, const size_t n) {
     fft_perform(r_in, r_out, n, factors, n_factors, twiddle);
 }
 
+/*!
+ * \brief Indicates if a batch of 1D FFT should be dispatched in parallel
+ * \param batch The number of transforms
+ * \param n The size of each transform
+ * \return true if the transforms should be computed in parallel
+ */
+inline bool fft1_many_select_parallel(size_t batch, size_t n) {
+    return engine_select_parallel(batch, 2) && (batch >= fft1_many_threshold_transforms || n >= fft1_many_threshold_n);
+}
+
 /*!
  * \brief Compute many general FFT of all the signals in r_in
  * \param r_in The input signal
@@ -594,7 +604,7 @@ void fft_n_many(const In* r_in, etl::complex<T>* r_out, const size_t batch, cons
         }
     };
 
-    engine_dispatch_1d(batch_fun_b, 0, batch, 8UL);
+    engine_dispatch_1d(batch_fun_b, 0, batch, fft1_many_select_parallel(batch, n));
 }
 
 /*!
@@ -718,6 +728,413 @@ void ifft1_kernel(const std::complex<T>* a, size_t n, std::complex<T>* c) {
     }
 }
 
+/*!
+ * \brief Compute the inplace 1D FFT of x, selecting the best
+ * implementation between general FFT and radix 2 FFT
+ * \param x The signal to transform inplace
+ * \param n The size of the transform
+ */
+template <typename T>
+void inplace_fft1_kernel(etl::complex<T>* x, size_t n) {
+    if (n <= 131072 && math::is_power_of_two(n)) {
+        detail::inplace_radix2_fft1(x, n);
+    } else {
+        detail::fft_n(x, x, n);
+    }
+}
+
+/*!
+ * \brief Compute many inplace 1D FFT of the consecutive signals of x
+ * \param x The signals to transform inplace
+ * \param batch The number of signals
+ * \param n The size of each transform
+ */
+template <typename T>
+void inplace_fft1_many_kernel(etl::complex<T>* x, size_t batch, size_t n) {
+    if (n <= 65536 && math::is_power_of_two(n)) {
+        auto batch_fun_b = [&](const size_t first, const size_t last) {
+            for (size_t b = first; b < last; ++b) {
+                detail::inplace_radix2_fft1(x + b * n, n);
+            }
+        };
+
+        engine_dispatch_1d(batch_fun_b, 0, batch, fft1_many_select_parallel(batch, n));
+    } else {
+        detail::fft_n_many(x, x, batch, n);
+    }
+}
+
+/*!
+ * \brief Returns the number of columns that are transformed together
+ * during the column pass of a 2D FFT.
+ *
+ * The columns of a strip are gathered in a contiguous buffer that
+ * must stay in cache. When running in parallel, the strips are also
+ * limited so that each thread gets at least one.
+ *
+ * \param n1 The number of rows (size of the column transforms)
+ * \param n2 The number of columns
+ * \return the number of columns of each strip
+ */
+template <typename T>
+size_t fft2_column_strip(size_t n1, size_t n2) {
+    const size_t column_bytes = n1 * sizeof(etl::complex<T>);
+
+    size_t strip = std::max(size_t(8), (cache_size / 16) / column_bytes);
+
+    if (engine_select_parallel(n2, 2)) {
+        strip = std::min(strip, std::max(size_t(1), n2 / threads));
+    }
+
+    return std::min(strip, n2);
+}
+
+/*!
+ * \brief Compute the inplace 2D FFT of the row-major n1 x n2 matrix x.
+ *
+ * The rows are transformed in place in parallel. The columns are then
+ * transformed by strips: each strip of columns is transposed (by
+ * blocks) into a small contiguous buffer, transformed and transposed
+ * back. The strips are dispatched in parallel.
+ *
+ * \param x The matrix to transform inplace
+ * \param n1 The number of rows
+ * \param n2 The number of columns
+ */
+template <typename T>
+void inplace_fft2_kernel(etl::complex<T>* x, size_t n1, size_t n2) {
+    constexpr size_t block = 8;
+
+    // 1. Transform all the rows
+
+    inplace_fft1_many_kernel(x, n1, n2);
+
+    // 2. Transform all the columns, by strips
+
+    const size_t strip  = fft2_column_strip<T>(n1, n2);
+    const size_t strips = (n2 + strip - 1) / strip;
+
+    auto batch_fun_s = [&](const size_t first, const size_t last) {
+        auto buffer = allocate<etl::complex<T>>(strip * n1);
+        auto* tmp   = buffer.get();
+
+        for (size_t s = first; s < last; ++s) {
+            const size_t j_first = s * strip;
+            const size_t width   = std::min(strip, n2 - j_first);
+
+            // Blocked transpose x[:, j_first:j_first+width] -> tmp
+            for (size_t ii = 0; ii < n1; ii += block) {
+                const size_t i_last = std::min(ii + block, n1);
+
+                for (size_t jj = 0; jj < width; jj += block) {
+                    const size_t j_last = std::min(jj + block, width);
+
+                    for (size_t i = ii; i < i_last; ++i) {
+                        for (size_t j = jj; j < j_last; ++j) {
+                            tmp[j * n1 + i] = x[i * n2 + j_first + j];
+                        }
+                    }
+                }
+            }
+
+            inplace_fft1_many_kernel(tmp, width, n1);
+
+            // Blocked transpose tmp -> x[:, j_first:j_first+width]
+            for (size_t ii = 0; ii < n1; ii += block) {
+                const size_t i_last = std::min(ii + block, n1);
+
+                for (size_t jj = 0; jj < width; jj += block) {
+                    const size_t j_last = std::min(jj + block, width);
+
+                    for (size_t i = ii; i < i_last; ++i) {
+                        for (size_t j = jj; j < j_last; ++j) {
+                            x[i * n2 + j_first + j] = tmp[j * n1 + i];
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun_s, 0, strips, engine_select_parallel(strips, 2) && n1 * n2 >= fft2_many_threshold_n);
+}
+
+/*!
+ * \brief Compute many inplace 2D FFT of the consecutive row-major
+ * n1 x n2 matrices of x.
+ *
+ * When there are enough matrices (or when they are too small to be
+ * split efficiently), the matrices are dispatched in parallel and
+ * each one is transformed serially. Otherwise, the matrices are
+ * transformed one after another with parallel row and column passes.
+ *
+ * \param x The matrices to transform inplace
+ * \param batch The number of matrices
+ * \param n1 The number of rows of each matrix
+ * \param n2 The number of columns of each matrix
+ */
+template <typename T>
+void inplace_fft2_many_kernel(etl::complex<T>* x, size_t batch, size_t n1, size_t n2) {
+    const size_t n = n1 * n2;
+
+    if (batch >= fft2_many_threshold_transforms || n < fft2_many_threshold_n) {
+        auto batch_fun_b = [&](const size_t first, const size_t last) {
+            for (size_t b = first; b < last; ++b) {
+                inplace_fft2_kernel(x + b * n, n1, n2);
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun_b, 0, batch, engine_select_parallel(batch, 2));
+    } else {
+        for (size_t b = 0; b < batch; ++b) {
+            inplace_fft2_kernel(x + b * n, n1, n2);
+        }
+    }
+}
+
+/*!
+ * \brief Kernel for real-to-complex 1D FFT.
+ *
+ * Only the n / 2 + 1 first coefficients are computed, the others
+ * being given by Hermitian symmetry. For even sizes, the even and
+ * odd samples are packed as a single complex signal of size n / 2
+ * and the two half transforms are separated after a single complex
+ * FFT.
+ *
+ * \param a The real input signal
+ * \param n The size of the tranform
+ * \param c The output signal (n / 2 + 1 coefficients)
+ */
+template <typename TT, typename T>
+void rfft1_kernel(const TT* a, size_t n, etl::complex<T>* c) {
+    using complex_t = etl::complex<T>;
+
+    const size_t h = n / 2;
+
+    if (n % 2) {
+        auto tmp = allocate<complex_t>(n);
+
+        for (size_t i = 0; i < n; ++i) {
+            tmp[i] = complex_t(a[i], T(0));
+        }
+
+        inplace_fft1_kernel(tmp.get(), n);
+
+        std::copy_n(tmp.get(), h + 1, c);
+
+        return;
+    }
+
+    // 1. Pack the even samples as real and the odd samples as imaginary parts
+
+    for (size_t i = 0; i < h; ++i) {
+        c[i] = complex_t(a[2 * i], a[2 * i + 1]);
+    }
+
+    inplace_fft1_kernel(c, h);
+
+    // 2. Separate the FFT of the even and odd samples and combine them
+
+    const auto z0 = c[0];
+
+    c[0] = complex_t(z0.real + z0.imag, T(0));
+    c[h] = complex_t(z0.real - z0.imag, T(0));
+
+    constexpr double pi = M_PIl;
+
+    const etl::complex<double> wm(std::cos(-2.0 * pi / n), std::sin(-2.0 * pi / n));
+    etl::complex<double> w(1.0, 0.0);
+
+    for (size_t k = 1; k <= h / 2; ++k) {
+        w = w * wm;
+
+        const auto zk = c[k];
+        const auto zm = etl::conj(c[h - k]);
+
+        const complex_t fe = (zk + zm) * T(0.5);
+        const complex_t fd = zk - zm;
+        const complex_t fo(T(0.5) * fd.imag, T(-0.5) * fd.real);
+
+        const complex_t t = complex_t(T(w.real), T(w.imag)) * fo;
+
+        c[k]     = fe + t;
+        c[h - k] = etl::conj(fe - t);
+    }
+}
+
+/*!
+ * \brief Kernel for complex-to-real 1D Inverse FFT.
+ *
+ * This is the inverse of rfft1_kernel, only the n / 2 + 1 first
+ * coefficients of the input are used.
+ *
+ * \param a The input signal (n / 2 + 1 coefficients)
+ * \param n The size of the tranform
+ * \param c The real output signal
+ */
+template <typename T>
+void irfft1_kernel(const etl::complex<T>* a, size_t n, T* c) {
+    using complex_t = etl::complex<T>;
+
+    const size_t h = n / 2;
+
+    if (n % 2) {
+        auto tmp = allocate<complex_t>(n);
+
+        // Rebuild the full (conjugated) spectrum
+        tmp[0] = etl::conj(a[0]);
+        for (size_t k = 1; k <= h; ++k) {
+            tmp[k]     = etl::conj(a[k]);
+            tmp[n - k] = a[k];
+        }
+
+        inplace_fft1_kernel(tmp.get(), n);
+
+        for (size_t i = 0; i < n; ++i) {
+            c[i] = tmp[i].real / T(n);
+        }
+
+        return;
+    }
+
+    // The output is used directly as the packed complex signal
+    auto* z = reinterpret_cast<complex_t*>(c);
+
+    // 1. Merge the spectrum of the even and odd samples (conjugated for the inverse)
+
+    constexpr double pi = M_PIl;
+
+    const etl::complex<double> wm(std::cos(2.0 * pi / n), std::sin(2.0 * pi / n));
+    etl::complex<double> w(1.0, 0.0);
+
+    for (size_t k = 0; k < h; ++k) {
+        const auto xk = a[k];
+        const auto xm = etl::conj(a[h - k]);
+
+        const complex_t fe = (xk + xm) * T(0.5);
+        const complex_t fo = ((xk - xm) * T(0.5)) * complex_t(T(w.real), T(w.imag));
+
+        z[k] = complex_t(fe.real - fo.imag, -(fe.imag + fo.real));
+
+        w = w * wm;
+    }
+
+    // 2. Inverse FFT of the packed signal
+
+    inplace_fft1_kernel(z, h);
+
+    for (size_t k = 0; k < h; ++k) {
+        z[k] = complex_t(z[k].real / T(h), -z[k].imag / T(h));
+    }
+}
+
+/*!
+ * \brief Compute the real-to-complex 2D FFT of a zero-padded real matrix.
+ *
+ * The result is stored transposed, as (s2 / 2 + 1) rows of s1
+ * coefficients, since this is the natural layout after the column
+ * transforms and point-wise operations do not need the rows order.
+ *
+ * \param a The real input matrix
+ * \param m1 The first dimension of the input
+ * \param m2 The second dimension of the input
+ * \param s1 The first dimension of the padded transform
+ * \param s2 The second dimension of the padded transform
+ * \param c The output spectrum ((s2 / 2 + 1) * s1 coefficients)
+ */
+template <typename TT, typename T>
+void rfft2_padded_kernel(const TT* a, size_t m1, size_t m2, size_t s1, size_t s2, etl::complex<T>* c) {
+    const size_t h2 = s2 / 2 + 1;
+
+    auto rows = allocate<etl::complex<T>>(s1 * h2);
+    auto row  = allocate<T>(s2);
+
+    // 1. Real FFT of each row (the padding rows have a null transform)
+
+    for (size_t i = 0; i < m1; ++i) {
+        std::copy_n(a + i * m2, m2, row.get());
+
+        rfft1_kernel(row.get(), s2, rows.get() + i * h2);
+    }
+
+    // 2. Transpose the half spectrum
+
+    for (size_t i = 0; i < s1; ++i) {
+        for (size_t j = 0; j < h2; ++j) {
+            c[j * s1 + i] = rows[i * h2 + j];
+        }
+    }
+
+    // 3. FFT of each column
+
+    inplace_fft1_many_kernel(c, h2, s1);
+}
+
+/*!
+ * \brief Compute the complex-to-real 2D Inverse FFT of a spectrum
+ * computed by rfft2_padded_kernel and store the cropped result in c
+ *
+ * \param x The input spectrum, it is used as workspace
+ * \param s1 The first dimension of the transform
+ * \param s2 The second dimension of the transform
+ * \param o2 The second dimension of the output (o2 <= s2)
+ * \param c The output matrix (s1 * o2)
+ * \param beta Indicates how the output is modified c = beta * c + o
+ */
+template <typename T, typename T3>
+void irfft2_padded_kernel(etl::complex<T>* x, size_t s1, size_t s2, size_t o2, T3* c, T3 beta) {
+    const size_t h2 = s2 / 2 + 1;
+
+    // 1. Inverse FFT of each column
+
+    for (size_t i = 0; i < h2 * s1; ++i) {
+        x[i] = etl::conj(x[i]);
+    }
+
+    inplace_fft1_many_kernel(x, h2, s1);
+
+    // 2. Transpose back the half spectrum
+
+    auto rows = allocate<etl::complex<T>>(s1 * h2);
+    auto row  = allocate<T>(s2);
+
+    for (size_t j = 0; j < h2; ++j) {
+        for (size_t i = 0; i < s1; ++i) {
+            rows[i * h2 + j] = etl::conj(x[j * s1 + i]) / T(s1);
+        }
+    }
+
+    // 3. Real Inverse FFT of each row
+
+    for (size_t i = 0; i < s1; ++i) {
+        irfft1_kernel(rows.get() + i * h2, s2, row.get());
+
+        if (beta == T3(0.0)) {
+            for (size_t j = 0; j < o2; ++j) {
+                c[i * o2 + j] = row[j];
+            }
+        } else {
+            for (size_t j = 0; j < o2; ++j) {
+                c[i * o2 + j] = beta * c[i * o2 + j] + row[j];
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Returns the size of the real transform to use for a full
+ * convolution of the given size.
+ *
+ * The real transforms are only efficient for even sizes and the
+ * padding does not change the result of a full convolution.
+ *
+ * \param n The size of the full convolution
+ * \return The size of the transform
+ */
+inline size_t rfft_conv_size(size_t n) {
+    return n + (n & 1);
+}
+
 /*!
  * \brief Performs a 1D full convolution using FFT
  * \param a The input
@@ -729,31 +1146,36 @@ void ifft1_kernel(const std::complex<T>* a, size_t n, std::complex<T>* c) {
 template <typename T>
 void conv1_full_kernel(const T* a, size_t m, const T* b, size_t n, T* c) {
     const size_t size = m + n - 1;
+    const size_t s    = rfft_conv_size(size);
+    const size_t h    = s / 2 + 1;
 
-    dyn_matrix<etl::complex<T>, 1> a_padded(size);
-    dyn_matrix<etl::complex<T>, 1> b_padded(size);
-
-    direct_copy(a, a + m, a_padded.memory_start());
-    direct_copy(b, b + n, b_padded.memory_start());
+    // 0. Pad a and b to the size of the transform
 
-    detail::fft1_kernel(reinterpret_cast<std::complex<T>*>(a_padded.memory_start()), size, reinterpret_cast<std::complex<T>*>(a_padded.memory_start()));
-    detail::fft1_kernel(reinterpret_cast<std::complex<T>*>(b_padded.memory_start()), size, reinterpret_cast<std::complex<T>*>(b_padded.memory_start()));
+    auto a_padded = allocate<T>(s);
+    auto b_padded = allocate<T>(s);
 
-    a_padded.validate_cpu();
-    a_padded.invalidate_gpu();
+    direct_copy(a, a + m, a_padded.get());
+    direct_copy(b, b + n, b_padded.get());
 
-    b_padded.validate_cpu();
-    b_padded.invalidate_gpu();
+    // 1. Real FFT of a and b
 
-    a_padded *= b_padded;
+    auto a_fft = allocate<etl::complex<T>>(h);
+    auto b_fft = allocate<etl::complex<T>>(h);
 
-    a_padded.ensure_cpu_up_to_date();
+    rfft1_kernel(a_padded.get(), s, a_fft.get());
+    rfft1_kernel(b_padded.get(), s, b_fft.get());
 
-    detail::ifft1_kernel(reinterpret_cast<std::complex<T>*>(a_padded.memory_start()), size, reinterpret_cast<std::complex<T>*>(a_padded.memory_start()));
+    // 2. Elementwise multiplication of a and b
 
-    for (size_t i = 0; i < size; ++i) {
-        c[i] = a_padded[i].real;
+    for (size_t i = 0; i < h; ++i) {
+        a_fft[i] *= b_fft[i];
     }
+
+    // 3. Real Inverse FFT
+
+    irfft1_kernel(a_fft.get(), s, a_padded.get());
+
+    direct_copy(a_padded.get(), a_padded.get() + size, c);
 }
 
 /*!
@@ -772,71 +1194,26 @@ void conv2_full_kernel(const T1* a, size_t m1, size_t m2, const T2* b, size_t n1
     CPU_SECTION {
         const size_t s1 = m1 + n1 - 1;
         const size_t s2 = m2 + n2 - 1;
-        const size_t n  = s1 * s2;
+        const size_t t2 = rfft_conv_size(s2);
+        const size_t n  = (t2 / 2 + 1) * s1;
 
-        // 0. Pad a and b to the size of c
+        // 1. Real FFT of a and b
 
-        dyn_matrix<etl::complex<T1>, 2> a_padded(s1, s2);
-        dyn_matrix<etl::complex<T2>, 2> b_padded(s1, s2);
+        auto a_fft = allocate<etl::complex<T3>>(n);
+        auto b_fft = allocate<etl::complex<T3>>(n);
 
-        for (size_t i = 0; i < m1; ++i) {
-            direct_copy_n(a + i * m2, a_padded.memory_start() + i * s2, m2);
-        }
+        rfft2_padded_kernel(a, m1, m2, s1, t2, a_fft.get());
+        rfft2_padded_kernel(b, n1, n2, s1, t2, b_fft.get());
 
-        a_padded.validate_cpu();
-        a_padded.invalidate_gpu();
+        // 2. Elementwise multiplication of a and b
 
-        for (size_t i = 0; i < n1; ++i) {
-            direct_copy_n(b + i * n2, b_padded.memory_start() + i * s2, n2);
+        for (size_t i = 0; i < n; ++i) {
+            a_fft[i] *= b_fft[i];
         }
 
-        b_padded.validate_cpu();
-        b_padded.invalidate_gpu();
-
-        // 1. FFT of a and b
-
-        // a = fft2(a)
-        detail::safe_fft_n_many_inplace(a_padded, s1, s2);
-        a_padded.transpose_inplace();
-        detail::safe_fft_n_many_inplace(a_padded, s2, s1);
-        a_padded.transpose_inplace();
-
-        // b = fft2(b)
-        detail::safe_fft_n_many_inplace(b_padded, s1, s2);
-        b_padded.transpose_inplace();
-        detail::safe_fft_n_many_inplace(b_padded, s2, s1);
-        b_padded.transpose_inplace();
-
-        // 2. Elementwise multiplication of and b
-
-        a_padded >>= b_padded;
-
-        // 3. Inverse FFT of a
-
-        // a = conj(a)
-        a_padded = conj(a_padded);
-
-        // a = fft2(a)
-        detail::safe_fft_n_many_inplace(a_padded, s1, s2);
-        a_padded.transpose_inplace();
-        detail::safe_fft_n_many_inplace(a_padded, s2, s1);
-        a_padded.transpose_inplace();
-
-        // 4. Keep only the real part of the inverse FFT
-
-        a_padded.ensure_cpu_up_to_date();
+        // 3. Real Inverse FFT of a
 
-        // c = real(conj(a) / n)
-        // Note: Since the conjugate does not change the real part, it is not necessary
-        if (beta == T3(0.0)) {
-            for (size_t i = 0; i < n; ++i) {
-                c[i] = a_padded[i].real / T3(n);
-            }
-        } else {
-            for (size_t i = 0; i < n; ++i) {
-                c[i] = beta * c[i] + a_padded[i].real / T3(n);
-            }
-        }
+        irfft2_padded_kernel(a_fft.get(), s1, t2, s2, c, beta);
     }
 }
 
@@ -917,6 +1294,102 @@ void ifft1_real(A&& a, C&& c) {
     c.invalidate_gpu();
 }
 
+/*!
+ * \brief Perform the real-to-complex 1D FFT on a and store the result in c
+ * \param a The input expression
+ * \param c The output expression (N / 2 + 1 coefficients)
+ */
+template <typename A, typename C>
+void rfft1(A&& a, C&& c) {
+    using T = typename value_t<C>::value_type;
+
+    a.ensure_cpu_up_to_date();
+
+    detail::rfft1_kernel(a.memory_start(), etl::size(a), reinterpret_cast<etl::complex<T>*>(c.memory_start()));
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Perform the complex-to-real 1D Inverse FFT on a and store the result in c
+ * \param a The input expression (N / 2 + 1 coefficients)
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void irfft1(A&& a, C&& c) {
+    using T = value_t<C>;
+
+    a.ensure_cpu_up_to_date();
+
+    detail::irfft1_kernel(reinterpret_cast<const etl::complex<T>*>(a.memory_start()), etl::size(c), c.memory_start());
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Perform the real-to-complex 2D FFT on a and store the result in c
+ * \param a The input expression
+ * \param c The output expression (N1 * (N2 / 2 + 1) coefficients)
+ */
+template <typename A, typename C>
+void rfft2(A&& a, C&& c) {
+    using T = typename value_t<C>::value_type;
+
+    const size_t n1 = etl::dim<0>(a);
+    const size_t n2 = etl::dim<1>(a);
+    const size_t h2 = n2 / 2 + 1;
+
+    a.ensure_cpu_up_to_date();
+
+    auto tmp = allocate<etl::complex<T>>(h2 * n1);
+
+    detail::rfft2_padded_kernel(a.memory_start(), n1, n2, n1, n2, tmp.get());
+
+    auto* cc = reinterpret_cast<etl::complex<T>*>(c.memory_start());
+
+    for (size_t i = 0; i < n1; ++i) {
+        for (size_t j = 0; j < h2; ++j) {
+            cc[i * h2 + j] = tmp[j * n1 + i];
+        }
+    }
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Perform the complex-to-real 2D Inverse FFT on a and store the result in c
+ * \param a The input expression (N1 * (N2 / 2 + 1) coefficients)
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void irfft2(A&& a, C&& c) {
+    using T = value_t<C>;
+
+    const size_t n1 = etl::dim<0>(c);
+    const size_t n2 = etl::dim<1>(c);
+    const size_t h2 = n2 / 2 + 1;
+
+    a.ensure_cpu_up_to_date();
+
+    auto tmp = allocate<etl::complex<T>>(h2 * n1);
+
+    const auto* aa = reinterpret_cast<const etl::complex<T>*>(a.memory_start());
+
+    for (size_t i = 0; i < n1; ++i) {
+        for (size_t j = 0; j < h2; ++j) {
+            tmp[j * n1 + i] = aa[i * h2 + j];
+        }
+    }
+
+    detail::irfft2_padded_kernel(tmp.get(), n1, n2, n2, c.memory_start(), T(0.0));
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
 /*!
  * \brief Perform many 1D FFT on a and store the result in c
  * \param a The input expression
@@ -940,7 +1413,7 @@ void fft1_many_kernel(const A* a, C* c, size_t batch, size_t n) {
             }
         };
 
-        engine_dispatch_1d(batch_fun_b, 0, batch, 8UL);
+        engine_dispatch_1d(batch_fun_b, 0, batch, detail::fft1_many_select_parallel(batch, n));
     } else {
         detail::fft_n_many(a, reinterpret_cast<etl::complex<typename C::value_type>*>(c), batch, n);
     }
@@ -975,20 +1448,18 @@ void fft1_many(A&& a, C&& c) {
  */
 template <typename A, typename C>
 void fft2(A&& a, C&& c) {
-    //Note: We need dyn here because of transposition inplace
-    auto w = etl::force_temporary_dyn(c);
-
-    //Perform FFT on each rows
-    fft1_many(a, w);
+    using T = typename value_t<C>::value_type;
 
-    w.transpose_inplace();
+    a.ensure_cpu_up_to_date();
 
-    //Perform FFT on each columns
-    fft1_many(w, w);
+    if (reinterpret_cast<const void*>(a.memory_start()) != reinterpret_cast<const void*>(c.memory_start())) {
+        std::copy(a.memory_start(), a.memory_end(), c.memory_start());
+    }
 
-    w.transpose_inplace();
+    detail::inplace_fft2_kernel(reinterpret_cast<etl::complex<T>*>(c.memory_start()), etl::dim<0>(c), etl::dim<1>(c));
 
-    c = w;
+    c.validate_cpu();
+    c.invalidate_gpu();
 }
 
 /*!
@@ -1066,18 +1537,24 @@ void ifft2_real(A&& a, C&& c) {
  */
 template <typename A, typename C>
 void fft2_many(A&& a, C&& c) {
-    //Note: we need dyn matrix for inplace rectangular transpose
-    auto w = etl::force_temporary_dyn(c);
+    using T = typename value_t<C>::value_type;
 
-    fft1_many(a, w);
+    static constexpr size_t D = etl::dimensions<C>();
 
-    w.deep_transpose_inplace();
+    a.ensure_cpu_up_to_date();
 
-    fft1_many(w, w);
+    if (reinterpret_cast<const void*>(a.memory_start()) != reinterpret_cast<const void*>(c.memory_start())) {
+        std::copy(a.memory_start(), a.memory_end(), c.memory_start());
+    }
+
+    const size_t n1    = etl::dim<D - 2>(c);
+    const size_t n2    = etl::dim<D - 1>(c);
+    const size_t batch = etl::size(c) / (n1 * n2);
 
-    w.deep_transpose_inplace();
+    detail::inplace_fft2_many_kernel(reinterpret_cast<etl::complex<T>*>(c.memory_start()), batch, n1, n2);
 
-    c = w;
+    c.validate_cpu();
+    c.invalidate_gpu();
 }
 
 /*!
@@ -1160,9 +1637,7 @@ void conv2_full_fft_flipped(II&& a, KK&& b, CC&& c) {
  */
 template <typename II, typename KK, typename CC>
 void conv2_full_multi_fft(const II& input, const KK& kernel, CC& conv) {
-    using T1 = value_t<II>;
-    using T2 = value_t<KK>;
-    using T3 = value_t<CC>;
+    using T = value_t<CC>;
 
     const auto K = etl::dim<0>(kernel);
 
@@ -1181,78 +1656,27 @@ void conv2_full_multi_fft(const II& input, const KK& kernel, CC& conv) {
 
         const auto s1 = m1 + n1 - 1;
         const auto s2 = m2 + n2 - 1;
-        const auto n  = s1 * s2;
-
-        dyn_matrix<etl::complex<T1>, 2> a_padded(s1, s2);
-        a_padded = 0;
+        const auto t2 = detail::rfft_conv_size(s2);
+        const auto n  = (t2 / 2 + 1) * s1;
 
-        a_padded.ensure_cpu_up_to_date();
-
-        for (size_t i = 0; i < m1; ++i) {
-            direct_copy_n(input.memory_start() + i * m2, a_padded.memory_start() + i * s2, m2);
-        }
-
-        a_padded.validate_cpu();
-        a_padded.invalidate_gpu();
-
-        // a = fft2(a)
-        detail::safe_fft_n_many_inplace(a_padded, s1, s2);
-        a_padded.transpose_inplace();
-        detail::safe_fft_n_many_inplace(a_padded, s2, s1);
-        a_padded.transpose_inplace();
+        // a = rfft2(a)
+        auto a_fft = allocate<etl::complex<T>>(n);
+        detail::rfft2_padded_kernel(input.memory_start(), m1, m2, s1, t2, a_fft.get());
 
         auto batch_fun_k = [&](const size_t first, const size_t last) {
-            for (size_t k = first; k < last; ++k) {
-                const auto* b = kernel.memory_start() + k * k_s;
-                auto* c       = conv.memory_start() + k * c_s;
+            auto b_fft = allocate<etl::complex<T>>(n);
 
-                // 0. Pad a and b to the size of c
-
-                dyn_matrix<etl::complex<T2>, 2> b_padded(s1, s2);
-                b_padded = 0;
-
-                b_padded.ensure_cpu_up_to_date();
+            for (size_t k = first; k < last; ++k) {
+                // b = rfft2(b)
+                detail::rfft2_padded_kernel(kernel.memory_start() + k * k_s, n1, n2, s1, t2, b_fft.get());
 
-                for (size_t i = 0; i < n1; ++i) {
-                    direct_copy_n(b + i * n2, b_padded.memory_start() + i * s2, n2);
+                // Elementwise multiplication of a and b
+                for (size_t i = 0; i < n; ++i) {
+                    b_fft[i] *= a_fft[i];
                 }
 
-                b_padded.validate_cpu();
-                b_padded.invalidate_gpu();
-
-                // 1. FFT of a and b
-
-                // b = fft2(b)
-                detail::safe_fft_n_many_inplace(b_padded, s1, s2);
-                b_padded.transpose_inplace();
-                detail::safe_fft_n_many_inplace(b_padded, s2, s1);
-                b_padded.transpose_inplace();
-
-                // 2. Elementwise multiplication of and b
-
-                b_padded >>= a_padded;
-
-                // 3. Inverse FFT of a
-
-                // a = conj(a)
-                b_padded = conj(b_padded);
-
-                // a = fft2(a)
-                detail::safe_fft_n_many_inplace(b_padded, s1, s2);
-                b_padded.transpose_inplace();
-                detail::safe_fft_n_many_inplace(b_padded, s2, s1);
-                b_padded.transpose_inplace();
-
-                // 4. Keep only the real part of the inverse FFT
-
-                // c = real(conj(a) / n)
-                // Note: Since the conjugate does not change the real part, it is not necessary
-
-                b_padded.ensure_cpu_up_to_date();
-
-                for (size_t i = 0; i < etl::size(b_padded); ++i) {
-                    c[i] = b_padded[i].real / T3(n);
-                }
+                // c = irfft2(b)
+                detail::irfft2_padded_kernel(b_fft.get(), s1, t2, s2, conv.memory_start() + k * c_s, T(0.0));
             }
         };
 
@@ -1293,9 +1717,7 @@ void conv2_full_multi_flipped_fft(II&& input, KK&& kernel, CC&& conv) {
  */
 template <typename II, typename KK, typename CC>
 void conv4_full_fft(II&& input, KK&& kernel, CC&& conv) {
-    using T1 = value_t<II>;
-    using T2 = value_t<KK>;
-    using T3 = value_t<CC>;
+    using T = value_t<CC>;
 
     if (etl::dim<1>(kernel) > 0) {
         input.ensure_cpu_up_to_date();
@@ -1318,93 +1740,64 @@ void conv4_full_fft(II&& input, KK&& kernel, CC&& conv) {
 
         const size_t s1 = m1 + n1 - 1;
         const size_t s2 = m2 + n2 - 1;
-        const size_t n  = s1 * s2;
+        const size_t t2 = detail::rfft_conv_size(s2);
+        const size_t n  = (t2 / 2 + 1) * s1;
 
         const size_t N = etl::dim<0>(input);
+        const size_t K = etl::dim<0>(kernel);
+        const size_t C = etl::dim<1>(kernel);
 
-        std::fill(conv.memory_start(), conv.memory_end(), 0);
-
-        conv.invalidate_gpu();
-        conv.validate_cpu();
-
-        auto batch_fun_n = [&](const size_t first, const size_t last) {
-            for (size_t i = first; i < last; ++i) {
-                for (size_t k = 0; k < etl::dim<0>(kernel); ++k) {
-                    const auto* a = input.memory_start() + i * input_i_inc + k * input_k_inc; //input(i)(k)
-
-                    dyn_matrix<etl::complex<T1>, 2> a_padded(s1, s2);
-                    dyn_matrix<etl::complex<T2>, 2> b_padded(s1, s2);
-                    dyn_matrix<etl::complex<T1>, 2> tmp(s1, s2);
-
-                    a_padded = 0;
-
-                    a_padded.ensure_cpu_up_to_date();
-
-                    for (size_t i = 0; i < m1; ++i) {
-                        direct_copy_n(a + i * m2, a_padded.memory_start() + i * s2, m2);
-                    }
+        // 1. Real FFT of all the kernels
 
-                    a_padded.invalidate_gpu();
+        auto b_fft = allocate<etl::complex<T>>(K * C * n);
 
-                    // a = fft2(a)
-                    detail::safe_fft_n_many_inplace(a_padded, s1, s2);
-                    a_padded.transpose_inplace();
-                    detail::safe_fft_n_many_inplace(a_padded, s2, s1);
-                    a_padded.transpose_inplace();
+        auto batch_fun_kc = [&](const size_t first, const size_t last) {
+            for (size_t kc = first; kc < last; ++kc) {
+                const size_t k = kc / C;
+                const size_t c = kc % C;
 
-                    for (size_t c = 0; c < etl::dim<1>(kernel); ++c) {
-                        const auto* b = kernel.memory_start() + k * kernel_k_inc + c * kernel_c_inc; //kernel(k)(c)
-                        auto* cc      = conv.memory_start() + i * conv_i_inc + c * conv_c_inc;       //conv(i)(c)
-
-                        // 0. Pad a and b to the size of cc
-
-                        b_padded = 0;
-
-                        b_padded.ensure_cpu_up_to_date();
-
-                        for (size_t i = 0; i < n1; ++i) {
-                            direct_copy_n(b + i * n2, b_padded.memory_start() + i * s2, n2);
-                        }
+                const auto* b = kernel.memory_start() + k * kernel_k_inc + c * kernel_c_inc; //kernel(k)(c)
 
-                        b_padded.invalidate_gpu();
-
-                        // 1. FFT of a and b
+                detail::rfft2_padded_kernel(b, n1, n2, s1, t2, b_fft.get() + kc * n);
+            }
+        };
 
-                        // b = fft2(b)
-                        detail::safe_fft_n_many_inplace(b_padded, s1, s2);
-                        b_padded.transpose_inplace();
-                        detail::safe_fft_n_many_inplace(b_padded, s2, s1);
-                        b_padded.transpose_inplace();
+        engine_dispatch_1d_serial_cpu(batch_fun_kc, 0, K * C, 2UL);
 
-                        // 2. Elementwise multiplication of and b
+        // 2. Real FFT of the images and accumulation of the products in the frequency domain
 
-                        tmp = a_padded >> b_padded;
+        auto batch_fun_n = [&](const size_t first, const size_t last) {
+            auto a_fft = allocate<etl::complex<T>>(K * n);
+            auto tmp   = allocate<etl::complex<T>>(n);
 
-                        // 3. Inverse FFT of a
+            for (size_t i = first; i < last; ++i) {
+                for (size_t k = 0; k < K; ++k) {
+                    const auto* a = input.memory_start() + i * input_i_inc + k * input_k_inc; //input(i)(k)
 
-                        // a = conj(a)
-                        for (size_t i = 0; i < n; ++i) {
-                            tmp[i] = etl::conj(tmp[i]);
-                        }
+                    detail::rfft2_padded_kernel(a, m1, m2, s1, t2, a_fft.get() + k * n);
+                }
 
-                        // a = fft2(a)
-                        detail::safe_fft_n_many_inplace(tmp, s1, s2);
-                        tmp.transpose_inplace();
-                        detail::safe_fft_n_many_inplace(tmp, s2, s1);
-                        tmp.transpose_inplace();
+                for (size_t c = 0; c < C; ++c) {
+                    std::fill_n(tmp.get(), n, etl::complex<T>(T(0.0), T(0.0)));
 
-                        // 4. Keep only the real part of the inverse FFT
+                    for (size_t k = 0; k < K; ++k) {
+                        const auto* a_k  = a_fft.get() + k * n;
+                        const auto* b_kc = b_fft.get() + (k * C + c) * n;
 
-                        for (size_t i = 0; i < n; ++i) {
-                            cc[i] += tmp[i].real / T3(n);
+                        for (size_t j = 0; j < n; ++j) {
+                            tmp[j] += a_k[j] * b_kc[j];
                         }
                     }
+
+                    // conv(i)(c) = irfft2(sum(a(k) >> b(k)(c)))
+                    detail::irfft2_padded_kernel(tmp.get(), s1, t2, s2, conv.memory_start() + i * conv_i_inc + c * conv_c_inc, T(0.0));
                 }
             }
         };
 
         engine_dispatch_1d_serial_cpu(batch_fun_n, 0, N, 2UL);
 
+        conv.validate_cpu();
         conv.invalidate_gpu();
     }
 }
@@ -0,0 +1,44 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the "max_index" and "min_index"
+ * reductions
+ */
+
+#pragma once
+
+namespace etl::impl::standard {
+
+/*!
+ * \brief Returns the index of the first maximum (or minimum) element of
+ * values in the range [first, last)
+ * \param values The expression to search
+ * \param first The beginning of the range
+ * \param last The end of the range (must be bigger than first)
+ * \tparam Max true to search the maximum, false to search the minimum
+ * \return The index of the first maximum (or minimum) element in the range
+ */
+template <bool Max, typename E>
+size_t index_kernel(const E& values, size_t first, size_t last) {
+    size_t m = first;
+    auto best = values[first];
+
+    for (size_t i = first + 1; i < last; ++i) {
+        auto value = values[i];
+
+        if (Max ? value > best : value < best) {
+            m    = i;
+            best = value;
+        }
+    }
+
+    return m;
+}
+
+} //end of namespace etl::impl::standard
@@ -0,0 +1,255 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the sparse matrix products (SpMV and
+ * SpMM).
+ *
+ * The kernels work directly on the compressed storage (CSR or CSC) of
+ * the sparse operand. COO operands are first converted to CSR, which is
+ * linear in the number of non-zeros.
+ */
+
+#pragma once
+
+namespace etl::impl::standard {
+
+namespace detail {
+
+/*!
+ * \brief Returns a compressed version of the given sparse matrix. A COO
+ * matrix is converted to CSR, a compressed matrix is forwarded as is.
+ * \param a The sparse matrix
+ * \return a compressed sparse matrix
+ */
+template <typename A>
+decltype(auto) compressed_forward(const A& a) {
+    if constexpr (std::decay_t<A>::storage_format == sparse_storage::COO) {
+        return sparse_matrix_impl<value_t<A>, sparse_storage::CSR, 2>(a);
+    } else {
+        return a;
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the product of a sparse matrix and a dense vector, c = a * b
+ * \param a The sparse matrix
+ * \param b The dense vector
+ * \param c The output vector
+ */
+template <typename A, typename B, typename C>
+void spmv(const A& a, const B& b, C&& c) {
+    using T = value_t<A>;
+
+    decltype(auto) s = detail::compressed_forward(a);
+
+    const auto* values = s.values();
+    const auto* inner  = s.inner_index();
+    const auto* outer  = s.outer_index();
+
+    if constexpr (std::decay_t<decltype(s)>::row_compressed) {
+        auto batch_fun = [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                T r1(0);
+                T r2(0);
+
+                size_t n = outer[i];
+
+                for (; n + 1 < outer[i + 1]; n += 2) {
+                    r1 += values[n] * b[inner[n]];
+                    r2 += values[n + 1] * b[inner[n + 1]];
+                }
+
+                if (n < outer[i + 1]) {
+                    r1 += values[n] * b[inner[n]];
+                }
+
+                c[i] = r1 + r2;
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, etl::rows(s), engine_select_parallel(s.non_zeros(), sparse_parallel_threshold));
+    } else {
+        const size_t m = etl::rows(s);
+        const size_t n = etl::columns(s);
+
+        // Accumulate the contributions of the columns [first, last) in r
+        auto column_fun = [&](auto&& r, size_t first, size_t last) {
+            for (size_t j = first; j < last; ++j) {
+                const T bj = b[j];
+
+                for (size_t p = outer[j]; p < outer[j + 1]; ++p) {
+                    r[inner[p]] += values[p] * bj;
+                }
+            }
+        };
+
+        if (n > 1 && engine_select_parallel(s.non_zeros(), sparse_parallel_threshold)) {
+            // Each block of columns is accumulated in its own partial
+            // output, the partial outputs are then summed
+            const size_t blocks = std::min(n, etl::threads);
+            const size_t batch  = n / blocks;
+
+            std::vector<T> partials(blocks * m, T(0));
+
+            auto block_fun = [&](size_t first, size_t last) {
+                for (size_t t = first; t < last; ++t) {
+                    column_fun(partials.data() + t * m, t * batch, t == blocks - 1 ? n : (t + 1) * batch);
+                }
+            };
+
+            engine_dispatch_1d_serial(block_fun, 0, blocks, true);
+
+            auto reduce_fun = [&](size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) {
+                    T r(0);
+
+                    for (size_t t = 0; t < blocks; ++t) {
+                        r += partials[t * m + i];
+                    }
+
+                    c[i] = r;
+                }
+            };
+
+            engine_dispatch_1d_serial(reduce_fun, 0, m, engine_select_parallel(m * blocks, sparse_parallel_threshold));
+        } else {
+            c = 0;
+
+            column_fun(c, 0, n);
+        }
+    }
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the product of a sparse matrix and a dense matrix, c = a * b
+ * \param a The sparse matrix
+ * \param b The dense matrix
+ * \param c The output matrix
+ */
+template <typename A, typename B, typename C>
+void spmm(const A& a, const B& b, C&& c) {
+    using T = value_t<A>;
+
+    decltype(auto) s = detail::compressed_forward(a);
+
+    const auto* values = s.values();
+    const auto* inner  = s.inner_index();
+    const auto* outer  = s.outer_index();
+
+    const size_t n = etl::columns(b);
+
+    if constexpr (std::decay_t<decltype(s)>::row_compressed) {
+        // Each row of c is a combination of the rows of b
+        auto batch_fun = [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    c(i, j) = T(0);
+                }
+
+                for (size_t p = outer[i]; p < outer[i + 1]; ++p) {
+                    const T v      = values[p];
+                    const size_t k = inner[p];
+
+                    for (size_t j = 0; j < n; ++j) {
+                        c(i, j) += v * b(k, j);
+                    }
+                }
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, etl::rows(s), engine_select_parallel(s.non_zeros() * n, sparse_parallel_threshold));
+    } else {
+        // The columns of c are split between the threads
+        auto batch_fun = [&](size_t first, size_t last) {
+            for (size_t i = 0; i < etl::rows(s); ++i) {
+                for (size_t j = first; j < last; ++j) {
+                    c(i, j) = T(0);
+                }
+            }
+
+            for (size_t k = 0; k < etl::columns(s); ++k) {
+                for (size_t p = outer[k]; p < outer[k + 1]; ++p) {
+                    const T v      = values[p];
+                    const size_t i = inner[p];
+
+                    for (size_t j = first; j < last; ++j) {
+                        c(i, j) += v * b(k, j);
+                    }
+                }
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, n, engine_select_parallel(s.non_zeros() * n, sparse_parallel_threshold));
+    }
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the product of a dense matrix and a sparse matrix, c = a * b
+ * \param a The dense matrix
+ * \param b The sparse matrix
+ * \param c The output matrix
+ */
+template <typename A, typename B, typename C>
+void dense_spmm(const A& a, const B& b, C&& c) {
+    using T = value_t<B>;
+
+    decltype(auto) s = detail::compressed_forward(b);
+
+    const auto* values = s.values();
+    const auto* inner  = s.inner_index();
+    const auto* outer  = s.outer_index();
+
+    const size_t m = etl::rows(a);
+    const size_t k = etl::columns(a);
+    const size_t n = etl::columns(s);
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            if constexpr (std::decay_t<decltype(s)>::row_compressed) {
+                // Each row of c is a combination of the rows of b
+                for (size_t j = 0; j < n; ++j) {
+                    c(i, j) = T(0);
+                }
+
+                for (size_t kk = 0; kk < k; ++kk) {
+                    const T aik = a(i, kk);
+
+                    if (aik != T(0)) {
+                        for (size_t p = outer[kk]; p < outer[kk + 1]; ++p) {
+                            c(i, inner[p]) += aik * values[p];
+                        }
+                    }
+                }
+            } else {
+                // Each element of c is a sparse dot product
+                for (size_t j = 0; j < n; ++j) {
+                    T r(0);
+
+                    for (size_t p = outer[j]; p < outer[j + 1]; ++p) {
+                        r += a(i, inner[p]) * values[p];
+                    }
+
+                    c(i, j) = r;
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, m, engine_select_parallel(s.non_zeros() * m, sparse_parallel_threshold));
+
+    c.invalidate_gpu();
+}
+
+} //end of namespace etl::impl::standard
@@ -12,8 +12,62 @@
 
 #pragma once
 
+#include "etl/impl/common/reduce.hpp"
+
 namespace etl::impl::standard {
 
+namespace detail {
+
+/*!
+ * \brief Compute the sum of f(sub[i]) for i in [first, last)
+ *
+ * When compensated summation is enabled, the block is accumulated
+ * with Kahan summation.
+ *
+ * \param sub The input expression
+ * \param first The first index of the block
+ * \param last The end of the block
+ * \param f The functor to apply on each element
+ * \return the sum of the block
+ */
+template <typename T, typename E, typename F>
+T sum_kernel(const E& sub, size_t first, size_t last, F&& f) {
+    T acc(0);
+
+    if constexpr (compensated_sum) {
+        T c(0);
+
+        for (size_t i = first; i < last; ++i) {
+            T y = f(sub[i]) - c;
+            T t = acc + y;
+            c   = (t - acc) - y;
+            acc = t;
+        }
+    } else {
+        for (size_t i = first; i < last; ++i) {
+            acc += f(sub[i]);
+        }
+    }
+
+    return acc;
+}
+
+/*!
+ * \brief Compute the pairwise sum of f(sub[i]) for all elements of sub
+ * \param sub The input expression
+ * \param f The functor to apply on each element
+ * \return the sum
+ */
+template <typename T, typename E, typename F>
+T pairwise_sum(const E& sub, F&& f) {
+    auto kernel  = [&sub, &f](size_t first, size_t last) { return sum_kernel<T>(sub, first, last, f); };
+    auto combine = [](T a, T b) { return a + b; };
+
+    return common::pairwise_reduce<T>(0, etl::size(sub), kernel, combine);
+}
+
+} //end of namespace detail
+
 /*!
  * \brief Compute the sum of the input in the given expression
  * \param input The input expression
@@ -23,23 +77,9 @@ template <typename E>
 value_t<E> sum(const E& input) {
     using T = value_t<E>;
 
-    T acc(0);
-
-    auto acc_functor = [&acc](T value) { acc += value; };
-
-    auto batch_fun = [](auto& sub) {
-        T acc(0);
-
-        for (size_t i = 0; i < etl::size(sub); ++i) {
-            acc += sub[i];
-        }
-
-        return acc;
-    };
-
-    engine_dispatch_1d_acc_slice(input, batch_fun, acc_functor, sum_parallel_threshold);
+    auto batch_fun = [](auto& sub) { return detail::pairwise_sum<T>(sub, [](T value) { return value; }); };
 
-    return acc;
+    return engine_dispatch_1d_reduce_slice<T>(input, batch_fun, [](T a, T b) { return a + b; }, tuning().sum_parallel_threshold);
 }
 
 /*!
@@ -51,24 +91,48 @@ template <typename E>
 value_t<E> asum(const E& input) {
     using T = value_t<E>;
 
-    T acc(0);
+    auto batch_fun = [](auto& sub) {
+        return detail::pairwise_sum<T>(sub, [](T value) {
+            using std::abs;
+            return T(abs(value));
+        });
+    };
 
-    auto acc_functor = [&acc](T value) { acc += value; };
+    return engine_dispatch_1d_reduce_slice<T>(input, batch_fun, [](T a, T b) { return a + b; }, tuning().sum_parallel_threshold);
+}
+
+/*!
+ * \brief Compute the mean and the sum of the squared deviations of
+ * the given expression, in a single pass.
+ *
+ * Each block is reduced while it is in cache and the blocks are
+ * combined with the parallel variant of Welford's algorithm.
+ *
+ * \param input The input expression
+ * \return the moments of the input
+ */
+template <typename E>
+common::moments<common::moments_value_t<value_t<E>>> moments(const E& input) {
+    using T = value_t<E>;
+    using A = common::moments_value_t<T>;
+    using M = common::moments<A>;
 
     auto batch_fun = [](auto& sub) {
-        T acc(0);
+        auto kernel = [&sub](size_t first, size_t last) {
+            if (first == last) {
+                return M{};
+            }
 
-        for (size_t i = 0; i < etl::size(sub); ++i) {
-            using std::abs;
-            acc += abs(sub[i]);
-        }
+            const A mean = detail::sum_kernel<A>(sub, first, last, [](T value) { return A(value); }) / A(last - first);
+            const A m2   = detail::sum_kernel<A>(sub, first, last, [mean](T value) { return (A(value) - mean) * (A(value) - mean); });
 
-        return acc;
-    };
+            return M{last - first, mean, m2};
+        };
 
-    engine_dispatch_1d_acc_slice(input, batch_fun, acc_functor, sum_parallel_threshold);
+        return common::pairwise_reduce<M>(0, etl::size(sub), kernel, common::combine_moments<A>);
+    };
 
-    return acc;
+    return engine_dispatch_1d_reduce_slice<M>(input, batch_fun, common::combine_moments<A>, tuning().sum_parallel_threshold);
 }
 
 } //end of namespace etl::impl::standard
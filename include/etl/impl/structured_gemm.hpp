@@ -0,0 +1,136 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the matrix products exploiting the structure of
+ * the adapters.
+ *
+ * The products with a diagonal matrix are computed as a scaling of the
+ * rows (or columns) of the other operand. The products with a triangular
+ * matrix skip its zero half.
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/vec/trmm.hpp"
+
+namespace etl::detail {
+
+/*!
+ * \brief Functor for the products of an adapter and a dense matrix
+ */
+struct structured_gemm_impl {
+    /*!
+     * \brief Indicates if the given type is a lower triangular adapter
+     */
+    template <typename T>
+    static constexpr bool lower = is_lower_matrix<T> || is_uni_lower_matrix<T> || is_strictly_lower_matrix<T>;
+
+    /*!
+     * \brief Indicates if the given type is an upper triangular adapter
+     */
+    template <typename T>
+    static constexpr bool upper = is_upper_matrix<T> || is_uni_upper_matrix<T> || is_strictly_upper_matrix<T>;
+
+    /*!
+     * \brief Indicates if the given type is a triangular adapter
+     */
+    template <typename T>
+    static constexpr bool triangular = lower<T> || upper<T>;
+
+    /*!
+     * \brief Indicates if the product of the given types can be
+     * computed on the raw memory of the operands
+     */
+    template <typename A, typename B, typename C>
+    static constexpr bool direct = !cublas_enabled && all_homogeneous<A, B, C> && all_dma<A, B, C> && all_row_major<A, B, C>;
+
+    /*!
+     * \brief Indicates if the product can use the triangular kernels.
+     *
+     * When a BLAS library is available, its dense GEMM is used instead.
+     */
+    template <typename A, typename B, typename C>
+    static constexpr bool trmm = direct<A, B, C> && (triangular<A> || triangular<B>) && !cblas_enabled && vec_enabled && vectorize_impl
+                                 && all_vectorizable<vector_mode, A, B, C>;
+
+    /*!
+     * \brief Indicates if the structure of the operands can be exploited
+     * for the product of A and B into C
+     */
+    template <typename A, typename B, typename C>
+    static constexpr bool select = (direct<A, B, C> && (is_diagonal_matrix<A> || is_diagonal_matrix<B>)) || trmm<A, B, C>;
+
+    /*!
+     * \brief Compute C = A * B
+     * \param a The lhs matrix
+     * \param b The rhs matrix
+     * \param c The output matrix
+     */
+    template <typename A, typename B, typename C>
+    static void apply(const A& a, const B& b, C& c) {
+        a.ensure_cpu_up_to_date();
+        b.ensure_cpu_up_to_date();
+
+        const size_t M = etl::dim<0>(a);
+        const size_t K = etl::dim<1>(a);
+        const size_t N = etl::dim<1>(b);
+
+        const auto* a_m = a.memory_start();
+        const auto* b_m = b.memory_start();
+        auto* c_m       = c.memory_start();
+
+        if constexpr (is_diagonal_matrix<A>) {
+            inc_counter("impl:std");
+
+            auto batch_fun = [&](size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) {
+                    const auto d = a_m[i * K + i];
+
+                    for (size_t j = 0; j < N; ++j) {
+                        c_m[i * N + j] = d * b_m[i * N + j];
+                    }
+                }
+            };
+
+            engine_dispatch_1d_serial(batch_fun, 0, M, engine_select_parallel(M * N, tuning().parallel_threshold) && M > 1);
+        } else if constexpr (is_diagonal_matrix<B>) {
+            inc_counter("impl:std");
+
+            std::vector<value_t<B>> d(N);
+
+            for (size_t j = 0; j < N; ++j) {
+                d[j] = b_m[j * N + j];
+            }
+
+            auto batch_fun = [&](size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) {
+                    for (size_t j = 0; j < N; ++j) {
+                        c_m[i * N + j] = a_m[i * K + j] * d[j];
+                    }
+                }
+            };
+
+            engine_dispatch_1d_serial(batch_fun, 0, M, engine_select_parallel(M * N, tuning().parallel_threshold) && M > 1);
+        } else if constexpr (triangular<A>) {
+            inc_counter("impl:vec");
+
+            etl::impl::vec::trmm_left<lower<A>>(a_m, b_m, c_m, M, N);
+        } else {
+            inc_counter("impl:vec");
+
+            etl::impl::vec::trmm_right<lower<B>>(a_m, b_m, c_m, M, N);
+        }
+
+        c.validate_cpu();
+        c.invalidate_gpu();
+    }
+};
+
+} //end of namespace etl::detail
@@ -184,4 +184,27 @@ struct asum_impl {
     }
 };
 
+/*!
+ * \brief Moments (mean and sum of squared deviations) operation implementation
+ */
+struct moments_impl {
+    /*!
+     * \brief Apply the functor to e
+     */
+    template <typename E>
+    static impl::common::moments<impl::common::moments_value_t<value_t<E>>> apply(const E& e) {
+        constexpr_select const auto impl = select_sum_impl<E>();
+
+        if
+            constexpr_select(impl != etl::sum_impl::STD && vec_enabled && all_vectorizable<vector_mode, E> && is_floating<E>) {
+                inc_counter("impl:vec");
+                return impl::vec::moments(e);
+            }
+        else {
+            inc_counter("impl:std");
+            return impl::standard::moments(e);
+        }
+    }
+};
+
 } //end of namespace etl::detail
@@ -0,0 +1,286 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the batch normalization kernels
+ */
+
+#pragma once
+
+#include "etl/impl/common/reduce.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Vectorized sum over the batch of the (shifted and squared)
+ * values of the channels [first, last) of a 2D input.
+ *
+ * The channels are vectorized, the input is traversed row by row.
+ *
+ * \copydetails etl::impl::standard::batch_sum_2d
+ * \tparam V The vectorization type
+ */
+template <typename V, bool Squared, typename I, typename B, typename O>
+void batch_sum_2d([[maybe_unused]] const I& input, [[maybe_unused]] const B& shift, O& output, size_t first, size_t last) {
+    using vec_type = V;
+    using T        = value_t<I>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const size_t N = etl::dim<0>(input);
+    const size_t K = etl::dim<1>(input);
+
+    for (size_t k = first; k < last; ++k) {
+        output[k] = 0;
+    }
+
+    for (size_t b = 0; b < N; ++b) {
+        const size_t row = b * K;
+
+        size_t k = first;
+
+        for (; k + vec_size - 1 < last; k += vec_size) {
+            auto x = input.template loadu<vec_type>(row + k);
+
+            if constexpr (Squared) {
+                x = vec_type::sub(x, shift.template loadu<vec_type>(k));
+                output.template storeu<vec_type>(vec_type::fmadd(x, x, output.template loadu<vec_type>(k)), k);
+            } else {
+                output.template storeu<vec_type>(vec_type::add(x, output.template loadu<vec_type>(k)), k);
+            }
+        }
+
+        for (; k < last; ++k) {
+            if constexpr (Squared) {
+                const T x = input[row + k] - shift[k];
+                output[k] += x * x;
+            } else {
+                output[k] += input[row + k];
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Vectorized single-pass computation of the mean and the
+ * (biased) variance over the batch of the channels [first, last) of a
+ * 2D input.
+ *
+ * The statistics of several channels are updated at once with
+ * Welford's algorithm while the input is traversed row by row.
+ *
+ * \copydetails etl::impl::standard::batch_norm_stats_2d
+ * \tparam V The vectorization type
+ */
+template <typename V, typename I, typename M, typename VV>
+void batch_norm_stats_2d(const I& input, M& mean, VV& var, size_t first, size_t last) {
+    using vec_type = V;
+    using T        = value_t<I>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const size_t N = etl::dim<0>(input);
+    const size_t K = etl::dim<1>(input);
+
+    for (size_t k = first; k < last; ++k) {
+        mean[k] = 0;
+        var[k]  = 0;
+    }
+
+    for (size_t b = 0; b < N; ++b) {
+        const size_t row = b * K;
+        const T inv      = T(1) / T(b + 1);
+
+        auto vinv = vec_type::set(inv);
+
+        size_t k = first;
+
+        for (; k + vec_size - 1 < last; k += vec_size) {
+            auto x  = input.template loadu<vec_type>(row + k);
+            auto mu = mean.template loadu<vec_type>(k);
+            auto m2 = var.template loadu<vec_type>(k);
+
+            auto delta = vec_type::sub(x, mu);
+
+            mu = vec_type::fmadd(delta, vinv, mu);
+            m2 = vec_type::fmadd(delta, vec_type::sub(x, mu), m2);
+
+            mean.template storeu<vec_type>(mu, k);
+            var.template storeu<vec_type>(m2, k);
+        }
+
+        for (; k < last; ++k) {
+            const T x     = input[row + k];
+            const T delta = x - mean[k];
+
+            mean[k] += delta * inv;
+            var[k] += delta * (x - mean[k]);
+        }
+    }
+
+    for (size_t k = first; k < last; ++k) {
+        var[k] /= T(N);
+    }
+}
+
+/*!
+ * \brief Vectorized single-pass computation of the mean and the
+ * (biased) variance over the batch and the spatial dimensions of the
+ * channels [first, last) of a 4D input.
+ *
+ * \copydetails etl::impl::standard::batch_norm_stats_4d
+ * \tparam V The vectorization type
+ */
+template <typename V, typename I, typename M, typename VV>
+void batch_norm_stats_4d(const I& input, M& mean, VV& var, size_t first, size_t last) {
+    using vec_type = V;
+    using T        = value_t<I>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const size_t N = etl::dim<0>(input);
+    const size_t K = etl::dim<1>(input);
+    const size_t S = etl::dim<2>(input) * etl::dim<3>(input);
+
+    for (size_t k = first; k < last; ++k) {
+        common::moments<T> m;
+
+        for (size_t b = 0; b < N; ++b) {
+            const size_t base = (b * K + k) * S;
+            const size_t end  = base + S;
+
+            // Mean of the block
+
+            auto r1 = vec_type::template zero<T>();
+            auto r2 = vec_type::template zero<T>();
+
+            size_t i = base;
+
+            for (; i + 2 * vec_size - 1 < end; i += 2 * vec_size) {
+                r1 = vec_type::add(r1, input.template loadu<vec_type>(i));
+                r2 = vec_type::add(r2, input.template loadu<vec_type>(i + vec_size));
+            }
+
+            for (; i + vec_size - 1 < end; i += vec_size) {
+                r1 = vec_type::add(r1, input.template loadu<vec_type>(i));
+            }
+
+            T sum = vec_type::hadd(vec_type::add(r1, r2));
+
+            for (; i < end; ++i) {
+                sum += input[i];
+            }
+
+            const T block_mean = sum / T(S);
+
+            // Squared deviations of the block, still in cache
+
+            auto vm = vec_type::set(block_mean);
+
+            r1 = vec_type::template zero<T>();
+            r2 = vec_type::template zero<T>();
+
+            for (i = base; i + 2 * vec_size - 1 < end; i += 2 * vec_size) {
+                auto d1 = vec_type::sub(input.template loadu<vec_type>(i), vm);
+                auto d2 = vec_type::sub(input.template loadu<vec_type>(i + vec_size), vm);
+
+                r1 = vec_type::fmadd(d1, d1, r1);
+                r2 = vec_type::fmadd(d2, d2, r2);
+            }
+
+            for (; i + vec_size - 1 < end; i += vec_size) {
+                auto d1 = vec_type::sub(input.template loadu<vec_type>(i), vm);
+                r1      = vec_type::fmadd(d1, d1, r1);
+            }
+
+            T m2 = vec_type::hadd(vec_type::add(r1, r2));
+
+            for (; i < end; ++i) {
+                m2 += (input[i] - block_mean) * (input[i] - block_mean);
+            }
+
+            m = common::combine_moments(m, common::moments<T>{S, block_mean, m2});
+        }
+
+        mean[k] = m.mean;
+        var[k]  = m.count ? m.m2 / T(m.count) : T(0);
+    }
+}
+
+/*!
+ * \brief Vectorized normalization of the rows [first, last) of a 2D
+ * input with the given per-channel scale and shift
+ *
+ * \copydetails etl::impl::standard::batch_norm_apply_2d
+ * \tparam V The vectorization type
+ */
+template <typename V, typename I, typename S, typename O>
+void batch_norm_apply_2d(const I& input, const S& scale, const S& shift, O& output, size_t first, size_t last) {
+    using vec_type = V;
+    using T        = value_t<I>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const size_t K = etl::dim<1>(input);
+
+    for (size_t b = first; b < last; ++b) {
+        const size_t row = b * K;
+
+        size_t k = 0;
+
+        for (; k + vec_size - 1 < K; k += vec_size) {
+            auto x = input.template loadu<vec_type>(row + k);
+            auto y = vec_type::fmadd(x, scale.template load<vec_type>(k), shift.template load<vec_type>(k));
+
+            output.template storeu<vec_type>(y, row + k);
+        }
+
+        for (; k < K; ++k) {
+            output[row + k] = input[row + k] * scale[k] + shift[k];
+        }
+    }
+}
+
+/*!
+ * \brief Vectorized normalization of the (batch, channel) blocks
+ * [first, last) of a 4D input with the given per-channel scale and
+ * shift
+ *
+ * \copydetails etl::impl::standard::batch_norm_apply_4d
+ * \tparam V The vectorization type
+ */
+template <typename V, typename I, typename S, typename O>
+void batch_norm_apply_4d(const I& input, const S& scale, const S& shift, O& output, size_t first, size_t last) {
+    using vec_type = V;
+    using T        = value_t<I>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const size_t K  = etl::dim<1>(input);
+    const size_t SS = etl::dim<2>(input) * etl::dim<3>(input);
+
+    for (size_t bk = first; bk < last; ++bk) {
+        const size_t k   = bk % K;
+        const size_t end = (bk + 1) * SS;
+
+        auto vscale = vec_type::set(scale[k]);
+        auto vshift = vec_type::set(shift[k]);
+
+        size_t i = bk * SS;
+
+        for (; i + vec_size - 1 < end; i += vec_size) {
+            output.template storeu<vec_type>(vec_type::fmadd(input.template loadu<vec_type>(i), vscale, vshift), i);
+        }
+
+        for (; i < end; ++i) {
+            output[i] = input[i] * scale[k] + shift[k];
+        }
+    }
+}
+
+} //end of namespace etl::impl::vec
@@ -7,7 +7,7 @@
 
 /*!
  * \file
- * \brief Standard implementation of the outer product
+ * \brief Vectorized implementation of the bias_add computation
  */
 
 #pragma once
@@ -15,113 +15,132 @@
 namespace etl::impl::vec {
 
 /*!
- * \brief Compute the bias addition of b into x and store the result in y
+ * \brief Apply the activation F (if any) on a value or a vector of values
+ * \param x The values
+ * \return the activated values
+ */
+template <typename V, typename F, typename X>
+X bias_activate(X x) {
+    if constexpr (std::is_same_v<F, identity_op>) {
+        return x;
+    } else if constexpr (std::is_arithmetic_v<X>) {
+        return F::apply(x);
+    } else {
+        return F::template load<V>(x);
+    }
+}
+
+/*!
+ * \brief Add the bias b to the H x W planes [first, last) of x, apply
+ * the activation F and store the result in y.
+ *
+ * The bias is broadcast once per plane. If Stream is true, the results
+ * are written with non-temporal stores, once the output is aligned.
+ *
+ * \param x The input memory
+ * \param b The bias memory
+ * \param y The output memory
+ * \param C The number of channels
+ * \param MN The size of a plane
+ * \param first The first plane
+ * \param last The end of the planes
+ */
+template <typename V, typename F, bool Stream, typename T>
+void bias_add_4d_planes(const T* x, const T* b, T* y, size_t C, size_t MN, size_t first, size_t last) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size  = vec_type::template traits<T>::size;
+    static constexpr size_t alignment = vec_type::template traits<T>::alignment;
+
+    for (size_t p = first; p < last; ++p) {
+        const T* x_s = x + p * MN;
+        T* y_s       = y + p * MN;
+
+        const T bias = b[p % C];
+
+        auto b1 = vec_type::set(bias);
+
+        size_t m = 0;
+
+        if constexpr (Stream) {
+            // Peel until the output is aligned for the streaming stores
+            for (; m < MN && reinterpret_cast<uintptr_t>(y_s + m) % alignment; ++m) {
+                y_s[m] = bias_activate<vec_type, F>(x_s[m] + bias);
+            }
+        }
+
+        auto store = [y_s](size_t i, auto r) {
+            if constexpr (Stream) {
+                vec_type::stream(y_s + i, r);
+            } else {
+                vec_type::storeu(y_s + i, r);
+            }
+        };
+
+        for (; m + vec_size * 4 - 1 < MN; m += vec_size * 4) {
+            auto x1 = vec_type::loadu(x_s + m + 0 * vec_size);
+            auto x2 = vec_type::loadu(x_s + m + 1 * vec_size);
+            auto x3 = vec_type::loadu(x_s + m + 2 * vec_size);
+            auto x4 = vec_type::loadu(x_s + m + 3 * vec_size);
+
+            store(m + 0 * vec_size, bias_activate<vec_type, F>(vec_type::add(x1, b1)));
+            store(m + 1 * vec_size, bias_activate<vec_type, F>(vec_type::add(x2, b1)));
+            store(m + 2 * vec_size, bias_activate<vec_type, F>(vec_type::add(x3, b1)));
+            store(m + 3 * vec_size, bias_activate<vec_type, F>(vec_type::add(x4, b1)));
+        }
+
+        for (; m + vec_size - 1 < MN; m += vec_size) {
+            store(m, bias_activate<vec_type, F>(vec_type::add(vec_type::loadu(x_s + m), b1)));
+        }
+
+        for (; m < MN; ++m) {
+            y_s[m] = bias_activate<vec_type, F>(x_s[m] + bias);
+        }
+    }
+}
+
+/*!
+ * \brief Compute the bias addition of b into x, apply the activation F
+ * and store the result in y
+ *
+ * The N x C planes are processed in parallel. Large outputs that do not
+ * alias the input are written with streaming stores.
+ *
  * \param x The a expression
  * \param b The b expression
  * \param y The c expression
  */
-template <typename V, typename L, typename R, typename C>
+template <typename V, typename F, typename L, typename R, typename C>
 void bias_add_4d_impl(const L& x, const R& b, C&& y) {
-    using vec_type = V;
-    using T        = value_t<L>;
-
-    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+    using T = value_t<L>;
 
-    const auto B  = etl::dim<0>(x);
-    const auto M  = etl::dim<2>(x);
-    const auto N  = etl::dim<3>(x);
-    const auto MN = M * N;
+    const auto K  = etl::dim<1>(x);
+    const auto NK = etl::dim<0>(x) * K;
+    const auto MN = etl::dim<2>(x) * etl::dim<3>(x);
 
     x.ensure_cpu_up_to_date();
     b.ensure_cpu_up_to_date();
 
-    // Note: This kernel is particularly adapted for large inner (MN) dimensions
+    const T* x_m = x.memory_start();
+    const T* b_m = b.memory_start();
+    T* y_m       = y.memory_start();
+
+    const bool stream = streaming && etl::size(x) > stream_threshold / (sizeof(T) * 3) && !x.alias(y);
 
     auto batch_fun = [&](size_t first, size_t last) {
-        for (size_t i = first; i < last; ++i) {
-            for (size_t j = 0; j < etl::dim<1>(x); ++j) {
-                auto x_s = x(i)(j).memory_start();
-                auto y_s = y(i)(j).memory_start();
-
-                auto b1 = vec_type::set(b[j]);
-
-                size_t m = 0;
-
-                for (; m + vec_size * 8 - 1 < MN; m += vec_size * 8) {
-                    auto x1 = vec_type::loadu(x_s + m + 0 * vec_size);
-                    auto x2 = vec_type::loadu(x_s + m + 1 * vec_size);
-                    auto x3 = vec_type::loadu(x_s + m + 2 * vec_size);
-                    auto x4 = vec_type::loadu(x_s + m + 3 * vec_size);
-                    auto x5 = vec_type::loadu(x_s + m + 4 * vec_size);
-                    auto x6 = vec_type::loadu(x_s + m + 5 * vec_size);
-                    auto x7 = vec_type::loadu(x_s + m + 8 * vec_size);
-                    auto x8 = vec_type::loadu(x_s + m + 7 * vec_size);
-
-                    auto r1 = vec_type::add(x1, b1);
-                    auto r2 = vec_type::add(x2, b1);
-                    auto r3 = vec_type::add(x3, b1);
-                    auto r4 = vec_type::add(x4, b1);
-                    auto r5 = vec_type::add(x5, b1);
-                    auto r6 = vec_type::add(x6, b1);
-                    auto r7 = vec_type::add(x7, b1);
-                    auto r8 = vec_type::add(x8, b1);
-
-                    vec_type::storeu(y_s + m + 0 * vec_size, r1);
-                    vec_type::storeu(y_s + m + 1 * vec_size, r2);
-                    vec_type::storeu(y_s + m + 2 * vec_size, r3);
-                    vec_type::storeu(y_s + m + 3 * vec_size, r4);
-                    vec_type::storeu(y_s + m + 4 * vec_size, r5);
-                    vec_type::storeu(y_s + m + 5 * vec_size, r6);
-                    vec_type::storeu(y_s + m + 6 * vec_size, r7);
-                    vec_type::storeu(y_s + m + 7 * vec_size, r8);
-                }
-
-                for (; m + vec_size * 4 - 1 < MN; m += vec_size * 4) {
-                    auto x1 = vec_type::loadu(x_s + m + 0 * vec_size);
-                    auto x2 = vec_type::loadu(x_s + m + 1 * vec_size);
-                    auto x3 = vec_type::loadu(x_s + m + 2 * vec_size);
-                    auto x4 = vec_type::loadu(x_s + m + 3 * vec_size);
-
-                    auto r1 = vec_type::add(x1, b1);
-                    auto r2 = vec_type::add(x2, b1);
-                    auto r3 = vec_type::add(x3, b1);
-                    auto r4 = vec_type::add(x4, b1);
-
-                    vec_type::storeu(y_s + m + 0 * vec_size, r1);
-                    vec_type::storeu(y_s + m + 1 * vec_size, r2);
-                    vec_type::storeu(y_s + m + 2 * vec_size, r3);
-                    vec_type::storeu(y_s + m + 3 * vec_size, r4);
-                }
-
-                for (; m + vec_size * 2 - 1 < MN; m += vec_size * 2) {
-                    auto x1 = vec_type::loadu(x_s + m + 0 * vec_size);
-                    auto x2 = vec_type::loadu(x_s + m + 1 * vec_size);
-
-                    auto r1 = vec_type::add(x1, b1);
-                    auto r2 = vec_type::add(x2, b1);
-
-                    vec_type::storeu(y_s + m + 0 * vec_size, r1);
-                    vec_type::storeu(y_s + m + 1 * vec_size, r2);
-                }
-
-                for (; m + vec_size - 1 < MN; m += vec_size) {
-                    auto x1 = vec_type::loadu(x_s + m);
-
-                    auto r1 = vec_type::add(x1, b1);
-
-                    vec_type::storeu(y_s + m, r1);
-                }
-
-                for (; m < MN; ++m) {
-                    y_s[m] = x_s[m] + b[j];
-                }
+        if constexpr (vec_enabled) {
+            if (stream) {
+                bias_add_4d_planes<V, F, true>(x_m, b_m, y_m, K, MN, first, last);
+                return;
             }
         }
+
+        bias_add_4d_planes<V, F, false>(x_m, b_m, y_m, K, MN, first, last);
     };
 
-    // TODO The gain of dispatching has to be checked again
-    batch_fun(0, B);
+    engine_dispatch_1d_serial(batch_fun, 0, NK, engine_select_parallel(etl::size(x), tuning().parallel_threshold) && NK > 1);
 
+    y.validate_cpu();
     y.invalidate_gpu();
 }
 
@@ -178,9 +197,9 @@ void bias_add_2d_impl(const L& x, const R& b, C&& y) {
  * \param b The b expression
  * \param y The c expression
  */
-template <typename A, typename B, typename C>
+template <typename F = identity_op, typename A, typename B, typename C>
 void bias_add_4d(const A& x, const B& b, C&& y) {
-    bias_add_4d_impl<default_vec>(x, b, y);
+    bias_add_4d_impl<default_vec, F>(x, b, y);
 }
 
 /*!
@@ -0,0 +1,117 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the fused softmax cross entropy
+ */
+
+#pragma once
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Vectorized computation of the softmax cross entropy loss and
+ * its gradient for the rows [first, last) of the logits.
+ *
+ * \copydetails etl::impl::standard::softmax_cross_entropy_kernel
+ *
+ * \tparam V The vectorization type
+ */
+template <typename V, typename O, typename L, typename G>
+value_t<O> softmax_cross_entropy_kernel(const O& logits, const L& labels, G& gradient, size_t first, size_t last) {
+    using vec_type = V;
+    using T        = value_t<O>;
+
+    static_assert(std::is_same_v<T, value_t<L>> && std::is_same_v<T, value_t<G>>, "The logits, labels and gradient must have the same value type");
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const size_t n = etl::dim<1>(logits);
+
+    T lanes[vec_size];
+    T loss(0);
+
+    for (size_t r = first; r < last; ++r) {
+        const size_t b = r * n;
+        const size_t e = b + n;
+
+        size_t j;
+
+        // First pass: maximum
+
+        auto vmax = vec_type::set(logits[b]);
+
+        for (j = b; j + vec_size - 1 < e; j += vec_size) {
+            vmax = vec_type::max(vmax, logits.template loadu<vec_type>(j));
+        }
+
+        vec_type::storeu(lanes, vmax);
+
+        T m = *std::max_element(lanes, lanes + vec_size);
+
+        for (; j < e; ++j) {
+            m = std::max(m, logits[j]);
+        }
+
+        // Second pass: exponentials (written in the gradient), dot product
+        // of the labels with the shifted logits and sum of the labels
+
+        auto vm   = vec_type::set(m);
+        auto vs   = vec_type::template zero<T>();
+        auto vdot = vec_type::template zero<T>();
+        auto vsum = vec_type::template zero<T>();
+
+        for (j = b; j + vec_size - 1 < e; j += vec_size) {
+            auto x = vec_type::sub(logits.template loadu<vec_type>(j), vm);
+            auto l = labels.template loadu<vec_type>(j);
+            auto y = vec_type::exp(x);
+
+            gradient.template storeu<vec_type>(y, j);
+
+            vs   = vec_type::add(vs, y);
+            vdot = vec_type::fmadd(l, x, vdot);
+            vsum = vec_type::add(vsum, l);
+        }
+
+        T s   = vec_type::hadd(vs);
+        T dot = vec_type::hadd(vdot);
+        T sum = vec_type::hadd(vsum);
+
+        for (; j < e; ++j) {
+            const T x = logits[j] - m;
+
+            gradient[j] = std::exp(x);
+            s += gradient[j];
+            dot += labels[j] * x;
+            sum += labels[j];
+        }
+
+        // Normalization of the gradient row, still in cache
+
+        const T inv_s = T(1) / s;
+        auto vinv     = vec_type::set(inv_s);
+
+        for (j = b; j + vec_size - 1 < e; j += vec_size) {
+            auto g = gradient.template loadu<vec_type>(j);
+            auto l = labels.template loadu<vec_type>(j);
+
+            gradient.template storeu<vec_type>(vec_type::sub(vec_type::mul(g, vinv), l), j);
+        }
+
+        for (; j < e; ++j) {
+            gradient[j] = gradient[j] * inv_s - labels[j];
+        }
+
+        // -sum(labels * (x - log(s))), with x the logits shifted by the maximum
+        loss += sum * std::log(s) - dot;
+    }
+
+    return loss;
+}
+
+} //end of namespace etl::impl::vec
@@ -0,0 +1,570 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Blocked implementation of the decompositions.
+ *
+ * The factorizations work on panels of columns and apply the panels to
+ * the trailing matrix with the vectorized GEMM kernels, in parallel over
+ * the rows of the trailing matrix.
+ */
+
+#pragma once
+
+#include "etl/parallel_support.hpp"
+
+#include "etl/impl/vec/gemm_rr_to_r.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief The number of columns of the panels of the blocked decompositions
+ */
+constexpr size_t decomposition_block = 64;
+
+/*!
+ * \brief Compute the product of a (M x K) and b (K x N), both contiguous
+ * row-major, and assign it to (or subtract it from) the M x N block c
+ * whose rows are ldc elements apart.
+ *
+ * The rows of the product are computed in parallel.
+ *
+ * \param a The lhs matrix
+ * \param b The rhs matrix
+ * \param c The first element of the output block
+ * \param M The number of rows of a and c
+ * \param N The number of columns of b and c
+ * \param K The number of columns of a and rows of b
+ * \param ldc The distance between two rows of c
+ * \tparam Subtract If true, c -= a * b, otherwise c = a * b
+ */
+template <bool Subtract, typename T>
+void gemm_block(const T* a, const T* b, T* c, size_t M, size_t N, size_t K, size_t ldc) {
+    if (!M || !N) {
+        return;
+    }
+
+    // The product is computed by blocks of rows, small enough for the
+    // temporary block to remain in cache until it is written to c
+
+    static constexpr size_t row_block = 32;
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        std::vector<T> tmp(std::min(row_block, last - first) * N);
+
+        for (size_t block = first; block < last; block += row_block) {
+            const size_t rows = std::min(row_block, last - block);
+
+            if constexpr (vec_enabled) {
+                gemm_rr_to_r(a + block * K, b, tmp.data(), rows, N, K);
+            } else {
+                std::fill_n(tmp.data(), rows * N, T(0));
+
+                for (size_t i = 0; i < rows; ++i) {
+                    for (size_t k = 0; k < K; ++k) {
+                        for (size_t j = 0; j < N; ++j) {
+                            tmp[i * N + j] += a[(block + i) * K + k] * b[k * N + j];
+                        }
+                    }
+                }
+            }
+
+            for (size_t i = 0; i < rows; ++i) {
+                T* c_row = c + (block + i) * ldc;
+
+                for (size_t j = 0; j < N; ++j) {
+                    if constexpr (Subtract) {
+                        c_row[j] -= tmp[i * N + j];
+                    } else {
+                        c_row[j] = tmp[i * N + j];
+                    }
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, M, engine_select_parallel(M * N * K, tuning().parallel_threshold) && M > 1);
+}
+
+/*!
+ * \brief Blocked right-looking LU decomposition with partial pivoting of
+ * the n x n row-major matrix a, in place.
+ *
+ * On return, the strict lower part of a contains L (with a unit
+ * diagonal) and the upper part contains U. The row i was exchanged with
+ * the row pivots[i] at the step i, so that P * A = L * U.
+ *
+ * \param a The matrix to decompose
+ * \param n The dimension of the matrix
+ * \param pivots The pivot indices (n)
+ * \return false if the matrix is singular, true otherwise
+ */
+template <typename T>
+bool lu(T* a, size_t n, size_t* pivots) {
+    bool regular = true;
+
+    std::vector<T> l21;
+    std::vector<T> u12;
+
+    for (size_t k = 0; k < n; k += decomposition_block) {
+        const size_t kb = std::min(decomposition_block, n - k);
+        const size_t ke = k + kb;
+
+        // 1. Unblocked factorization of the panel (columns [k, ke))
+
+        for (size_t j = k; j < ke; ++j) {
+            size_t p = j;
+
+            for (size_t i = j + 1; i < n; ++i) {
+                if (std::abs(a[i * n + j]) > std::abs(a[p * n + j])) {
+                    p = i;
+                }
+            }
+
+            pivots[j] = p;
+
+            if (p != j) {
+                std::swap_ranges(a + j * n, a + (j + 1) * n, a + p * n);
+            }
+
+            const T pivot = a[j * n + j];
+
+            if (pivot == T(0)) {
+                regular = false;
+                continue;
+            }
+
+            for (size_t i = j + 1; i < n; ++i) {
+                T* row = a + i * n;
+
+                row[j] /= pivot;
+
+                const T l = row[j];
+
+                for (size_t c = j + 1; c < ke; ++c) {
+                    row[c] -= l * a[j * n + c];
+                }
+            }
+        }
+
+        if (ke == n) {
+            break;
+        }
+
+        const size_t rows = n - ke;
+
+        // 2. U12 = inv(L11) * A12
+
+        auto u_fun = [&](size_t first, size_t last) {
+            for (size_t j = k; j < ke; ++j) {
+                for (size_t i = j + 1; i < ke; ++i) {
+                    const T l = a[i * n + j];
+
+                    for (size_t c = first; c < last; ++c) {
+                        a[i * n + c] -= l * a[j * n + c];
+                    }
+                }
+            }
+        };
+
+        engine_dispatch_1d_serial(u_fun, ke, n, engine_select_parallel(kb * kb * rows, tuning().parallel_threshold));
+
+        // 3. A22 -= L21 * U12
+
+        l21.resize(rows * kb);
+        u12.resize(kb * rows);
+
+        for (size_t i = 0; i < rows; ++i) {
+            std::copy_n(a + (ke + i) * n + k, kb, l21.data() + i * kb);
+        }
+
+        for (size_t i = 0; i < kb; ++i) {
+            std::copy_n(a + (k + i) * n + ke, rows, u12.data() + i * rows);
+        }
+
+        gemm_block<true>(l21.data(), u12.data(), a + ke * n + ke, rows, rows, kb, n);
+    }
+
+    return regular;
+}
+
+/*!
+ * \brief Blocked right-looking Cholesky decomposition of the n x n
+ * symmetric positive definite row-major matrix a, in place.
+ *
+ * Only the lower part of a is read. On return, the lower part of a
+ * contains L so that A = L * L^T, the strict upper part is left
+ * untouched.
+ *
+ * \param a The matrix to decompose
+ * \param n The dimension of the matrix
+ * \return false if the matrix is not positive definite, true otherwise
+ */
+template <typename T>
+bool cholesky(T* a, size_t n) {
+    std::vector<T> l21;
+    std::vector<T> l21t;
+
+    for (size_t k = 0; k < n; k += decomposition_block) {
+        const size_t kb = std::min(decomposition_block, n - k);
+        const size_t ke = k + kb;
+
+        // 1. Unblocked factorization of the diagonal block
+
+        for (size_t j = k; j < ke; ++j) {
+            T d = a[j * n + j];
+
+            for (size_t p = k; p < j; ++p) {
+                d -= a[j * n + p] * a[j * n + p];
+            }
+
+            if (!(d > T(0))) {
+                return false;
+            }
+
+            a[j * n + j] = std::sqrt(d);
+
+            for (size_t i = j + 1; i < ke; ++i) {
+                T s = a[i * n + j];
+
+                for (size_t p = k; p < j; ++p) {
+                    s -= a[i * n + p] * a[j * n + p];
+                }
+
+                a[i * n + j] = s / a[j * n + j];
+            }
+        }
+
+        if (ke == n) {
+            break;
+        }
+
+        const size_t rows = n - ke;
+
+        // 2. L21 = A21 * inv(L11)^T, each row is a forward substitution
+
+        auto l_fun = [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                T* row = a + i * n;
+
+                for (size_t j = k; j < ke; ++j) {
+                    T s = row[j];
+
+                    for (size_t p = k; p < j; ++p) {
+                        s -= row[p] * a[j * n + p];
+                    }
+
+                    row[j] = s / a[j * n + j];
+                }
+            }
+        };
+
+        engine_dispatch_1d_serial(l_fun, ke, n, engine_select_parallel(kb * kb * rows, tuning().parallel_threshold));
+
+        // 3. A22 -= L21 * L21^T, only the lower part, by blocks of columns
+
+        l21.resize(rows * kb);
+        l21t.resize(kb * decomposition_block);
+
+        for (size_t i = 0; i < rows; ++i) {
+            std::copy_n(a + (ke + i) * n + k, kb, l21.data() + i * kb);
+        }
+
+        for (size_t c = 0; c < rows; c += decomposition_block) {
+            const size_t cb = std::min(decomposition_block, rows - c);
+
+            for (size_t p = 0; p < kb; ++p) {
+                for (size_t j = 0; j < cb; ++j) {
+                    l21t[p * cb + j] = l21[(c + j) * kb + p];
+                }
+            }
+
+            gemm_block<true>(l21.data() + c * kb, l21t.data(), a + (ke + c) * n + ke + c, rows - c, cb, kb, n);
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Form the upper triangular factor T of the compact WY
+ * representation H = I - V * T * V^T of a block of reflectors.
+ *
+ * \param vt The transposed reflectors (kb x mk), with their unit diagonal
+ * \param mk The length of the reflectors
+ * \param kb The number of reflectors
+ * \param tau The scalar factors of the reflectors
+ * \param tt The output factor (kb x kb)
+ */
+template <typename T>
+void householder_t(const T* vt, size_t mk, size_t kb, const T* tau, T* tt) {
+    std::vector<T> w(kb);
+
+    std::fill_n(tt, kb * kb, T(0));
+
+    for (size_t j = 0; j < kb; ++j) {
+        tt[j * kb + j] = tau[j];
+
+        // T(0:j, j) = -tau_j * T(0:j, 0:j) * V(:, 0:j)^T * v_j
+
+        for (size_t p = 0; p < j; ++p) {
+            T s(0);
+
+            for (size_t i = j; i < mk; ++i) {
+                s += vt[p * mk + i] * vt[j * mk + i];
+            }
+
+            w[p] = -tau[j] * s;
+        }
+
+        for (size_t p = 0; p < j; ++p) {
+            T s(0);
+
+            for (size_t q = p; q < j; ++q) {
+                s += tt[p * kb + q] * w[q];
+            }
+
+            tt[p * kb + j] = s;
+        }
+    }
+}
+
+/*!
+ * \brief Blocked Householder QR decomposition of the m x n row-major
+ * matrix a, in place.
+ *
+ * On return, the upper part of a contains R and the strict lower part
+ * contains the Householder vectors (with an implicit unit first
+ * element) whose scalar factors are stored in tau. The reflectors of a
+ * panel are applied at once to the trailing matrix in the compact WY
+ * representation H = I - V * T * V^T.
+ *
+ * \param a The matrix to decompose
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ * \param tau The scalar factors of the reflectors (min(m, n))
+ */
+template <typename T>
+void householder_qr(T* a, size_t m, size_t n, T* tau) {
+    const size_t kn = std::min(m, n);
+
+    std::vector<T> vt;
+    std::vector<T> v;
+    std::vector<T> tt;
+    std::vector<T> c;
+    std::vector<T> w;
+
+    for (size_t k = 0; k < kn; k += decomposition_block) {
+        const size_t kb = std::min(decomposition_block, kn - k);
+        const size_t ke = k + kb;
+        const size_t mk = m - k;
+
+        // 1. Unblocked factorization of the panel (columns [k, ke)), each
+        // column of the panel being made contiguous in vt
+
+        vt.resize(kb * mk);
+
+        for (size_t i = 0; i < mk; ++i) {
+            for (size_t j = 0; j < kb; ++j) {
+                vt[j * mk + i] = a[(k + i) * n + k + j];
+            }
+        }
+
+        for (size_t j = 0; j < kb; ++j) {
+            using std::sqrt;
+
+            T* col = vt.data() + j * mk;
+
+            T sigma(0);
+
+            for (size_t i = j + 1; i < mk; ++i) {
+                sigma += col[i] * col[i];
+            }
+
+            const T alpha = col[j];
+
+            if (sigma == T(0)) {
+                tau[k + j] = T(0);
+                continue;
+            }
+
+            const T norm = sqrt(alpha * alpha + sigma);
+            const T beta = alpha > T(0) ? -norm : norm;
+
+            tau[k + j] = (beta - alpha) / beta;
+
+            const T scale = T(1) / (alpha - beta);
+
+            for (size_t i = j + 1; i < mk; ++i) {
+                col[i] *= scale;
+            }
+
+            col[j] = beta;
+
+            // Apply the reflector to the remaining columns of the panel
+
+            for (size_t cc = j + 1; cc < kb; ++cc) {
+                T* other = vt.data() + cc * mk;
+
+                T s = other[j];
+
+                for (size_t i = j + 1; i < mk; ++i) {
+                    s += col[i] * other[i];
+                }
+
+                s *= tau[k + j];
+
+                other[j] -= s;
+
+                for (size_t i = j + 1; i < mk; ++i) {
+                    other[i] -= s * col[i];
+                }
+            }
+        }
+
+        for (size_t i = 0; i < mk; ++i) {
+            for (size_t j = 0; j < kb; ++j) {
+                a[(k + i) * n + k + j] = vt[j * mk + i];
+            }
+        }
+
+        if (ke == n) {
+            continue;
+        }
+
+        // 2. V (mk x kb, unit lower trapezoidal) and T (kb x kb)
+
+        v.assign(mk * kb, T(0));
+
+        for (size_t j = 0; j < kb; ++j) {
+            std::fill_n(vt.data() + j * mk, j, T(0));
+            vt[j * mk + j] = T(1);
+
+            for (size_t i = j; i < mk; ++i) {
+                v[i * kb + j] = vt[j * mk + i];
+            }
+        }
+
+        tt.resize(kb * kb);
+
+        householder_t(vt.data(), mk, kb, tau + k, tt.data());
+
+        // 3. C = H^T * C = C - V * (T^T * (V^T * C))
+
+        const size_t nc = n - ke;
+
+        c.resize(mk * nc);
+        w.resize(kb * nc);
+
+        for (size_t i = 0; i < mk; ++i) {
+            std::copy_n(a + (k + i) * n + ke, nc, c.data() + i * nc);
+        }
+
+        gemm_block<false>(vt.data(), c.data(), w.data(), kb, nc, mk, nc);
+
+        for (size_t p = kb; p-- > 0;) {
+            for (size_t j = 0; j < nc; ++j) {
+                T s(0);
+
+                for (size_t q = 0; q <= p; ++q) {
+                    s += tt[q * kb + p] * w[q * nc + j];
+                }
+
+                w[p * nc + j] = s;
+            }
+        }
+
+        gemm_block<true>(v.data(), w.data(), a + k * n + ke, mk, nc, kb, n);
+    }
+}
+
+/*!
+ * \brief Form the first columns of the m x m orthogonal matrix Q from the
+ * Householder vectors and factors computed by householder_qr, in blocks.
+ *
+ * \param a The result of householder_qr (m x n)
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ * \param tau The scalar factors of the reflectors
+ * \param q The output matrix (m x cols)
+ * \param cols The number of columns of Q to form (at most m)
+ */
+template <typename T>
+void householder_q(const T* a, size_t m, size_t n, const T* tau, T* q, size_t cols) {
+    const size_t kn = std::min(m, n);
+
+    std::fill_n(q, m * cols, T(0));
+
+    for (size_t i = 0; i < std::min(m, cols); ++i) {
+        q[i * cols + i] = T(1);
+    }
+
+    std::vector<T> v;
+    std::vector<T> vt;
+    std::vector<T> tt;
+    std::vector<T> c;
+    std::vector<T> w;
+
+    // The blocks are applied in reverse order, the block starting at k
+    // only modifies Q(k:m, k:cols)
+
+    for (size_t block = (kn + decomposition_block - 1) / decomposition_block; block-- > 0;) {
+        const size_t k  = block * decomposition_block;
+        const size_t kb = std::min(decomposition_block, kn - k);
+        const size_t mk = m - k;
+
+        if (k >= cols) {
+            continue;
+        }
+
+        const size_t nc = cols - k;
+
+        v.assign(mk * kb, T(0));
+        vt.assign(kb * mk, T(0));
+        tt.resize(kb * kb);
+        w.resize(kb * nc);
+
+        for (size_t j = 0; j < kb; ++j) {
+            v[j * kb + j]  = T(1);
+            vt[j * mk + j] = T(1);
+
+            for (size_t i = j + 1; i < mk; ++i) {
+                v[i * kb + j]  = a[(k + i) * n + k + j];
+                vt[j * mk + i] = a[(k + i) * n + k + j];
+            }
+        }
+
+        householder_t(vt.data(), mk, kb, tau + k, tt.data());
+
+        // Q(k:m, k:cols) = H * Q(k:m, k:cols) = Q - V * (T * (V^T * Q))
+
+        c.resize(mk * nc);
+
+        for (size_t i = 0; i < mk; ++i) {
+            std::copy_n(q + (k + i) * cols + k, nc, c.data() + i * nc);
+        }
+
+        gemm_block<false>(vt.data(), c.data(), w.data(), kb, nc, mk, nc);
+
+        for (size_t p = 0; p < kb; ++p) {
+            for (size_t j = 0; j < nc; ++j) {
+                T s(0);
+
+                for (size_t q2 = p; q2 < kb; ++q2) {
+                    s += tt[p * kb + q2] * w[q2 * nc + j];
+                }
+
+                w[p * nc + j] = s;
+            }
+        }
+
+        gemm_block<true>(v.data(), w.data(), q + k * cols + k, mk, nc, kb, cols);
+    }
+}
+
+} //end of namespace etl::impl::vec
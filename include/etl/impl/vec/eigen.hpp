@@ -0,0 +1,508 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Blocked implementation of the symmetric eigendecomposition.
+ *
+ * The matrix is first reduced to a tridiagonal matrix by blocks of
+ * Householder reflectors, only the symmetric matrix-vector products being
+ * done column by column. The eigenvalues and eigenvectors of the
+ * tridiagonal matrix are then computed with the implicit QL algorithm,
+ * the rotations of each sweep being applied in parallel to the
+ * eigenvectors.
+ */
+
+#pragma once
+
+#include "etl/impl/vec/decomposition.hpp"
+#include "etl/impl/vec/trmm.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief The number of rows processed at once by symv_lower
+ */
+constexpr size_t symv_block = 32;
+
+/*!
+ * \brief The number of columns of the eigenvectors rotated at once by a
+ * thread during the QL sweeps
+ */
+constexpr size_t rotation_block = 64;
+
+/*!
+ * \brief The number of QL sweeps whose rotations are applied together to
+ * the eigenvectors
+ */
+constexpr size_t pending_sweeps = 16;
+
+/*!
+ * \brief The maximum number of QL iterations for an eigenvalue
+ */
+constexpr size_t ql_max_iterations = 30;
+
+/*!
+ * \brief Compute y = A * v for the trailing symmetric block A(s:n, s:n)
+ * of the row-major matrix a, only reading its lower part.
+ *
+ * Each row of the lower part is read once and used for both its dot
+ * product with v and its contribution to the upper part.
+ *
+ * \param a The symmetric matrix (n x n)
+ * \param n The dimension of the matrix
+ * \param s The first row and column of the block
+ * \param v The input vector (n - s)
+ * \param y The output vector (n - s)
+ */
+template <typename T>
+void symv_lower(const T* a, size_t n, size_t s, const T* v, T* y) {
+    const size_t m      = n - s;
+    const size_t blocks = (m + symv_block - 1) / symv_block;
+
+    std::fill_n(y, m, T(0));
+
+    std::mutex lock;
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        std::vector<T> acc(m, T(0));
+
+        for (size_t p = first; p < last; ++p) {
+            const size_t i0 = trmm_interleave(p, blocks) * symv_block;
+            const size_t i1 = std::min(i0 + symv_block, m);
+
+            for (size_t i = i0; i < i1; ++i) {
+                const T* row = a + (s + i) * n + s;
+
+                const T vi = v[i];
+
+                T dot(0);
+
+                for (size_t j = 0; j < i; ++j) {
+                    dot += row[j] * v[j];
+                    acc[j] += row[j] * vi;
+                }
+
+                acc[i] += dot + row[i] * vi;
+            }
+        }
+
+        std::lock_guard<std::mutex> l(lock);
+
+        for (size_t i = 0; i < m; ++i) {
+            y[i] += acc[i];
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, blocks, engine_select_parallel(m * m / 2, tuning().parallel_threshold) && blocks > 1);
+}
+
+/*!
+ * \brief Blocked reduction of the n x n symmetric row-major matrix a to
+ * a symmetric tridiagonal matrix Q^T * A * Q, in place.
+ *
+ * Only the lower part of a is read. On return, d contains the diagonal
+ * and e the subdiagonal of the tridiagonal matrix (e[i] is between i and
+ * i + 1, e[n - 1] is zero). The reflector of the column c is stored
+ * below the subdiagonal of the column c of a, with an implicit unit
+ * first element, and its factor in tau[c].
+ *
+ * \param a The matrix to reduce
+ * \param n The dimension of the matrix
+ * \param d The diagonal (n)
+ * \param e The subdiagonal (n)
+ * \param tau The scalar factors of the reflectors (n)
+ */
+template <typename T>
+void tridiagonalize(T* a, size_t n, T* d, T* e, T* tau) {
+    const size_t nb = decomposition_block;
+
+    std::vector<T> vp;
+    std::vector<T> wp;
+    std::vector<T> y;
+    std::vector<T> t1;
+    std::vector<T> t2;
+    std::vector<T> x;
+    std::vector<T> yt;
+
+    for (size_t k = 0; k < n; k += nb) {
+        const size_t kb = std::min(nb, n - k);
+        const size_t ke = k + kb;
+        const size_t mk = n - k;
+
+        // The reflectors (V) and the updates (W) of the panel, from the row k
+
+        vp.assign(mk * kb, T(0));
+        wp.assign(mk * kb, T(0));
+
+        for (size_t j = 0; j < kb; ++j) {
+            using std::sqrt;
+
+            const size_t c = k + j;
+
+            // 1. Apply the previous updates of the panel to the column c
+
+            for (size_t i = c; i < n; ++i) {
+                T s(0);
+
+                for (size_t p = 0; p < j; ++p) {
+                    s += vp[(i - k) * kb + p] * wp[(c - k) * kb + p] + wp[(i - k) * kb + p] * vp[(c - k) * kb + p];
+                }
+
+                a[i * n + c] -= s;
+            }
+
+            d[c] = a[c * n + c];
+
+            // 2. Reflector annihilating A(c+2:n, c)
+
+            if (c + 1 >= n) {
+                tau[c] = T(0);
+                e[c]   = T(0);
+                continue;
+            }
+
+            const T alpha = a[(c + 1) * n + c];
+
+            T sigma(0);
+
+            for (size_t i = c + 2; i < n; ++i) {
+                sigma += a[i * n + c] * a[i * n + c];
+            }
+
+            if (sigma == T(0)) {
+                tau[c] = T(0);
+                e[c]   = alpha;
+                continue;
+            }
+
+            const T norm = sqrt(alpha * alpha + sigma);
+            const T beta = alpha > T(0) ? -norm : norm;
+
+            tau[c] = (beta - alpha) / beta;
+            e[c]   = beta;
+
+            const T scale = T(1) / (alpha - beta);
+
+            vp[(c + 1 - k) * kb + j] = T(1);
+
+            for (size_t i = c + 2; i < n; ++i) {
+                a[i * n + c] *= scale;
+                vp[(i - k) * kb + j] = a[i * n + c];
+            }
+
+            // 3. w = tau * (A - V * W^T - W * V^T) * v, corrected so that the
+            // update is A - v * w^T - w * v^T
+
+            const size_t s  = c + 1;
+            const size_t ms = n - s;
+
+            x.resize(ms);
+            y.resize(ms);
+
+            for (size_t i = 0; i < ms; ++i) {
+                x[i] = vp[(s + i - k) * kb + j];
+            }
+
+            symv_lower(a, n, s, x.data(), y.data());
+
+            t1.assign(j, T(0));
+            t2.assign(j, T(0));
+
+            for (size_t i = 0; i < ms; ++i) {
+                for (size_t p = 0; p < j; ++p) {
+                    t1[p] += wp[(s + i - k) * kb + p] * x[i];
+                    t2[p] += vp[(s + i - k) * kb + p] * x[i];
+                }
+            }
+
+            for (size_t i = 0; i < ms; ++i) {
+                T r = y[i];
+
+                for (size_t p = 0; p < j; ++p) {
+                    r -= vp[(s + i - k) * kb + p] * t1[p] + wp[(s + i - k) * kb + p] * t2[p];
+                }
+
+                y[i] = tau[c] * r;
+            }
+
+            T dot(0);
+
+            for (size_t i = 0; i < ms; ++i) {
+                dot += y[i] * x[i];
+            }
+
+            const T gamma = -T(0.5) * tau[c] * dot;
+
+            for (size_t i = 0; i < ms; ++i) {
+                wp[(s + i - k) * kb + j] = y[i] + gamma * x[i];
+            }
+        }
+
+        if (ke >= n) {
+            break;
+        }
+
+        // 4. A(ke:n, ke:n) -= V * W^T + W * V^T, only the lower part, by
+        // blocks of columns
+
+        const size_t rows = n - ke;
+        const size_t kk   = 2 * kb;
+
+        x.resize(rows * kk);
+        yt.resize(kk * nb);
+
+        for (size_t i = 0; i < rows; ++i) {
+            std::copy_n(vp.data() + (ke - k + i) * kb, kb, x.data() + i * kk);
+            std::copy_n(wp.data() + (ke - k + i) * kb, kb, x.data() + i * kk + kb);
+        }
+
+        for (size_t c = 0; c < rows; c += nb) {
+            const size_t cb = std::min(nb, rows - c);
+
+            for (size_t p = 0; p < kb; ++p) {
+                for (size_t jj = 0; jj < cb; ++jj) {
+                    yt[p * cb + jj]        = x[(c + jj) * kk + kb + p];
+                    yt[(kb + p) * cb + jj] = x[(c + jj) * kk + p];
+                }
+            }
+
+            gemm_block<true>(x.data() + c * kk, yt.data(), a + (ke + c) * n + ke + c, rows - c, cb, kk, n);
+        }
+    }
+}
+
+/*!
+ * \brief Compute the eigenvalues and eigenvectors of a symmetric
+ * tridiagonal matrix with the implicit QL algorithm.
+ *
+ * The rotations are applied to the rows of vt, which must initially
+ * contain the transposed orthogonal matrix of the reduction, so that the
+ * rows of vt are the eigenvectors of the original matrix on return.
+ *
+ * The rotations of several sweeps are recorded and then applied
+ * together, by blocks of columns of vt, each block remaining in cache
+ * for all the sweeps.
+ *
+ * \param d The diagonal (n), replaced by the (unsorted) eigenvalues
+ * \param e The subdiagonal (n), destroyed
+ * \param vt The transposed eigenvectors (n x n)
+ * \param n The dimension of the matrix
+ * \return false if the algorithm did not converge, true otherwise
+ */
+template <typename T>
+bool tridiagonal_ql(T* d, T* e, T* vt, size_t n) {
+    using std::abs;
+    using std::hypot;
+
+    const T eps = std::numeric_limits<T>::epsilon();
+
+    std::vector<T> cs(pending_sweeps * n);
+    std::vector<T> ss(pending_sweeps * n);
+    std::vector<std::pair<size_t, size_t>> sweeps;
+
+    // Apply the recorded rotations to the eigenvectors
+    auto flush = [&]() {
+        size_t work = 0;
+
+        for (auto [l, m] : sweeps) {
+            work += n * (m - l);
+        }
+
+        auto batch_fun = [&](size_t first, size_t last) {
+            const size_t k0 = first * rotation_block;
+            const size_t k1 = std::min(last * rotation_block, n);
+
+            for (size_t w = 0; w < sweeps.size(); ++w) {
+                const auto [l, m] = sweeps[w];
+
+                for (size_t i = m; i-- > l;) {
+                    const T ci = cs[w * n + i];
+                    const T si = ss[w * n + i];
+
+                    T* vi  = vt + i * n;
+                    T* vi1 = vt + (i + 1) * n;
+
+                    for (size_t k = k0; k < k1; ++k) {
+                        const T hk = vi1[k];
+
+                        vi1[k] = si * vi[k] + ci * hk;
+                        vi[k]  = ci * vi[k] - si * hk;
+                    }
+                }
+            }
+        };
+
+        const size_t blocks = (n + rotation_block - 1) / rotation_block;
+
+        engine_dispatch_1d_serial(batch_fun, 0, blocks, engine_select_parallel(work, tuning().parallel_threshold) && blocks > 1);
+
+        sweeps.clear();
+    };
+
+    T f(0);
+    T tst1(0);
+
+    for (size_t l = 0; l < n; ++l) {
+        tst1 = std::max(tst1, abs(d[l]) + abs(e[l]));
+
+        size_t m = l;
+
+        while (m < n - 1 && abs(e[m]) > eps * tst1) {
+            ++m;
+        }
+
+        size_t iterations = 0;
+
+        while (m > l) {
+            if (++iterations > ql_max_iterations) {
+                return false;
+            }
+
+            // Implicit shift
+
+            T g       = d[l];
+            T p       = (d[l + 1] - g) / (T(2) * e[l]);
+            T r       = hypot(p, T(1));
+            r         = p < T(0) ? -r : r;
+            d[l]      = e[l] / (p + r);
+            d[l + 1]  = e[l] * (p + r);
+            const T dl1 = d[l + 1];
+            T h       = g - d[l];
+
+            for (size_t i = l + 2; i < n; ++i) {
+                d[i] -= h;
+            }
+
+            f += h;
+
+            // Implicit QL sweep, the rotations are recorded
+
+            p         = d[m];
+            T c       = 1;
+            T c2      = c;
+            T c3      = c;
+            const T el1 = e[l + 1];
+            T s       = 0;
+            T s2      = 0;
+
+            for (size_t i = m; i-- > l;) {
+                c3 = c2;
+                c2 = c;
+                s2 = s;
+                g  = c * e[i];
+                h  = c * p;
+                r  = hypot(p, e[i]);
+
+                e[i + 1] = s * r;
+                s        = e[i] / r;
+                c        = p / r;
+                p        = c * d[i] - s * g;
+                d[i + 1] = h + s * (c * g + s * d[i]);
+
+                cs[sweeps.size() * n + i] = c;
+                ss[sweeps.size() * n + i] = s;
+            }
+
+            p    = -s * s2 * c3 * el1 * e[l] / dl1;
+            e[l] = s * p;
+            d[l] = c * p;
+
+            sweeps.emplace_back(l, m);
+
+            if (sweeps.size() == pending_sweeps) {
+                flush();
+            }
+
+            // Check for convergence
+
+            m = l;
+
+            while (m < n - 1 && abs(e[m]) > eps * tst1) {
+                ++m;
+            }
+        }
+
+        d[l] += f;
+        e[l] = T(0);
+    }
+
+    flush();
+
+    return true;
+}
+
+/*!
+ * \brief Compute the eigenvalues and the eigenvectors of the n x n
+ * symmetric row-major matrix a.
+ *
+ * Only the lower part of a is read, a is destroyed.
+ *
+ * \param a The symmetric matrix
+ * \param n The dimension of the matrix
+ * \param values The eigenvalues, in ascending order (n)
+ * \param vectors The eigenvectors, one per column, in the order of the
+ * eigenvalues (n x n, row-major)
+ * \return false if the algorithm did not converge, true otherwise
+ */
+template <typename T>
+bool eigen_sym(T* a, size_t n, T* values, T* vectors) {
+    if (!n) {
+        return true;
+    }
+
+    std::vector<T> d(n);
+    std::vector<T> e(n);
+    std::vector<T> tau(n);
+
+    tridiagonalize(a, n, d.data(), e.data(), tau.data());
+
+    // The reflectors of the reduction are the ones of the QR decomposition
+    // of A(1:n, 0:n-1)
+
+    const size_t n1 = n - 1;
+
+    std::vector<T> sub(n1 * n1);
+    std::vector<T> q(n1 * n1);
+    std::vector<T> vt(n * n, T(0));
+
+    for (size_t i = 0; i < n1; ++i) {
+        std::copy_n(a + (i + 1) * n, n1, sub.data() + i * n1);
+    }
+
+    householder_q(sub.data(), n1, n1, tau.data(), q.data(), n1);
+
+    vt[0] = T(1);
+
+    for (size_t i = 0; i < n1; ++i) {
+        for (size_t j = 0; j < n1; ++j) {
+            vt[(j + 1) * n + i + 1] = q[i * n1 + j];
+        }
+    }
+
+    if (!tridiagonal_ql(d.data(), e.data(), vt.data(), n)) {
+        return false;
+    }
+
+    std::vector<size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&d](size_t lhs, size_t rhs) { return d[lhs] < d[rhs]; });
+
+    for (size_t j = 0; j < n; ++j) {
+        values[j] = d[order[j]];
+
+        const T* v = vt.data() + order[j] * n;
+
+        for (size_t i = 0; i < n; ++i) {
+            vectors[i * n + j] = v[i];
+        }
+    }
+
+    return true;
+}
+
+} //end of namespace etl::impl::vec
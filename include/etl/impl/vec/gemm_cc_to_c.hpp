@@ -478,7 +478,7 @@ void gemm_cc_to_c(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
 
     // Dispatch to the best kernel
 
-    if (M * N <= gemm_cc_small_threshold) {
+    if (M * N <= tuning().gemm_cc_small_threshold) {
         gemm_small_kernel_cc_to_c<default_vec>(a, b, c, M, N, K);
     } else {
         gemm_large_kernel_cc_to_c<default_vec>(a, b, c, M, N, K);
@@ -469,7 +469,7 @@ template <typename T>
 void gemm_cr_to_c(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
     cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
-    if (M * N <= gemm_rr_small_threshold) {
+    if (M * N <= tuning().gemm_rr_small_threshold) {
         gemm_small_kernel_cr_to_c<default_vec>(a, b, c, M, N, K);
     } else {
         direct_fill_n(c, M * N, T(0));
@@ -538,7 +538,7 @@ template <typename T>
 void gemm_rc_to_r(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
     cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
-    if (M * N <= gemm_nt_rr_small_threshold) {
+    if (M * N <= tuning().gemm_nt_rr_small_threshold) {
         gemm_small_kernel_rc_to_r<default_vec>(a, b, c, M, N, K);
     } else {
         direct_fill_n(c, M * N, T(0));
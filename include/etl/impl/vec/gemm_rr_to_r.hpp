@@ -622,7 +622,7 @@ void gemm_rr_to_r(const T* a, const T* b, T* c, size_t M, size_t N, size_t K) {
 
     // Dispatch to the best kernel
 
-    if (K * N <= gemm_rr_small_threshold) {
+    if (K * N <= tuning().gemm_rr_small_threshold) {
         gemm_small_kernel_rr_to_r<default_vec>(a, b, c, M, N, K);
     } else {
         gemm_large_kernel_rr_to_r<default_vec>(a, b, c, M, N, K, T(0));
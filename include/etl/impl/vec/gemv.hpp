@@ -598,13 +598,13 @@ void gemv(A&& a, B&& b, C&& c) {
         const auto n = columns(a);
 
         if constexpr (is_row_major<A>) {
-            if (etl::size(a) < gemv_rm_small_threshold) {
+            if (etl::size(a) < tuning().gemv_rm_small_threshold) {
                 gemv_small_kernel_rr<default_vec, all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
             } else {
                 gemv_large_kernel_rr<default_vec, all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
             }
         } else {
-            if (etl::size(a) < gemv_cm_small_threshold) {
+            if (etl::size(a) < tuning().gemv_cm_small_threshold) {
                 gemv_small_kernel_cc<default_vec, all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
             } else {
                 c = 0;
@@ -636,13 +636,13 @@ void gemv_t(A&& a, B&& b, C&& c) {
         const auto n = columns(a);
 
         if constexpr (is_row_major<A>) {
-            if (etl::size(a) < gemv_rm_small_threshold) {
+            if (etl::size(a) < tuning().gemv_rm_small_threshold) {
                 gemv_small_kernel_cc<default_vec, all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
             } else {
                 gemv_large_kernel_cc<default_vec, all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
             }
         } else {
-            if (etl::size(a) < gemv_cm_small_threshold) {
+            if (etl::size(a) < tuning().gemv_cm_small_threshold) {
                 gemv_small_kernel_rr<default_vec, all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
             } else {
                 c = 0;
@@ -660,13 +660,13 @@ void gevm(A&& a, B&& b, C&& c) {
         const auto n = columns(b);
 
         if constexpr (is_row_major<B>) {
-            if (etl::size(b) < gevm_rm_small_threshold) {
+            if (etl::size(b) < tuning().gevm_rm_small_threshold) {
                 gevm_small_kernel_rr<default_vec>(a.memory_start(), m, n, b.memory_start(), c);
             } else {
                 gevm_large_kernel_rr<default_vec>(a.memory_start(), m, n, b.memory_start(), c);
             }
         } else {
-            if (etl::size(b) < gevm_cm_small_threshold) {
+            if (etl::size(b) < tuning().gevm_cm_small_threshold) {
                 gevm_small_kernel_cc<default_vec>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
             } else {
                 c = 0;
@@ -699,7 +699,7 @@ void gevm_t(A&& a, B&& b, C&& c) {
         const auto n = columns(b);
 
         if constexpr (is_row_major<B>) {
-            if (etl::size(b) < gevm_rm_small_threshold) {
+            if (etl::size(b) < tuning().gevm_rm_small_threshold) {
                 gevm_small_kernel_cc<default_vec>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
             } else {
                 c = 0;
@@ -707,7 +707,7 @@ void gevm_t(A&& a, B&& b, C&& c) {
                 gevm_large_kernel_cc<default_vec>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
             }
         } else {
-            if (etl::size(b) < gevm_cm_small_threshold) {
+            if (etl::size(b) < tuning().gevm_cm_small_threshold) {
                 gevm_small_kernel_rr<default_vec>(a.memory_start(), n, m, b.memory_start(), c);
             } else {
                 c = 0;
@@ -0,0 +1,103 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the "max_index" and "min_index"
+ * reductions
+ */
+
+#pragma once
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Returns the index of the first maximum (or minimum) element of
+ * values in the range [first, last)
+ *
+ * The range is processed by small blocks. The extremum of each block is
+ * computed with vertical max (min) operations. Only when a block
+ * improves the current extremum is it scanned again (while still in
+ * cache) to find the index of its first extremum. This gives the same
+ * result as the scalar search, ties included.
+ *
+ * \param values The expression to search
+ * \param first The beginning of the range
+ * \param last The end of the range (must be bigger than first)
+ * \tparam Max true to search the maximum, false to search the minimum
+ * \return The index of the first maximum (or minimum) element in the range
+ */
+template <typename V, bool Max, typename E>
+size_t index_kernel(const E& values, size_t first, size_t last) {
+    using vec_type = V;
+    using T        = value_t<E>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+    static constexpr size_t block    = 64 * vec_size;
+
+    auto better = [](T a, T b) { return Max ? a > b : a < b; };
+
+    auto extremum = [](auto a, auto b) {
+        if constexpr (Max) {
+            return vec_type::max(a, b);
+        } else {
+            return vec_type::min(a, b);
+        }
+    };
+
+    T lanes[vec_size];
+
+    size_t m = first;
+    T best   = values[first];
+
+    for (size_t b = first; b < last; b += block) {
+        const size_t e = std::min(b + block, last);
+
+        size_t i = b;
+        T block_best = values[b];
+
+        if (e - b >= 2 * vec_size) {
+            auto r1 = values.template loadu<vec_type>(i);
+            auto r2 = values.template loadu<vec_type>(i + vec_size);
+
+            i += 2 * vec_size;
+
+            for (; i + 2 * vec_size - 1 < e; i += 2 * vec_size) {
+                r1 = extremum(r1, values.template loadu<vec_type>(i));
+                r2 = extremum(r2, values.template loadu<vec_type>(i + vec_size));
+            }
+
+            vec_type::storeu(lanes, extremum(r1, r2));
+
+            for (size_t l = 0; l < vec_size; ++l) {
+                if (better(lanes[l], block_best)) {
+                    block_best = lanes[l];
+                }
+            }
+        }
+
+        for (; i < e; ++i) {
+            if (better(values[i], block_best)) {
+                block_best = values[i];
+            }
+        }
+
+        if (better(block_best, best)) {
+            for (size_t j = b; j < e; ++j) {
+                if (values[j] == block_best) {
+                    m    = j;
+                    best = block_best;
+                    break;
+                }
+            }
+        }
+    }
+
+    return m;
+}
+
+} //end of namespace etl::impl::vec
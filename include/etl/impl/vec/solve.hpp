@@ -0,0 +1,156 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Blocked implementation of the triangular solves.
+ *
+ * The diagonal blocks are solved by substitution and the solved rows are
+ * applied to the remaining rows with the vectorized GEMM kernels. When
+ * there are enough right-hand sides, groups of columns of the
+ * right-hand sides are solved in parallel.
+ */
+
+#pragma once
+
+#include "etl/impl/vec/decomposition.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief The number of right-hand sides solved together by a thread
+ */
+constexpr size_t trsm_rhs_block = 64;
+
+/*!
+ * \brief Solve the triangular system A * X = B, in place in the
+ * contiguous right-hand sides.
+ *
+ * \param a The n x n row-major triangular matrix, only its lower (or
+ * upper) part is read
+ * \param n The dimension of the matrix
+ * \param b The right-hand sides (n x m), replaced by the solution
+ * \param m The number of right-hand sides
+ * \tparam Lower If true, A is lower triangular, otherwise upper
+ * \tparam Unit If true, the diagonal of A is implicitly one
+ */
+template <bool Lower, bool Unit, typename T>
+void trsm_panel(const T* a, size_t n, T* b, size_t m) {
+    std::vector<T> pack;
+
+    // Solve the rows [k, ke) of X by substitution
+    auto substitute = [&](size_t k, size_t ke) {
+        for (size_t ii = k; ii < ke; ++ii) {
+            const size_t i = Lower ? ii : k + ke - 1 - ii;
+
+            T* bi = b + i * m;
+
+            const size_t first = Lower ? k : i + 1;
+            const size_t last  = Lower ? i : ke;
+
+            for (size_t j = first; j < last; ++j) {
+                const T l = a[i * n + j];
+                const T* bj = b + j * m;
+
+                for (size_t c = 0; c < m; ++c) {
+                    bi[c] -= l * bj[c];
+                }
+            }
+
+            if constexpr (!Unit) {
+                const T d = T(1) / a[i * n + i];
+
+                for (size_t c = 0; c < m; ++c) {
+                    bi[c] *= d;
+                }
+            }
+        }
+    };
+
+    if constexpr (Lower) {
+        for (size_t k = 0; k < n; k += decomposition_block) {
+            const size_t kb = std::min(decomposition_block, n - k);
+            const size_t ke = k + kb;
+
+            substitute(k, ke);
+
+            // B(ke:n) -= A(ke:n, k:ke) * X(k:ke)
+
+            if (ke < n) {
+                pack.resize((n - ke) * kb);
+
+                for (size_t i = ke; i < n; ++i) {
+                    std::copy_n(a + i * n + k, kb, pack.data() + (i - ke) * kb);
+                }
+
+                gemm_block<true>(pack.data(), b + k * m, b + ke * m, n - ke, m, kb, m);
+            }
+        }
+    } else {
+        for (size_t ke = n; ke > 0;) {
+            const size_t kb = std::min(decomposition_block, ke);
+            const size_t k  = ke - kb;
+
+            substitute(k, ke);
+
+            // B(0:k) -= A(0:k, k:ke) * X(k:ke)
+
+            if (k > 0) {
+                pack.resize(k * kb);
+
+                for (size_t i = 0; i < k; ++i) {
+                    std::copy_n(a + i * n + k, kb, pack.data() + i * kb);
+                }
+
+                gemm_block<true>(pack.data(), b + k * m, b, k, m, kb, m);
+            }
+
+            ke = k;
+        }
+    }
+}
+
+/*!
+ * \brief Solve the triangular system A * X = B, in place.
+ *
+ * When there are enough right-hand sides, they are split in groups of
+ * columns that are solved in parallel. Otherwise, the GEMM updates are
+ * parallelized.
+ *
+ * \copydetails trsm_panel
+ */
+template <bool Lower, bool Unit, typename T>
+void trsm(const T* a, size_t n, T* b, size_t m) {
+    const size_t groups = (m + trsm_rhs_block - 1) / trsm_rhs_block;
+
+    if (groups < 2 || !engine_select_parallel(n * n * m, tuning().parallel_threshold)) {
+        trsm_panel<Lower, Unit>(a, n, b, m);
+        return;
+    }
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        const size_t c0 = first * trsm_rhs_block;
+        const size_t c1 = std::min(last * trsm_rhs_block, m);
+        const size_t w  = c1 - c0;
+
+        std::vector<T> panel(n * w);
+
+        for (size_t i = 0; i < n; ++i) {
+            std::copy_n(b + i * m + c0, w, panel.data() + i * w);
+        }
+
+        trsm_panel<Lower, Unit>(a, n, panel.data(), w);
+
+        for (size_t i = 0; i < n; ++i) {
+            std::copy_n(panel.data() + i * w, w, b + i * m + c0);
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, groups, true);
+}
+
+} //end of namespace etl::impl::vec
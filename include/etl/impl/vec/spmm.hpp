@@ -0,0 +1,211 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the products of a sparse matrix and a
+ * dense vector (SpMV) or a dense row-major matrix (SpMM).
+ */
+
+#pragma once
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Compute y = y + alpha * x on n contiguous elements
+ * \param alpha The scaling factor
+ * \param x The input memory
+ * \param y The output memory
+ * \param n The number of elements
+ */
+template <typename V, typename T>
+void spmm_axpy(T alpha, const T* x, T* y, size_t n) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto a1 = vec_type::set(alpha);
+
+    size_t j = 0;
+
+    for (; j + 2 * vec_size - 1 < n; j += 2 * vec_size) {
+        auto y1 = vec_type::loadu(y + j);
+        auto y2 = vec_type::loadu(y + j + vec_size);
+
+        y1 = vec_type::fmadd(a1, vec_type::loadu(x + j), y1);
+        y2 = vec_type::fmadd(a1, vec_type::loadu(x + j + vec_size), y2);
+
+        vec_type::storeu(y + j, y1);
+        vec_type::storeu(y + j + vec_size, y2);
+    }
+
+    for (; j + vec_size - 1 < n; j += vec_size) {
+        vec_type::storeu(y + j, vec_type::fmadd(a1, vec_type::loadu(x + j), vec_type::loadu(y + j)));
+    }
+
+    for (; j < n; ++j) {
+        y[j] += alpha * x[j];
+    }
+}
+
+/*!
+ * \brief Compute the dot product of the non-zeros [first, last) of a
+ * compressed row with a dense vector
+ *
+ * The elements of the vector are gathered in a small buffer so that the
+ * products are computed with vector instructions.
+ *
+ * \param values The non-zero values
+ * \param inner The column of each non-zero value
+ * \param b The dense vector
+ * \param first The first non-zero of the row
+ * \param last The end of the non-zeros of the row
+ * \return the dot product
+ */
+template <typename V, typename T>
+T spmv_dot(const T* values, const size_t* inner, const T* b, size_t first, size_t last) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    T gathered[2 * vec_size];
+
+    auto r1 = vec_type::template zero<T>();
+    auto r2 = vec_type::template zero<T>();
+
+    size_t p = first;
+
+    for (; p + 2 * vec_size - 1 < last; p += 2 * vec_size) {
+        for (size_t l = 0; l < 2 * vec_size; ++l) {
+            gathered[l] = b[inner[p + l]];
+        }
+
+        r1 = vec_type::fmadd(vec_type::loadu(values + p), vec_type::loadu(gathered), r1);
+        r2 = vec_type::fmadd(vec_type::loadu(values + p + vec_size), vec_type::loadu(gathered + vec_size), r2);
+    }
+
+    for (; p + vec_size - 1 < last; p += vec_size) {
+        for (size_t l = 0; l < vec_size; ++l) {
+            gathered[l] = b[inner[p + l]];
+        }
+
+        r1 = vec_type::fmadd(vec_type::loadu(values + p), vec_type::loadu(gathered), r1);
+    }
+
+    T r = vec_type::hadd(vec_type::add(r1, r2));
+
+    for (; p < last; ++p) {
+        r += values[p] * b[inner[p]];
+    }
+
+    return r;
+}
+
+/*!
+ * \brief Compute the product of a sparse matrix and a dense vector,
+ * c = a * b
+ *
+ * The rows of a CSR matrix are vectorized dot products, computed in
+ * parallel. The CSC product is not a dot product, it uses the standard
+ * kernel (parallel over blocks of columns).
+ *
+ * \param a The sparse matrix
+ * \param b The dense vector
+ * \param c The output vector
+ */
+template <typename A, typename B, typename C>
+void spmv(const A& a, B&& b, C&& c) {
+    using T = value_t<A>;
+
+    decltype(auto) s = etl::impl::standard::detail::compressed_forward(a);
+
+    if constexpr (std::decay_t<decltype(s)>::row_compressed) {
+        b.ensure_cpu_up_to_date();
+
+        const auto* values = s.values();
+        const auto* inner  = s.inner_index();
+        const auto* outer  = s.outer_index();
+
+        const T* bb = b.memory_start();
+        T* cc       = c.memory_start();
+
+        auto batch_fun = [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                cc[i] = spmv_dot<default_vec>(values, inner, bb, outer[i], outer[i + 1]);
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, etl::rows(s), engine_select_parallel(s.non_zeros(), sparse_parallel_threshold));
+
+        c.invalidate_gpu();
+    } else {
+        etl::impl::standard::spmv(s, b, c);
+    }
+}
+
+/*!
+ * \brief Compute the product of a sparse matrix and a dense row-major
+ * matrix, c = a * b
+ *
+ * Each non-zero of a contributes a scaled row of b to a row of c. The
+ * rows of c (CSR) or the blocks of columns of c (CSC) are computed in
+ * parallel.
+ *
+ * \param a The sparse matrix
+ * \param b The dense matrix
+ * \param c The output matrix
+ */
+template <typename A, typename B, typename C>
+void spmm(const A& a, B&& b, C&& c) {
+    using T = value_t<A>;
+
+    decltype(auto) s = etl::impl::standard::detail::compressed_forward(a);
+
+    b.ensure_cpu_up_to_date();
+
+    const auto* values = s.values();
+    const auto* inner  = s.inner_index();
+    const auto* outer  = s.outer_index();
+
+    const size_t m = etl::rows(s);
+    const size_t n = etl::columns(b);
+
+    const T* bb = b.memory_start();
+    T* cc       = c.memory_start();
+
+    if constexpr (std::decay_t<decltype(s)>::row_compressed) {
+        auto batch_fun = [&](size_t first, size_t last) {
+            std::fill(cc + first * n, cc + last * n, T(0));
+
+            for (size_t i = first; i < last; ++i) {
+                for (size_t p = outer[i]; p < outer[i + 1]; ++p) {
+                    spmm_axpy<default_vec>(values[p], bb + inner[p] * n, cc + i * n, n);
+                }
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, m, engine_select_parallel(s.non_zeros() * n, sparse_parallel_threshold));
+    } else {
+        auto batch_fun = [&](size_t first, size_t last) {
+            for (size_t i = 0; i < m; ++i) {
+                std::fill(cc + i * n + first, cc + i * n + last, T(0));
+            }
+
+            for (size_t k = 0; k < etl::columns(s); ++k) {
+                for (size_t p = outer[k]; p < outer[k + 1]; ++p) {
+                    spmm_axpy<default_vec>(values[p], bb + k * n + first, cc + inner[p] * n + first, last - first);
+                }
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, n, engine_select_parallel(s.non_zeros() * n, sparse_parallel_threshold));
+    }
+
+    c.invalidate_gpu();
+}
+
+} //end of namespace etl::impl::vec
@@ -12,65 +12,114 @@
 
 #pragma once
 
+#include "etl/impl/common/reduce.hpp"
+
 namespace etl::impl::vec {
 
 /*!
- * \brief Vectorized sum computation
+ * \brief Vectorized sum of vf(x) over the block [first, last) of lhs.
+ *
+ * first must be a multiple of the vector size since the loads are
+ * done with the alignment of lhs. When compensated summation is
+ * enabled, each accumulator is a Kahan accumulator.
+ *
  * \param lhs The expression to compute the sum from
+ * \param first The beginning of the block
+ * \param last The end of the block
+ * \param vf The transformation of each vector
+ * \param sf The transformation of each scalar
  * \tparam V The vectorization type
  * \return The sum of the given range
  */
-template <typename V, typename L>
-value_t<L> sum_impl(const L& lhs) {
-    //Note: Padding cannot be taken into account we don't start at zero
-
+template <typename V, typename L, typename VF, typename SF>
+value_t<L> sum_kernel(const L& lhs, size_t first, size_t last, VF&& vf, SF&& sf) {
     using vec_type = V;
     using T        = value_t<L>;
 
-    const size_t n = etl::size(lhs);
-
     static constexpr size_t vec_size = vec_type::template traits<T>::size;
 
-    safe_ensure_cpu_up_to_date(lhs);
+    auto acc = [](auto& r, auto& c, auto x) {
+        if constexpr (compensated_sum) {
+            auto y = vec_type::sub(x, c);
+            auto t = vec_type::add(r, y);
+            c      = vec_type::sub(vec_type::sub(t, r), y);
+            r      = t;
+        } else {
+            r = vec_type::add(x, r);
+        }
+    };
 
-    size_t i = 0;
+    size_t i = first;
 
     auto r1 = vec_type::template zero<T>();
     auto r2 = vec_type::template zero<T>();
     auto r3 = vec_type::template zero<T>();
     auto r4 = vec_type::template zero<T>();
 
-    for (; i + (vec_size * 4) - 1 < n; i += 4 * vec_size) {
-        r1 = vec_type::add(lhs.template load<vec_type>(i + 0 * vec_size), r1);
-        r2 = vec_type::add(lhs.template load<vec_type>(i + 1 * vec_size), r2);
-        r3 = vec_type::add(lhs.template load<vec_type>(i + 2 * vec_size), r3);
-        r4 = vec_type::add(lhs.template load<vec_type>(i + 3 * vec_size), r4);
-    }
+    auto c1 = vec_type::template zero<T>();
+    auto c2 = vec_type::template zero<T>();
+    auto c3 = vec_type::template zero<T>();
+    auto c4 = vec_type::template zero<T>();
 
-    for (; i + (vec_size * 2) - 1 < n; i += 2 * vec_size) {
-        r1 = vec_type::add(lhs.template load<vec_type>(i + 0 * vec_size), r1);
-        r2 = vec_type::add(lhs.template load<vec_type>(i + 1 * vec_size), r2);
+    for (; i + (vec_size * 4) - 1 < last; i += 4 * vec_size) {
+        acc(r1, c1, vf(lhs.template load<vec_type>(i + 0 * vec_size)));
+        acc(r2, c2, vf(lhs.template load<vec_type>(i + 1 * vec_size)));
+        acc(r3, c3, vf(lhs.template load<vec_type>(i + 2 * vec_size)));
+        acc(r4, c4, vf(lhs.template load<vec_type>(i + 3 * vec_size)));
     }
 
-    for (; i + vec_size - 1 < n; i += vec_size) {
-        r1 = vec_type::add(lhs.template load<vec_type>(i + 0 * vec_size), r1);
+    for (; i + vec_size - 1 < last; i += vec_size) {
+        acc(r1, c1, vf(lhs.template load<vec_type>(i)));
     }
 
-    auto p1 = vec_type::hadd(r1) + vec_type::hadd(r2) + vec_type::hadd(r3) + vec_type::hadd(r4);
-    auto p2 = T();
+    T p1 = (vec_type::hadd(r1) - vec_type::hadd(c1)) + (vec_type::hadd(r2) - vec_type::hadd(c2));
+    T p2 = (vec_type::hadd(r3) - vec_type::hadd(c3)) + (vec_type::hadd(r4) - vec_type::hadd(c4));
 
-    for (; i + 1 < n; i += 2) {
-        p1 += lhs[i];
-        p2 += lhs[i + 1];
+    for (; i + 1 < last; i += 2) {
+        p1 += sf(lhs[i]);
+        p2 += sf(lhs[i + 1]);
     }
 
-    if (i < n) {
-        p1 += lhs[i];
+    if (i < last) {
+        p1 += sf(lhs[i]);
     }
 
     return p1 + p2;
 }
 
+/*!
+ * \brief Vectorized pairwise sum of vf(x) over all the elements of lhs
+ * \param lhs The expression to compute the sum from
+ * \param vf The transformation of each vector
+ * \param sf The transformation of each scalar
+ * \tparam V The vectorization type
+ * \return The sum of the given expression
+ */
+template <typename V, typename L, typename VF, typename SF>
+value_t<L> pairwise_sum(const L& lhs, VF&& vf, SF&& sf) {
+    using T = value_t<L>;
+
+    safe_ensure_cpu_up_to_date(lhs);
+
+    auto kernel  = [&](size_t first, size_t last) { return sum_kernel<V>(lhs, first, last, vf, sf); };
+    auto combine = [](T a, T b) { return a + b; };
+
+    return common::pairwise_reduce<T>(0, etl::size(lhs), kernel, combine);
+}
+
+/*!
+ * \brief Vectorized sum computation
+ * \param lhs The expression to compute the sum from
+ * \tparam V The vectorization type
+ * \return The sum of the given range
+ */
+template <typename V, typename L>
+value_t<L> sum_impl(const L& lhs) {
+    using T = value_t<L>;
+
+    return pairwise_sum<V>(lhs, [](auto x) { return x; }, [](T x) { return x; });
+}
+
 /*!
  * \brief Vectorized absolute sum computation
  * \param lhs The expression to compute the sum from
@@ -79,72 +128,66 @@ value_t<L> sum_impl(const L& lhs) {
  */
 template <typename V, typename L>
 value_t<L> asum_impl(const L& lhs) {
-    //Note: Padding cannot be taken into account we don't start at zero
-
     using vec_type = V;
     using T        = value_t<L>;
-    using std::abs;
-
-    const size_t n = etl::size(lhs);
-
-    static constexpr size_t vec_size = vec_type::template traits<T>::size;
 
-    safe_ensure_cpu_up_to_date(lhs);
+    auto vf = [](auto x) { return vec_type::max(x, vec_type::sub(vec_type::template zero<T>(), x)); };
+    auto sf = [](T x) {
+        using std::abs;
+        return abs(x);
+    };
 
-    size_t i = 0;
+    return pairwise_sum<V>(lhs, vf, sf);
+}
 
-    auto r1 = vec_type::template zero<T>();
-    auto r2 = vec_type::template zero<T>();
-    auto r3 = vec_type::template zero<T>();
-    auto r4 = vec_type::template zero<T>();
+/*!
+ * \brief Vectorized sum of squares computation
+ * \param lhs The expression to compute the sum from
+ * \tparam V The vectorization type
+ * \return The sum of the squares of the given range
+ */
+template <typename V, typename L>
+value_t<L> sum_squares_impl(const L& lhs) {
+    using vec_type = V;
+    using T        = value_t<L>;
 
-    for (; i + (vec_size * 4) - 1 < n; i += 4 * vec_size) {
-        auto v1 = lhs.template load<vec_type>(i + 0 * vec_size);
-        auto v2 = lhs.template load<vec_type>(i + 1 * vec_size);
-        auto v3 = lhs.template load<vec_type>(i + 2 * vec_size);
-        auto v4 = lhs.template load<vec_type>(i + 3 * vec_size);
-
-        auto x1 = vec_type::max(v1, vec_type::sub(vec_type::template zero<T>(), v1));
-        auto x2 = vec_type::max(v2, vec_type::sub(vec_type::template zero<T>(), v2));
-        auto x3 = vec_type::max(v3, vec_type::sub(vec_type::template zero<T>(), v3));
-        auto x4 = vec_type::max(v4, vec_type::sub(vec_type::template zero<T>(), v4));
-
-        r1 = vec_type::add(x1, r1);
-        r2 = vec_type::add(x2, r2);
-        r3 = vec_type::add(x3, r3);
-        r4 = vec_type::add(x4, r4);
-    }
+    return pairwise_sum<V>(lhs, [](auto x) { return vec_type::mul(x, x); }, [](T x) { return x * x; });
+}
 
-    for (; i + (vec_size * 2) - 1 < n; i += 2 * vec_size) {
-        auto v1 = lhs.template load<vec_type>(i + 0 * vec_size);
-        auto v2 = lhs.template load<vec_type>(i + 1 * vec_size);
+/*!
+ * \brief Vectorized computation of the mean and the sum of squared
+ * deviations of lhs, with the blocks combined with Welford's algorithm.
+ * \param lhs The expression to compute the moments from
+ * \tparam V The vectorization type
+ * \return The moments of the given range
+ */
+template <typename V, typename L>
+common::moments<value_t<L>> moments_impl(const L& lhs) {
+    using vec_type = V;
+    using T        = value_t<L>;
+    using M        = common::moments<T>;
 
-        auto x1 = vec_type::max(v1, vec_type::sub(vec_type::template zero<T>(), v1));
-        auto x2 = vec_type::max(v2, vec_type::sub(vec_type::template zero<T>(), v2));
+    safe_ensure_cpu_up_to_date(lhs);
 
-        r1 = vec_type::add(x1, r1);
-        r2 = vec_type::add(x2, r2);
-    }
+    auto kernel = [&lhs](size_t first, size_t last) {
+        if (first == last) {
+            return M{};
+        }
 
-    for (; i + vec_size - 1 < n; i += vec_size) {
-        auto v1 = lhs.template load<vec_type>(i + 0 * vec_size);
-        auto x1 = vec_type::max(v1, vec_type::sub(vec_type::template zero<T>(), v1));
-        r1      = vec_type::add(x1, r1);
-    }
+        const T mean = sum_kernel<V>(lhs, first, last, [](auto x) { return x; }, [](T x) { return x; }) / T(last - first);
 
-    auto p1 = vec_type::hadd(r1) + vec_type::hadd(r2) + vec_type::hadd(r3) + vec_type::hadd(r4);
-    auto p2 = T();
+        auto m  = vec_type::set(mean);
+        auto vf = [m](auto x) {
+            auto d = vec_type::sub(x, m);
+            return vec_type::mul(d, d);
+        };
 
-    for (; i + 1 < n; i += 2) {
-        p1 += abs(lhs[i]);
-        p2 += abs(lhs[i + 1]);
-    }
+        const T m2 = sum_kernel<V>(lhs, first, last, vf, [mean](T x) { return (x - mean) * (x - mean); });
 
-    if (i < n) {
-        p1 += abs(lhs[i]);
-    }
+        return M{last - first, mean, m2};
+    };
 
-    return p1 + p2;
+    return common::pairwise_reduce<M>(0, etl::size(lhs), kernel, common::combine_moments<T>);
 }
 
 /*!
@@ -157,22 +200,16 @@ value_t<L> sum([[maybe_unused]] const L& lhs) {
     if constexpr (vec_enabled && all_vectorizable<vector_mode, L>) {
         using T = value_t<L>;
 
-        T acc(0);
-
-        auto acc_functor = [&acc](T value) { acc += value; };
-
         auto batch_fun = [](auto& sub) {
             // The default vectorization scheme should be sufficient
             return sum_impl<default_vec>(sub);
         };
 
-        if (etl::size(lhs) < sum_parallel_threshold) {
+        if (etl::size(lhs) < tuning().sum_parallel_threshold) {
             return sum_impl<default_vec>(lhs);
-        } else {
-            engine_dispatch_1d_acc_slice(lhs, batch_fun, acc_functor, vec_sum_parallel_threshold);
         }
 
-        return acc;
+        return engine_dispatch_1d_reduce_slice<T>(lhs, batch_fun, [](T a, T b) { return a + b; }, tuning().vec_sum_parallel_threshold);
     } else {
         cpp_unreachable("vec::sum called with invalid parameters");
     }
@@ -188,20 +225,59 @@ value_t<L> asum([[maybe_unused]] const L& lhs) {
     if constexpr (vec_enabled && all_vectorizable<vector_mode, L>) {
         using T = value_t<L>;
 
-        T acc(0);
+        auto batch_fun = [](auto& sub) {
+            // The default vectorization scheme should be sufficient
+            return asum_impl<default_vec>(sub);
+        };
+
+        return engine_dispatch_1d_reduce_slice<T>(lhs, batch_fun, [](T a, T b) { return a + b; }, tuning().vec_sum_parallel_threshold);
+    } else {
+        cpp_unreachable("vec::sum called with invalid parameters");
+    }
+}
 
-        auto acc_functor = [&acc](T value) { acc += value; };
+/*!
+ * \brief Compute the euclidean norm of lhs, in a single pass
+ * \param lhs The lhs expression
+ * \return the euclidean norm of lhs
+ */
+template <typename L>
+value_t<L> norm([[maybe_unused]] const L& lhs) {
+    if constexpr (vec_enabled && all_vectorizable<vector_mode, L>) {
+        using T = value_t<L>;
 
         auto batch_fun = [](auto& sub) {
             // The default vectorization scheme should be sufficient
-            return asum_impl<default_vec>(sub);
+            return sum_squares_impl<default_vec>(sub);
         };
 
-        engine_dispatch_1d_acc_slice(lhs, batch_fun, acc_functor, vec_sum_parallel_threshold);
+        using std::sqrt;
+        return sqrt(engine_dispatch_1d_reduce_slice<T>(lhs, batch_fun, [](T a, T b) { return a + b; }, tuning().vec_sum_parallel_threshold));
+    } else {
+        cpp_unreachable("vec::norm called with invalid parameters");
+    }
+}
+
+/*!
+ * \brief Compute the mean and the sum of squared deviations of lhs, in
+ * a single pass
+ * \param lhs The lhs expression
+ * \return the moments of lhs
+ */
+template <typename L>
+common::moments<common::moments_value_t<value_t<L>>> moments([[maybe_unused]] const L& lhs) {
+    if constexpr (vec_enabled && all_vectorizable<vector_mode, L> && is_floating<L>) {
+        using T = value_t<L>;
+        using M = common::moments<T>;
+
+        auto batch_fun = [](auto& sub) {
+            // The default vectorization scheme should be sufficient
+            return moments_impl<default_vec>(sub);
+        };
 
-        return acc;
+        return engine_dispatch_1d_reduce_slice<M>(lhs, batch_fun, common::combine_moments<T>, tuning().vec_sum_parallel_threshold);
     } else {
-        cpp_unreachable("vec::sum called with invalid parameters");
+        cpp_unreachable("vec::moments called with invalid parameters");
     }
 }
 
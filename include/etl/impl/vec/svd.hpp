@@ -0,0 +1,261 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Implementation of the randomized truncated SVD.
+ *
+ * The range of the matrix is captured by the product with a random
+ * gaussian matrix, refined with a few power iterations and
+ * orthonormalized with the blocked QR decomposition. The small projected
+ * matrix is then decomposed with the one-sided Jacobi algorithm.
+ */
+
+#pragma once
+
+#include "etl/impl/vec/decomposition.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief The maximum number of sweeps of the one-sided Jacobi algorithm
+ */
+constexpr size_t jacobi_max_sweeps = 60;
+
+/*!
+ * \brief Replace the m x l row-major matrix y by an orthonormal basis of
+ * its columns.
+ *
+ * \param y The matrix to orthonormalize
+ * \param m The number of rows of the matrix
+ * \param l The number of columns of the matrix (at most m)
+ */
+template <typename T>
+void orthonormalize(T* y, size_t m, size_t l) {
+    std::vector<T> work(y, y + m * l);
+    std::vector<T> tau(l);
+
+    householder_qr(work.data(), m, l, tau.data());
+    householder_q(work.data(), m, l, tau.data(), y, l);
+}
+
+/*!
+ * \brief Orthogonalize the rows of the l x n row-major matrix a with
+ * one-sided Jacobi rotations.
+ *
+ * On return, G * A0 = A where A0 is the input matrix and the rows of A
+ * are mutually orthogonal.
+ *
+ * \param a The matrix to orthogonalize (l x n)
+ * \param g The accumulated rotations (l x l)
+ * \param l The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ * \return false if the algorithm did not converge, true otherwise
+ */
+template <typename T>
+bool jacobi_rows(T* a, T* g, size_t l, size_t n) {
+    using std::abs;
+    using std::sqrt;
+
+    const T eps = std::numeric_limits<T>::epsilon();
+
+    std::fill_n(g, l * l, T(0));
+
+    for (size_t i = 0; i < l; ++i) {
+        g[i * l + i] = T(1);
+    }
+
+    auto rotate = [](T* x, T* y, size_t len, T c, T s) {
+        for (size_t k = 0; k < len; ++k) {
+            const T xk = x[k];
+            const T yk = y[k];
+
+            x[k] = c * xk - s * yk;
+            y[k] = s * xk + c * yk;
+        }
+    };
+
+    for (size_t sweep = 0; sweep < jacobi_max_sweeps; ++sweep) {
+        bool rotated = false;
+
+        for (size_t p = 0; p + 1 < l; ++p) {
+            for (size_t q = p + 1; q < l; ++q) {
+                T* ap = a + p * n;
+                T* aq = a + q * n;
+
+                T alpha(0);
+                T beta(0);
+                T gamma(0);
+
+                for (size_t k = 0; k < n; ++k) {
+                    alpha += ap[k] * ap[k];
+                    beta += aq[k] * aq[k];
+                    gamma += ap[k] * aq[k];
+                }
+
+                if (abs(gamma) <= eps * sqrt(alpha * beta)) {
+                    continue;
+                }
+
+                rotated = true;
+
+                const T zeta = (beta - alpha) / (T(2) * gamma);
+                const T t    = (zeta >= T(0) ? T(1) : T(-1)) / (abs(zeta) + sqrt(T(1) + zeta * zeta));
+                const T c    = T(1) / sqrt(T(1) + t * t);
+                const T s    = c * t;
+
+                rotate(ap, aq, n, c, s);
+                rotate(g + p * l, g + q * l, l, c, s);
+            }
+        }
+
+        if (!rotated) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*!
+ * \brief Compute the truncated SVD A ~ U * diag(s) * V^T of the m x n
+ * row-major matrix a with a randomized range finder.
+ *
+ * \param a The matrix to decompose (m x n)
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ * \param k The number of singular values to compute (at most min(m, n))
+ * \param u The left singular vectors (m x k)
+ * \param s The singular values, in descending order (k)
+ * \param v The right singular vectors (n x k)
+ * \param g The random generator
+ * \param oversampling The number of additional random vectors
+ * \param power_iterations The number of power iterations
+ * \return false if the algorithm did not converge, true otherwise
+ */
+template <typename T, typename G>
+bool randomized_svd(const T* a, size_t m, size_t n, size_t k, T* u, T* s, T* v, G& g, size_t oversampling, size_t power_iterations) {
+    const size_t l = std::min(k + oversampling, std::min(m, n));
+
+    // 1. Range finder Y = A * Omega, refined with power iterations
+
+    std::vector<T> omega(n * l);
+    std::vector<T> y(m * l);
+    std::vector<T> z(n * l);
+    std::vector<T> qt(l * m);
+    std::vector<T> zt(l * n);
+
+    std::normal_distribution<T> dist(T(0), T(1));
+
+    for (auto& value : omega) {
+        value = dist(g);
+    }
+
+    // Zt = Y^T * A, both operands being row-major
+    auto project = [&](T* out) {
+        for (size_t i = 0; i < m; ++i) {
+            for (size_t j = 0; j < l; ++j) {
+                qt[j * m + i] = y[i * l + j];
+            }
+        }
+
+        gemm_block<false>(qt.data(), a, out, l, n, m, n);
+    };
+
+    gemm_block<false>(a, omega.data(), y.data(), m, l, n, l);
+    orthonormalize(y.data(), m, l);
+
+    for (size_t it = 0; it < power_iterations; ++it) {
+        project(zt.data());
+
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < l; ++j) {
+                z[i * l + j] = zt[j * n + i];
+            }
+        }
+
+        orthonormalize(z.data(), n, l);
+
+        gemm_block<false>(a, z.data(), y.data(), m, l, n, l);
+        orthonormalize(y.data(), m, l);
+    }
+
+    // 2. B = Q^T * A (l x n) and B^T = Qb * R
+
+    project(zt.data());
+
+    std::vector<T> bt(n * l);
+    std::vector<T> tau(l);
+    std::vector<T> qb(n * l);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < l; ++j) {
+            bt[i * l + j] = zt[j * n + i];
+        }
+    }
+
+    householder_qr(bt.data(), n, l, tau.data());
+    householder_q(bt.data(), n, l, tau.data(), qb.data(), l);
+
+    // 3. SVD of B = R^T * Qb^T, G * R^T = diag(s) * Vs
+
+    std::vector<T> r(l * l, T(0));
+    std::vector<T> gg(l * l);
+
+    for (size_t i = 0; i < l; ++i) {
+        for (size_t j = 0; j <= i; ++j) {
+            r[i * l + j] = bt[j * l + i];
+        }
+    }
+
+    const bool converged = jacobi_rows(r.data(), gg.data(), l, l);
+
+    std::vector<T> sv(l);
+
+    for (size_t i = 0; i < l; ++i) {
+        using std::sqrt;
+
+        T norm(0);
+
+        for (size_t j = 0; j < l; ++j) {
+            norm += r[i * l + j] * r[i * l + j];
+        }
+
+        sv[i] = sqrt(norm);
+
+        if (sv[i] > T(0)) {
+            for (size_t j = 0; j < l; ++j) {
+                r[i * l + j] /= sv[i];
+            }
+        }
+    }
+
+    std::vector<size_t> order(l);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sv](size_t lhs, size_t rhs) { return sv[lhs] > sv[rhs]; });
+
+    // 4. U = Q * G^T and V = Qb * Vs^T, only the k first singular vectors
+
+    std::vector<T> us(l * k);
+    std::vector<T> vs(l * k);
+
+    for (size_t j = 0; j < k; ++j) {
+        s[j] = sv[order[j]];
+
+        for (size_t p = 0; p < l; ++p) {
+            us[p * k + j] = gg[order[j] * l + p];
+            vs[p * k + j] = r[order[j] * l + p];
+        }
+    }
+
+    gemm_block<false>(y.data(), us.data(), u, m, k, l, k);
+    gemm_block<false>(qb.data(), vs.data(), v, n, k, l, k);
+
+    return converged;
+}
+
+} //end of namespace etl::impl::vec
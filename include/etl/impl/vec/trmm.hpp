@@ -0,0 +1,146 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized products of a triangular matrix and a dense matrix.
+ *
+ * The product is computed by blocks of rows (or columns) of the result,
+ * each block only reading the non-zero part of the triangular matrix.
+ * This halves the number of operations and the reads of the triangular
+ * matrix compared to the dense GEMM.
+ */
+
+#pragma once
+
+#include "etl/parallel_support.hpp"
+
+#include "etl/impl/vec/gemm_rr_to_r.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief The number of rows (or columns) of the blocks of the
+ * triangular products
+ */
+constexpr size_t trmm_block = 64;
+
+/*!
+ * \brief The number of rows of the dense matrix packed at once by
+ * trmm_right
+ */
+constexpr size_t trmm_rows = 256;
+
+/*!
+ * \brief Returns the block to process at the given position.
+ *
+ * The cheap and the expensive blocks are interleaved so that each thread
+ * receives a similar amount of work.
+ *
+ * \param position The position of the block
+ * \param blocks The number of blocks
+ */
+inline size_t trmm_interleave(size_t position, size_t blocks) {
+    return position % 2 == 0 ? position / 2 : blocks - 1 - position / 2;
+}
+
+/*!
+ * \brief Compute c = t * b, with t triangular.
+ *
+ * \param t The triangular matrix (n x n, row-major)
+ * \param b The dense matrix (n x m, row-major)
+ * \param c The result matrix (n x m, row-major)
+ * \param n The dimension of the triangular matrix
+ * \param m The number of columns of b and c
+ * \tparam Lower If true, t is lower triangular, otherwise upper
+ */
+template <bool Lower, typename T>
+void trmm_left(const T* t, const T* b, T* c, size_t n, size_t m) {
+    const size_t blocks = (n + trmm_block - 1) / trmm_block;
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        std::vector<T> pack;
+
+        for (size_t p = first; p < last; ++p) {
+            const size_t i0   = trmm_interleave(p, blocks) * trmm_block;
+            const size_t rows = std::min(trmm_block, n - i0);
+
+            // Only the columns [k0, k1) of the rows are not zero
+            const size_t k0 = Lower ? 0 : i0;
+            const size_t k1 = Lower ? i0 + rows : n;
+            const size_t K  = k1 - k0;
+
+            pack.resize(rows * K);
+
+            for (size_t i = 0; i < rows; ++i) {
+                std::copy_n(t + (i0 + i) * n + k0, K, pack.data() + i * K);
+            }
+
+            gemm_rr_to_r(pack.data(), b + k0 * m, c + i0 * m, rows, m, K);
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, blocks, engine_select_parallel(n * n * m / 2, tuning().parallel_threshold) && blocks > 1);
+}
+
+/*!
+ * \brief Compute c = b * t, with t triangular.
+ *
+ * \param b The dense matrix (m x n, row-major)
+ * \param t The triangular matrix (n x n, row-major)
+ * \param c The result matrix (m x n, row-major)
+ * \param m The number of rows of b and c
+ * \param n The dimension of the triangular matrix
+ * \tparam Lower If true, t is lower triangular, otherwise upper
+ */
+template <bool Lower, typename T>
+void trmm_right(const T* b, const T* t, T* c, size_t m, size_t n) {
+    const size_t blocks = (n + trmm_block - 1) / trmm_block;
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        std::vector<T> b_pack;
+        std::vector<T> t_pack;
+        std::vector<T> c_pack;
+
+        for (size_t p = first; p < last; ++p) {
+            const size_t j0 = trmm_interleave(p, blocks) * trmm_block;
+            const size_t w  = std::min(trmm_block, n - j0);
+
+            // Only the rows [k0, k1) of the columns are not zero
+            const size_t k0 = Lower ? j0 : 0;
+            const size_t k1 = Lower ? n : j0 + w;
+            const size_t K  = k1 - k0;
+
+            t_pack.resize(K * w);
+
+            for (size_t k = 0; k < K; ++k) {
+                std::copy_n(t + (k0 + k) * n + j0, w, t_pack.data() + k * w);
+            }
+
+            for (size_t r0 = 0; r0 < m; r0 += trmm_rows) {
+                const size_t rows = std::min(trmm_rows, m - r0);
+
+                b_pack.resize(rows * K);
+                c_pack.resize(rows * w);
+
+                for (size_t i = 0; i < rows; ++i) {
+                    std::copy_n(b + (r0 + i) * n + k0, K, b_pack.data() + i * K);
+                }
+
+                gemm_rr_to_r(b_pack.data(), t_pack.data(), c_pack.data(), rows, w, K);
+
+                for (size_t i = 0; i < rows; ++i) {
+                    std::copy_n(c_pack.data() + i * w, w, c + (r0 + i) * n + j0);
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, blocks, engine_select_parallel(n * n * m / 2, tuning().parallel_threshold) && blocks > 1);
+}
+
+} //end of namespace etl::impl::vec
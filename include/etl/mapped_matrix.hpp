@@ -0,0 +1,384 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Matrix backed by a memory-mapped file in the binary format.
+ *
+ * The values of the file are not copied, the file is mapped in memory
+ * and exposed as a custom_dyn_matrix. The pages are only loaded when
+ * they are accessed and read-only mappings of the same file are shared
+ * between processes through the page cache.
+ */
+
+#pragma once
+
+#if ETL_MMAP_BOOL
+
+#include <string>     //For the path
+#include <sys/mman.h> //For mmap
+#include <sys/stat.h> //For fstat
+#include <fcntl.h>    //For open
+#include <unistd.h>   //For close
+
+namespace etl {
+
+/*!
+ * \brief The mode of a mapped matrix
+ */
+enum class map_mode {
+    READ_ONLY,    ///< The values are shared with the file and cannot be modified
+    COPY_ON_WRITE ///< The values can be modified, the modified pages are private to the process and never written to the file
+};
+
+/*!
+ * \brief Matrix whose values are mapped from a file written by
+ * save_binary.
+ *
+ * The matrix itself is accessed with matrix(), which returns a
+ * read-only view over the mapped memory that can be used in any
+ * expression. In COPY_ON_WRITE mode, mutable_matrix() returns a
+ * custom_dyn_matrix over the same memory that can be modified. The
+ * views must not be used after the mapped_matrix is destroyed.
+ *
+ * Only available on POSIX systems (etl::mmap_enabled).
+ *
+ * The values are aligned on the alignment of the file (64 bytes with
+ * save_binary). The views are custom_dyn matrices, which do not know
+ * the alignment of their memory: the vectorized code always uses
+ * unaligned loads and stores on them. On aligned memory, these are as
+ * fast as the aligned instructions on AVX and later. Files written with
+ * the other byte order are converted into private pages when they are
+ * opened.
+ *
+ * \tparam T The value type
+ * \tparam D The number of dimensions
+ * \tparam SO The storage order
+ */
+template <typename T, size_t D = 2, order SO = order::RowMajor>
+struct mapped_matrix {
+    static_assert(std::is_trivially_copyable_v<T>, "mapped_matrix is only supported for trivially copyable values");
+
+    using value_type          = T;                                             ///< The value type
+    using mutable_matrix_type = custom_dyn_matrix_impl<T, SO, D>;              ///< The type of the mutable view over the values
+    using matrix_type         = dyn_matrix_view<const mutable_matrix_type, D>; ///< The type of the read-only view over the values
+
+    /*!
+     * \brief Map the given file.
+     *
+     * The status of the operation must be checked with status() before
+     * using the matrix.
+     *
+     * \param path The path to the file
+     * \param mode The mapping mode
+     */
+    explicit mapped_matrix(const std::string& path, map_mode mode = map_mode::READ_ONLY) : _mode(mode) {
+        _status = open(path);
+
+        if (_status != binary_status::OK) {
+            unmap();
+        }
+    }
+
+    mapped_matrix(const mapped_matrix& rhs) = delete;
+    mapped_matrix& operator=(const mapped_matrix& rhs) = delete;
+
+    /*!
+     * \brief Move construct a mapped matrix
+     * \param rhs The mapped matrix to move from
+     */
+    mapped_matrix(mapped_matrix&& rhs) noexcept
+            : _mode(rhs._mode),
+              _status(rhs._status),
+              _mapping(rhs._mapping),
+              _length(rhs._length),
+              _values(rhs._values),
+              _flags(rhs._flags),
+              _swapped(rhs._swapped),
+              _dimensions(rhs._dimensions) {
+        rhs._mapping = nullptr;
+        rhs._length  = 0;
+        rhs._values  = nullptr;
+        rhs._status  = binary_status::IO_ERROR;
+    }
+
+    /*!
+     * \brief Move assign a mapped matrix
+     * \param rhs The mapped matrix to move from
+     * \return a reference to this mapped matrix
+     */
+    mapped_matrix& operator=(mapped_matrix&& rhs) noexcept {
+        if (this != &rhs) {
+            unmap();
+
+            _mode       = rhs._mode;
+            _status     = rhs._status;
+            _mapping    = rhs._mapping;
+            _length     = rhs._length;
+            _values     = rhs._values;
+            _flags      = rhs._flags;
+            _swapped    = rhs._swapped;
+            _dimensions = rhs._dimensions;
+
+            rhs._mapping = nullptr;
+            rhs._length  = 0;
+            rhs._values  = nullptr;
+            rhs._status  = binary_status::IO_ERROR;
+        }
+
+        return *this;
+    }
+
+    /*!
+     * \brief Unmap the file
+     */
+    ~mapped_matrix() {
+        unmap();
+    }
+
+    /*!
+     * \brief Returns the status of the mapping
+     * \return binary_status::OK if the file is mapped, the reason of the failure otherwise
+     */
+    binary_status status() const noexcept {
+        return _status;
+    }
+
+    /*!
+     * \brief Indicates if the file is mapped
+     */
+    explicit operator bool() const noexcept {
+        return _status == binary_status::OK;
+    }
+
+    /*!
+     * \brief Returns the mapping mode
+     */
+    map_mode mode() const noexcept {
+        return _mode;
+    }
+
+    /*!
+     * \brief Returns a read-only view over the mapped values
+     *
+     * The file must be mapped.
+     */
+    matrix_type matrix() const noexcept {
+        cpp_assert(_values, "The file must be mapped to access its values");
+
+        return std::apply([this](auto... dims) { return matrix_type(mutable_matrix_type(_values, dims...), dims...); }, _dimensions);
+    }
+
+    /*!
+     * \brief Returns a mutable view over the mapped values
+     *
+     * The file must be mapped in COPY_ON_WRITE mode, the pages of a
+     * READ_ONLY mapping cannot be written.
+     */
+    mutable_matrix_type mutable_matrix() noexcept {
+        cpp_assert(_mode == map_mode::COPY_ON_WRITE, "Only COPY_ON_WRITE mappings can be modified");
+
+        return std::apply([this](auto... dims) { return mutable_matrix_type(_values, dims...); }, _dimensions);
+    }
+
+    /*!
+     * \brief Returns the number of values
+     */
+    size_t size() const noexcept {
+        if (!_values) {
+            return 0;
+        }
+
+        size_t n = 1;
+
+        for (auto d : _dimensions) {
+            n *= d;
+        }
+
+        return n;
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the matrix
+     */
+    size_t dim(size_t d) const noexcept {
+        return _dimensions[d];
+    }
+
+    /*!
+     * \brief Returns a pointer to the first mapped value
+     */
+    const T* memory_start() const noexcept {
+        return _values;
+    }
+
+    /*!
+     * \brief Verify the checksum of the values, if the file has one.
+     *
+     * This reads all the values of the file and is therefore not done
+     * when the file is mapped (except for files in the other byte
+     * order, whose values must be converted anyway). The checksum is
+     * computed on the current values, it will not match once they have
+     * been modified.
+     *
+     * \return binary_status::BAD_CHECKSUM if the values do not match the checksum, binary_status::OK if they match or if there is no checksum
+     */
+    binary_status verify() const {
+        if (_status != binary_status::OK) {
+            return _status;
+        }
+
+        if (!(_flags & binary_detail::checksum_flag) || _swapped) {
+            return binary_status::OK;
+        }
+
+        const char* values = reinterpret_cast<const char*>(_values);
+        const size_t bytes = size() * sizeof(T);
+
+        uint64_t expected = 0;
+        std::memcpy(&expected, values + bytes, sizeof(expected));
+
+        return binary_detail::checksum(values, bytes, false) == expected ? binary_status::OK : binary_status::BAD_CHECKSUM;
+    }
+
+private:
+    /*!
+     * \brief Map the file, parse its header and locate the values
+     * \param path The path to the file
+     * \return the status of the operation
+     */
+    binary_status open(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+
+        if (fd < 0) {
+            return binary_status::IO_ERROR;
+        }
+
+        struct stat infos;
+
+        if (fstat(fd, &infos) != 0 || infos.st_size <= 0) {
+            ::close(fd);
+            return binary_status::IO_ERROR;
+        }
+
+        _length = infos.st_size;
+
+        // A file of the other byte order needs private writable pages to
+        // be converted, which is only known once the header is read
+        const bool writable = _mode == map_mode::COPY_ON_WRITE || peek_swapped(fd);
+
+        void* mapping = mmap(nullptr, _length, PROT_READ | (writable ? PROT_WRITE : 0), writable ? MAP_PRIVATE : MAP_SHARED, fd, 0);
+
+        // The mapping stays valid after the file is closed
+        ::close(fd);
+
+        if (mapping == MAP_FAILED) {
+            _length = 0;
+            return binary_status::IO_ERROR;
+        }
+
+        _mapping = mapping;
+
+        binary_detail::memory_stream stream(static_cast<const char*>(_mapping), _length);
+        binary_detail::header<D> header;
+
+        auto status = binary_detail::read_header<T, SO>(stream, header);
+
+        if (status != binary_status::OK) {
+            return status;
+        }
+
+        _flags      = header.flags;
+        _swapped    = header.swap;
+        _dimensions = header.dimensions;
+
+        const size_t checksum  = (_flags & binary_detail::checksum_flag) ? sizeof(uint64_t) : 0;
+        const size_t available = (_length - stream.position) / sizeof(T);
+
+        // Check the dimensions against the size of the file, without overflow
+        size_t n = 1;
+
+        for (auto d : _dimensions) {
+            if (d && n > available / d) {
+                return binary_status::IO_ERROR;
+            }
+
+            n *= d;
+        }
+
+        const size_t bytes = n * sizeof(T);
+
+        if (_length - stream.position < bytes + checksum) {
+            return binary_status::IO_ERROR;
+        }
+
+        char* values = static_cast<char*>(_mapping) + stream.position;
+
+        if (reinterpret_cast<uintptr_t>(values) % alignof(T)) {
+            return binary_status::IO_ERROR;
+        }
+
+        if (_swapped) {
+            if (checksum) {
+                uint64_t expected = 0;
+                std::memcpy(&expected, values + bytes, sizeof(expected));
+                binary_detail::swap_bytes(reinterpret_cast<char*>(&expected), 1, sizeof(expected));
+
+                if (binary_detail::checksum(values, bytes, true) != expected) {
+                    return binary_status::BAD_CHECKSUM;
+                }
+            }
+
+            constexpr size_t width = binary_detail::scalar_size<T>();
+            binary_detail::swap_bytes(values, bytes / width, width);
+
+            if (_mode == map_mode::READ_ONLY) {
+                mprotect(_mapping, _length, PROT_READ);
+            }
+        }
+
+        _values = reinterpret_cast<T*>(values);
+
+        return binary_status::OK;
+    }
+
+    /*!
+     * \brief Indicates if the file was written with the other byte order
+     * \param fd The file descriptor
+     */
+    static bool peek_swapped(int fd) {
+        uint32_t bom = 0;
+        return pread(fd, &bom, sizeof(bom), sizeof(binary_detail::magic)) == ssize_t(sizeof(bom)) && bom == binary_detail::swapped_order;
+    }
+
+    /*!
+     * \brief Release the mapping, if any
+     */
+    void unmap() noexcept {
+        if (_mapping) {
+            munmap(_mapping, _length);
+        }
+
+        _mapping = nullptr;
+        _length  = 0;
+        _values  = nullptr;
+        _dimensions.fill(0);
+    }
+
+    map_mode _mode                    = map_mode::READ_ONLY;      ///< The mapping mode
+    binary_status _status             = binary_status::IO_ERROR; ///< The status of the mapping
+    void* _mapping                    = nullptr;                 ///< The mapped memory
+    size_t _length                    = 0;                       ///< The length of the mapping
+    T* _values                        = nullptr;                 ///< The first value in the mapping
+    uint8_t _flags                    = 0;                       ///< The flags of the file
+    bool _swapped                     = false;                   ///< Indicates if the values have been converted from the other byte order
+    std::array<size_t, D> _dimensions = {};                      ///< The dimensions of the matrix
+};
+
+} //end of namespace etl
+
+#endif
@@ -17,7 +17,7 @@ namespace etl {
  * \param threshold The parallel threshold
  * \return true if the evaluation should be done in paralle, false otherwise
  */
-inline bool engine_select_parallel(size_t n, size_t threshold = parallel_threshold) {
+inline bool engine_select_parallel(size_t n, size_t threshold = tuning().parallel_threshold) {
     return threads > 1 && !local_context().serial && (local_context().parallel || (is_parallel && n >= threshold));
 }
 
@@ -640,6 +640,92 @@ inline void engine_dispatch_1d_acc_slice(E&& expr, Functor&& functor, AccFunctor
     }
 }
 
+/*!
+ * \brief Dispatch the elements of an ETL container in a parallel manner
+ * and reduce the partial results of each slice with a tree.
+ *
+ * The functors will be called with slices of the original expression.
+ * The partial results are combined pairwise, which keeps the rounding
+ * error of the combination logarithmic in the number of threads.
+ *
+ * \param expr The expression to slice
+ * \param functor The functor to execute on each slice
+ * \param combine The functor to combine two partial results
+ * \param threshold The threshold for paralellization
+ * \tparam R The type of the partial results
+ * \return the combined result
+ */
+template <typename R, typename E, typename Functor, typename Combine>
+inline R engine_dispatch_1d_reduce_slice(E&& expr, Functor&& functor, Combine&& combine, size_t threshold) {
+    using TT = value_t<E>;
+
+    static constexpr size_t S = default_intrinsic_traits<TT>::size;
+
+    const size_t n = etl::size(expr);
+
+    if (!n || !engine_select_parallel(n, threshold)) {
+        return functor(expr);
+    }
+
+    const size_t T = std::min(n, etl::threads);
+
+    std::vector<R> partials(T);
+
+    auto sub_functor = [&partials, &functor](size_t t, auto&& sub_expr) { partials[t] = functor(sub_expr); };
+
+    ETL_PARALLEL_SESSION {
+        thread_engine::acquire();
+
+        if constexpr (decay_traits<E>::is_aligned && S > 1) {
+            if (n >= T * S) {
+                // In case there is enough data, we align it
+
+                const size_t n_aligned         = (n + (S - 1)) & ~(S - 1);
+                const size_t blocks            = n_aligned / S;
+                const size_t blocks_per_thread = blocks / T;
+                const size_t batch             = blocks_per_thread * S;
+
+                for (size_t t = 0; t < T - 1; ++t) {
+                    thread_engine::schedule(sub_functor, t, memory_slice<aligned>(expr, t * batch, (t + 1) * batch));
+                }
+
+                thread_engine::schedule(sub_functor, T - 1, memory_slice<aligned>(expr, (T - 1) * batch, n));
+            } else {
+                // Not enough data to consider aligning
+
+                const size_t batch = n / T;
+
+                for (size_t t = 0; t < T - 1; ++t) {
+                    thread_engine::schedule(sub_functor, t, memory_slice<unaligned>(expr, t * batch, (t + 1) * batch));
+                }
+
+                thread_engine::schedule(sub_functor, T - 1, memory_slice<unaligned>(expr, (T - 1) * batch, n));
+            }
+        } else {
+            // If the data is not aligned in the first, don't make any effort to align it
+
+            const size_t batch = n / T;
+
+            for (size_t t = 0; t < T - 1; ++t) {
+                thread_engine::schedule(sub_functor, t, memory_slice<unaligned>(expr, t * batch, (t + 1) * batch));
+            }
+
+            thread_engine::schedule(sub_functor, T - 1, memory_slice<unaligned>(expr, (T - 1) * batch, n));
+        }
+
+        thread_engine::wait();
+    }
+
+    // Combine the partial results as a tree
+    for (size_t step = 1; step < T; step *= 2) {
+        for (size_t t = 0; t + step < T; t += 2 * step) {
+            partials[t] = combine(partials[t], partials[t + step]);
+        }
+    }
+
+    return partials[0];
+}
+
 #else
 
 /*!
@@ -648,7 +734,7 @@ inline void engine_dispatch_1d_acc_slice(E&& expr, Functor&& functor, AccFunctor
  * \param threshold The parallel threshold
  * \return true if the evaluation should be done in paralle, false otherwise
  */
-inline bool engine_select_parallel([[maybe_unused]] size_t n, [[maybe_unused]] size_t threshold = parallel_threshold) {
+inline bool engine_select_parallel([[maybe_unused]] size_t n, [[maybe_unused]] size_t threshold = tuning().parallel_threshold) {
     return false;
 }
 
@@ -863,6 +949,24 @@ inline void engine_dispatch_1d_acc_slice(E&& expr, Functor&& functor, AccFunctor
     acc_functor(functor(expr));
 }
 
+/*!
+ * \brief Dispatch the elements of an ETL container in a parallel manner
+ * and reduce the partial results of each slice with a tree.
+ *
+ * The functors will be called with slices of the original expression.
+ *
+ * \param expr The expression to slice
+ * \param functor The functor to execute on each slice
+ * \param combine The functor to combine two partial results
+ * \param threshold The threshold for paralellization
+ * \tparam R The type of the partial results
+ * \return the combined result
+ */
+template <typename R, typename E, typename Functor, typename Combine>
+inline R engine_dispatch_1d_reduce_slice(E&& expr, Functor&& functor, [[maybe_unused]] Combine&& combine, [[maybe_unused]] size_t threshold) {
+    return functor(expr);
+}
+
 #endif
 
 } //end of namespace etl
@@ -42,6 +42,23 @@ struct serializer {
 
         return *this;
     }
+
+    /*!
+     * \brief Outputs the given contiguous values to the stream, with a
+     * single write for arithmetic values
+     * \param values Pointer to the first value
+     * \param n The number of values to write
+     */
+    template <typename T>
+    void write(const T* values, size_t n) {
+        if constexpr (std::is_arithmetic_v<T>) {
+            stream.write(reinterpret_cast<const char_t*>(values), n * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                *this << values[i];
+            }
+        }
+    }
 };
 
 } //end of namespace etl
@@ -235,10 +235,11 @@ struct sparse_matrix_impl<T, sparse_storage::COO, D> final : dyn_base<sparse_mat
 private:
     using base_type::_dimensions;
     using base_type::_size;
-    memory_type _memory;          ///< The memory
-    index_memory_type _row_index; ///< The row index
-    index_memory_type _col_index; ///< The column index
-    size_t nnz;                   ///< The number of nonzeros in the matrix
+    memory_type _memory          = nullptr; ///< The memory
+    index_memory_type _row_index = nullptr; ///< The row index
+    index_memory_type _col_index = nullptr; ///< The column index
+    size_t nnz                   = 0;       ///< The number of nonzeros in the matrix
+    size_t _capacity             = 0;       ///< The number of elements that fit in the allocated memory
 
     using base_type::allocate;
     using base_type::check_invariants;
@@ -262,6 +263,7 @@ private:
             _memory    = allocate(nnz);
             _row_index = base_type::template allocate<index_type>(nnz);
             _col_index = base_type::template allocate<index_type>(nnz);
+            _capacity  = nnz;
 
             auto it  = iterable.begin();
             size_t n = 0;
@@ -282,48 +284,64 @@ private:
     }
 
     /*!
-     * \brief Reserve enough space to put a value in position hint
+     * \brief Release the memory of the three arrays
      */
-    void reserve_hint(size_t hint) {
-        cpp_assert(hint < nnz + 1, "Invalid hint for reserve_hint");
+    void release_all() noexcept {
+        if (_memory) {
+            release(_memory, _capacity);
+            release(_row_index, _capacity);
+            release(_col_index, _capacity);
+        }
+
+        _memory    = nullptr;
+        _row_index = nullptr;
+        _col_index = nullptr;
+        nnz        = 0;
+        _capacity  = 0;
+    }
+
+    /*!
+     * \brief Reallocate the three arrays with the given capacity
+     * \param capacity The new capacity, at least nnz
+     */
+    void reallocate(size_t capacity) {
+        auto new_memory    = allocate(capacity);
+        auto new_row_index = base_type::template allocate<index_type>(capacity);
+        auto new_col_index = base_type::template allocate<index_type>(capacity);
 
         if (_memory) {
-            auto new_memory    = allocate(nnz + 1);
-            auto new_row_index = base_type::template allocate<index_type>(nnz + 1);
-            auto new_col_index = base_type::template allocate<index_type>(nnz + 1);
-
-            if (hint == nnz) {
-                //Copy the elements
-                std::copy_n(_memory, nnz, new_memory);
-                std::copy_n(_row_index, nnz, new_row_index);
-                std::copy_n(_col_index, nnz, new_col_index);
-            } else {
-                //Copy the elements before hint
-                std::copy(_memory, _memory + hint, new_memory);
-                std::copy(_row_index, _row_index + hint, new_row_index);
-                std::copy(_col_index, _col_index + hint, new_col_index);
-
-                //Copy the elements after hint
-                std::copy(_memory + hint, _memory + nnz, new_memory + hint + 1);
-                std::copy(_row_index + hint, _row_index + nnz, new_row_index + hint + 1);
-                std::copy(_col_index + hint, _col_index + nnz, new_col_index + hint + 1);
-            }
+            std::copy_n(_memory, nnz, new_memory);
+            std::copy_n(_row_index, nnz, new_row_index);
+            std::copy_n(_col_index, nnz, new_col_index);
+
+            release(_memory, _capacity);
+            release(_row_index, _capacity);
+            release(_col_index, _capacity);
+        }
 
-            release(_memory, nnz);
-            release(_row_index, nnz);
-            release(_col_index, nnz);
+        _memory    = new_memory;
+        _row_index = new_row_index;
+        _col_index = new_col_index;
+        _capacity  = capacity;
+    }
 
-            _memory    = new_memory;
-            _col_index = new_col_index;
-            _row_index = new_row_index;
-        } else {
-            cpp_assert(hint == 0, "Invalid hint for reserve_hint");
+    /*!
+     * \brief Reserve enough space to put a value in position hint.
+     *
+     * The capacity grows geometrically, so that inserting the elements
+     * one by one only needs a logarithmic number of reallocations.
+     */
+    void reserve_hint(size_t hint) {
+        cpp_assert(hint < nnz + 1, "Invalid hint for reserve_hint");
 
-            _memory    = allocate(nnz + 1);
-            _row_index = base_type::template allocate<index_type>(nnz + 1);
-            _col_index = base_type::template allocate<index_type>(nnz + 1);
+        if (nnz == _capacity) {
+            reallocate(std::max<size_t>(2 * _capacity, 8));
         }
 
+        std::copy_backward(_memory + hint, _memory + nnz, _memory + nnz + 1);
+        std::copy_backward(_row_index + hint, _row_index + nnz, _row_index + nnz + 1);
+        std::copy_backward(_col_index + hint, _col_index + nnz, _col_index + nnz + 1);
+
         ++nnz;
     }
 
@@ -333,64 +351,35 @@ private:
     void erase_hint(size_t n) {
         cpp_assert(nnz > 0, "Invalid erase_hint call (no non-zero elements");
 
-        if (nnz == 1) {
-            release(_memory, nnz);
-            release(_row_index, nnz);
-            release(_col_index, nnz);
-
-            _memory    = nullptr;
-            _row_index = nullptr;
-            _col_index = nullptr;
-        } else {
-            auto new_memory    = allocate(nnz - 1);
-            auto new_row_index = base_type::template allocate<index_type>(nnz - 1);
-            auto new_col_index = base_type::template allocate<index_type>(nnz - 1);
-
-            if (n == nnz - 1) {
-                std::copy_n(_memory, nnz - 1, new_memory);
-                std::copy_n(_row_index, nnz - 1, new_row_index);
-                std::copy_n(_col_index, nnz - 1, new_col_index);
-            } else {
-                std::copy(_memory, _memory + n, new_memory);
-                std::copy(_row_index, _row_index + n, new_row_index);
-                std::copy(_col_index, _col_index + n, new_col_index);
-
-                std::copy(_memory + n + 1, _memory + nnz, new_memory + n);
-                std::copy(_row_index + n + 1, _row_index + nnz, new_row_index + n);
-                std::copy(_col_index + n + 1, _col_index + nnz, new_col_index + n);
-            }
-
-            release(_memory, nnz);
-            release(_row_index, nnz);
-            release(_col_index, nnz);
-
-            _memory    = new_memory;
-            _row_index = new_row_index;
-            _col_index = new_col_index;
-        }
+        std::copy(_memory + n + 1, _memory + nnz, _memory + n);
+        std::copy(_row_index + n + 1, _row_index + nnz, _row_index + n);
+        std::copy(_col_index + n + 1, _col_index + nnz, _col_index + n);
 
         --nnz;
     }
 
     /*!
-     * \brief Find the position of the value at (i,j). Returns nnz
-     * if the position is not found. Can also return a position
-     * already taken if its place of insertion is already taken.
+     * \brief Find the position of the value at (i,j). If the value
+     * does not exist, returns its insertion point.
+     *
+     * The elements are sorted in row-major order, so this is a binary
+     * search.
      */
     size_t find_n(size_t i, size_t j) const noexcept {
-        for (size_t n = 0; n < nnz; ++n) {
-            //The value exists, modify it
-            if (_row_index[n] == i && _col_index[n] == j) {
-                return n;
-            }
+        size_t first = 0;
+        size_t last  = nnz;
+
+        while (first < last) {
+            const size_t middle = first + (last - first) / 2;
 
-            //The insertion point has been found
-            if ((_row_index[n] == i && _col_index[n] > j) || _row_index[n] > i) {
-                return n;
+            if (_row_index[middle] < i || (_row_index[middle] == i && _col_index[middle] < j)) {
+                first = middle + 1;
+            } else {
+                last = middle;
             }
         }
 
-        return nnz;
+        return first;
     }
 
     /*!
@@ -544,6 +533,36 @@ public:
         build_from_iterable(list);
     }
 
+    /*!
+     * \brief Copy construct a sparse matrix
+     * \param rhs The matrix to copy from
+     */
+    sparse_matrix_impl(const sparse_matrix_impl& rhs) : base_type(rhs), _memory(nullptr), _row_index(nullptr), _col_index(nullptr), nnz(rhs.nnz) {
+        if (nnz) {
+            _memory    = allocate(nnz);
+            _row_index = base_type::template allocate<index_type>(nnz);
+            _col_index = base_type::template allocate<index_type>(nnz);
+            _capacity  = nnz;
+
+            std::copy_n(rhs._memory, nnz, _memory);
+            std::copy_n(rhs._row_index, nnz, _row_index);
+            std::copy_n(rhs._col_index, nnz, _col_index);
+        }
+    }
+
+    /*!
+     * \brief Move construct a sparse matrix
+     * \param rhs The matrix to move from
+     */
+    sparse_matrix_impl(sparse_matrix_impl&& rhs) noexcept
+            : base_type(std::move(rhs)), _memory(rhs._memory), _row_index(rhs._row_index), _col_index(rhs._col_index), nnz(rhs.nnz), _capacity(rhs._capacity) {
+        rhs._memory    = nullptr;
+        rhs._row_index = nullptr;
+        rhs._col_index = nullptr;
+        rhs.nnz        = 0;
+        rhs._capacity  = 0;
+    }
+
     /*!
      * \brief Copy assign from another matrix
      *
@@ -576,7 +595,7 @@ public:
     template <typename E,
               cpp_enable_iff(!std::is_same_v<std::decay_t<E>, sparse_matrix_impl<T, storage_format, D>>
                              && std::is_convertible_v<value_t<E>, value_type> && is_etl_expr<E>)>
-    sparse_matrix_impl& operator=(E&& e) noexcept {
+    sparse_matrix_impl& operator=(E&& e) {
         // It is possible that the matrix was not initialized before
         // In the case, get the the dimensions from the expression and
         // initialize the matrix
@@ -587,7 +606,10 @@ public:
         }
 
         // Avoid aliasing issues
-        if constexpr (!decay_traits<E>::is_linear) {
+        if constexpr (is_sparse_mergeable<E, this_type>) {
+            // Computed on the non-zero elements only, before modifying the matrix
+            sparse_merge_assign(e, *this);
+        } else if constexpr (!decay_traits<E>::is_linear) {
             if (e.alias(*this)) {
                 // Create a temporary to hold the result
                 this_type tmp(*this);
@@ -643,16 +665,13 @@ public:
     }
 
     /*!
-     * \brief Returns a reference to the element at the position (i,j)
+     * \brief Returns the value of the element at the position (i,j)
      * \param i The first index
      * \param j The second index
-     * \return a sparse reference (proxy reference) to the element at position (i,j)
+     * \return the value of the element at position (i,j)
      */
-    const_reference_type operator()(size_t i, size_t j) const noexcept(assert_nothrow) {
-        cpp_assert(i < dim(0), "Out of bounds");
-        cpp_assert(j < dim(1), "Out of bounds");
-
-        return {*this, i, j};
+    value_type operator()(size_t i, size_t j) const noexcept(assert_nothrow) {
+        return get(i, j);
     }
 
     /*!
@@ -669,16 +688,14 @@ public:
     }
 
     /*!
-     * \brief Returns the element at the given index
-     * This function may result in insertion of deletion of elements
-     * in the matrix and therefore invalidation of some references.
+     * \brief Returns the value of the element at the given index
      * \param n The index
-     * \return a reference to the element at the given index.
+     * \return the value of the element at the given index.
      */
-    const_reference_type operator[](size_t n) const noexcept(assert_nothrow) {
+    value_type operator[](size_t n) const noexcept(assert_nothrow) {
         cpp_assert(n < size(), "Out of bounds");
 
-        return {*this, n / columns(), n % columns()};
+        return get(n / columns(), n % columns());
     }
 
     /*!
@@ -703,6 +720,123 @@ public:
         return nnz;
     }
 
+    /*!
+     * \brief Call the given functor with (i, j, value) for each non-zero
+     * element of the matrix, in row-major order.
+     * \param functor The functor to call
+     */
+    template <typename F>
+    void for_each_non_zero(F&& functor) const {
+        for (size_t n = 0; n < nnz; ++n) {
+            functor(_row_index[n], _col_index[n], _memory[n]);
+        }
+    }
+
+    /*!
+     * \brief Returns the number of non-zero elements that can be stored
+     * without reallocation.
+     */
+    size_t capacity() const noexcept {
+        return _capacity;
+    }
+
+    /*!
+     * \brief Reserve memory for at least the given number of non-zero
+     * elements
+     * \param capacity The number of non-zero elements to reserve space for
+     */
+    void reserve(size_t capacity) {
+        if (capacity > _capacity) {
+            reallocate(capacity);
+        }
+    }
+
+    /*!
+     * \brief Insert a batch of elements in the matrix.
+     *
+     * The result is the same as calling set(i, j, value) for each
+     * triplet in order: the new values replace the existing ones, the
+     * last duplicate wins and a zero value erases the element. The
+     * batch is sorted and merged with the existing elements in a single
+     * pass, in O(nnz + b log b) instead of O(b * nnz).
+     *
+     * \param batch The elements to insert
+     */
+    void insert_batch(std::vector<sparse_triplet<value_type>> batch) {
+        for ([[maybe_unused]] auto& t : batch) {
+            cpp_assert(t.i < dim(0), "Out of bounds");
+            cpp_assert(t.j < dim(1), "Out of bounds");
+        }
+
+        sparse_detail::sort_triplets<true>(batch, rows());
+        sparse_detail::merge_duplicates(batch, false);
+
+        std::vector<sparse_triplet<value_type>> existing;
+        existing.reserve(nnz);
+        for_each_non_zero([&existing](size_t i, size_t j, value_type v) { existing.push_back({i, j, v}); });
+
+        assign_triplets(sparse_detail::merge_triplets<true>(existing, batch));
+    }
+
+    /*!
+     * \brief Build a sparse matrix from a list of triplets.
+     *
+     * The triplets can be given in any order. The values of the
+     * duplicates are summed. The matrix is built with a single sort and
+     * a single allocation.
+     *
+     * \param rows The number of rows of the matrix
+     * \param columns The number of columns of the matrix
+     * \param triplets The elements of the matrix
+     * \return The new sparse matrix
+     */
+    static sparse_matrix_impl from_triplets(size_t rows, size_t columns, std::vector<sparse_triplet<value_type>> triplets) {
+        sparse_matrix_impl matrix(rows, columns);
+
+        for ([[maybe_unused]] auto& t : triplets) {
+            cpp_assert(t.i < rows, "Out of bounds");
+            cpp_assert(t.j < columns, "Out of bounds");
+        }
+
+        sparse_detail::sort_triplets<true>(triplets, rows);
+        sparse_detail::merge_duplicates(triplets, true);
+
+        matrix.assign_triplets(triplets);
+
+        return matrix;
+    }
+
+    /*!
+     * \brief Replace the content of the matrix with the given sorted
+     * triplets. The zero values are not stored.
+     * \param triplets The triplets, in row-major order and without duplicates
+     */
+    void assign_triplets(const std::vector<sparse_triplet<value_type>>& triplets) {
+        cpp_assert(std::adjacent_find(triplets.begin(), triplets.end(),
+                                      [](auto& a, auto& b) { return std::make_pair(a.i, a.j) >= std::make_pair(b.i, b.j); })
+                       == triplets.end(),
+                   "The triplets must be sorted in row-major order and without duplicates");
+
+        release_all();
+
+        const size_t count = std::count_if(triplets.begin(), triplets.end(), [](auto& t) { return sparse_detail::is_non_zero(t.value); });
+
+        if (!count) {
+            return;
+        }
+
+        reallocate(count);
+
+        for (auto& t : triplets) {
+            if (sparse_detail::is_non_zero(t.value)) {
+                _memory[nnz]    = t.value;
+                _row_index[nnz] = t.i;
+                _col_index[nnz] = t.j;
+                ++nnz;
+            }
+        }
+    }
+
     /*!
      * \brief Sets the element at the given position (i, j) to the given value
      * \param i The first index
@@ -770,7 +904,12 @@ public:
      */
     template <typename E, cpp_disable_iff(is_sparse_matrix<E>)>
     bool alias(const E& rhs) const noexcept {
-        return rhs.alias(*this);
+        if constexpr (is_dma<E>) {
+            // A dense container cannot share memory with a sparse matrix
+            return false;
+        } else {
+            return rhs.alias(*this);
+        }
     }
 
     // Internals
@@ -786,11 +925,7 @@ public:
      * \brief Destructs the matrix and releases all its memory
      */
     ~sparse_matrix_impl() noexcept {
-        if (_memory) {
-            release(_memory, nnz);
-            release(_row_index, nnz);
-            release(_col_index, nnz);
-        }
+        release_all();
     }
 
     /*!
@@ -880,4 +1015,961 @@ public:
     }
 };
 
+/*!
+ * \brief Sparse matrix implementation with compressed storage (CSR or CSC).
+ *
+ * The non-zero values are stored contiguously, outer slice after outer
+ * slice (rows for CSR, columns for CSC). For each value, the inner index
+ * (column for CSR, row for CSC) is stored and, for each outer slice, the
+ * position of its first value is stored. The inner indices of each
+ * slice are sorted.
+ *
+ * \tparam T The type of value
+ * \tparam SS The storage type
+ * \tparam D The number of dimensions
+ */
+template <typename T, sparse_storage SS, size_t D>
+struct sparse_matrix_impl final : dyn_base<sparse_matrix_impl<T, SS, D>, T, D> {
+    static constexpr size_t n_dimensions           = D;                                      ///< The number of dimensions
+    static constexpr sparse_storage storage_format = SS;                                     ///< The sparse storage scheme
+    static constexpr order storage_order           = order::RowMajor;                        ///< The storage order
+    static constexpr size_t alignment              = default_intrinsic_traits<T>::alignment; ///< The alignment
+    static constexpr bool row_compressed           = SS == sparse_storage::CSR;              ///< Indicates if the rows are the outer slices
+
+    using this_type              = sparse_matrix_impl<T, SS, D>;                     ///< this type
+    using base_type              = dyn_base<this_type, T, D>;                        ///< The base type
+    using reference_type         = sparse_detail::sparse_reference<this_type>;       ///< The type of reference returned by the functions
+    using const_reference_type   = sparse_detail::sparse_reference<const this_type>; ///< The type of const reference returned by the functions
+    using value_type             = T;                                                ///< The type of value returned by the function
+    using dimension_storage_impl = std::array<size_t, n_dimensions>;                 ///< The type used to store the dimensions
+    using memory_type            = value_type*;                                      ///< The memory type
+    using const_memory_type      = const value_type*;                                ///< The const memory type
+    using index_type             = size_t;                                           ///< The type used to store the indices
+    using index_memory_type      = index_type*;                                      ///< The memory type to the indices
+
+    friend struct sparse_detail::sparse_reference<this_type>;
+    friend struct sparse_detail::sparse_reference<const this_type>;
+
+    static_assert(SS == sparse_storage::CSR || SS == sparse_storage::CSC, "Invalid compressed sparse storage");
+    static_assert(n_dimensions == 2, "Only 2D sparse matrix are supported");
+
+private:
+    using base_type::_dimensions;
+    using base_type::_size;
+    memory_type _memory;            ///< The non-zero values
+    index_memory_type _inner_index; ///< The inner index of each non-zero value
+    index_memory_type _outer_index; ///< The position of the first value of each outer slice
+    size_t nnz;                     ///< The number of nonzeros in the matrix
+    size_t _capacity = 0;           ///< The number of elements that fit in the allocated memory
+
+    using base_type::allocate;
+    using base_type::check_invariants;
+    using base_type::release;
+
+    /*!
+     * \brief Returns the outer index of the element (i, j)
+     */
+    static size_t outer_of(size_t i, size_t j) noexcept {
+        return row_compressed ? i : j;
+    }
+
+    /*!
+     * \brief Returns the inner index of the element (i, j)
+     */
+    static size_t inner_of(size_t i, size_t j) noexcept {
+        return row_compressed ? j : i;
+    }
+
+    /*!
+     * \brief Release all the memory of the matrix
+     */
+    void release_all() noexcept {
+        if (_memory) {
+            release(_memory, _capacity);
+            release(_inner_index, _capacity);
+        }
+
+        if (_outer_index) {
+            release(_outer_index, outer_size() + 1);
+        }
+
+        _memory      = nullptr;
+        _inner_index = nullptr;
+        _outer_index = nullptr;
+        nnz          = 0;
+        _capacity    = 0;
+    }
+
+    /*!
+     * \brief Reallocate the values and the inner index with the given capacity
+     * \param capacity The new capacity, at least nnz
+     */
+    void reallocate(size_t capacity) {
+        auto new_memory      = allocate(capacity);
+        auto new_inner_index = base_type::template allocate<index_type>(capacity);
+
+        if (_memory) {
+            std::copy_n(_memory, nnz, new_memory);
+            std::copy_n(_inner_index, nnz, new_inner_index);
+
+            release(_memory, _capacity);
+            release(_inner_index, _capacity);
+        }
+
+        _memory      = new_memory;
+        _inner_index = new_inner_index;
+        _capacity    = capacity;
+    }
+
+    /*!
+     * \brief Allocate the (empty) outer index of the matrix
+     */
+    void init_outer() {
+        _outer_index = base_type::template allocate<index_type>(outer_size() + 1);
+        std::fill_n(_outer_index, outer_size() + 1, index_type(0));
+    }
+
+    /*!
+     * \brief Build the content of the matrix from a set of non-zero elements.
+     *
+     * The visitor is called twice with a functor taking (i, j, value)
+     * and must visit the elements in the same order each time. Inside
+     * an outer slice, the elements must be visited in increasing inner
+     * order. This is the case for any row-major or column-major
+     * traversal.
+     *
+     * \param count The number of non-zero elements
+     * \param visit The visitor of the elements
+     */
+    template <typename V>
+    void build(size_t count, V&& visit) {
+        release_all();
+        init_outer();
+
+        nnz = count;
+
+        if (!nnz) {
+            return;
+        }
+
+        _memory      = allocate(nnz);
+        _inner_index = base_type::template allocate<index_type>(nnz);
+        _capacity    = nnz;
+
+        // Count the elements of each outer slice
+        visit([this](size_t i, size_t j, value_type) { ++_outer_index[outer_of(i, j) + 1]; });
+
+        for (size_t o = 0; o < outer_size(); ++o) {
+            _outer_index[o + 1] += _outer_index[o];
+        }
+
+        // Scatter the elements in their slice
+        std::vector<index_type> next(_outer_index, _outer_index + outer_size());
+
+        visit([this, &next](size_t i, size_t j, value_type v) {
+            auto& n = next[outer_of(i, j)];
+
+            _memory[n]      = v;
+            _inner_index[n] = inner_of(i, j);
+
+            ++n;
+        });
+    }
+
+    /*!
+     * \brief Build the content of the sparse matrix from an
+     * iterable collection
+     */
+    template <typename It>
+    void build_from_iterable(const It& iterable) {
+        size_t count = 0;
+        for (auto v : iterable) {
+            if (sparse_detail::is_non_zero(v)) {
+                ++count;
+            }
+        }
+
+        build(count, [this, &iterable](auto&& functor) {
+            auto it = iterable.begin();
+
+            for (size_t i = 0; i < rows(); ++i) {
+                for (size_t j = 0; j < columns(); ++j) {
+                    if (sparse_detail::is_non_zero(*it)) {
+                        functor(i, j, value_type(*it));
+                    }
+
+                    ++it;
+                }
+            }
+        });
+    }
+
+    /*!
+     * \brief Reserve enough space to put a value in position n of the
+     * outer slice o.
+     *
+     * The capacity grows geometrically, so that inserting the elements
+     * one by one only needs a logarithmic number of reallocations.
+     */
+    void reserve_hint(size_t o, size_t n) {
+        cpp_assert(n < nnz + 1, "Invalid hint for reserve_hint");
+
+        if (nnz == _capacity) {
+            reallocate(std::max<size_t>(2 * _capacity, 8));
+        }
+
+        std::copy_backward(_memory + n, _memory + nnz, _memory + nnz + 1);
+        std::copy_backward(_inner_index + n, _inner_index + nnz, _inner_index + nnz + 1);
+
+        for (size_t oo = o + 1; oo < outer_size() + 1; ++oo) {
+            ++_outer_index[oo];
+        }
+
+        ++nnz;
+    }
+
+    /*!
+     * \brief Erase the value in position n of the outer slice o
+     */
+    void erase_hint(size_t o, size_t n) {
+        cpp_assert(nnz > 0, "Invalid erase_hint call (no non-zero elements");
+
+        std::copy(_memory + n + 1, _memory + nnz, _memory + n);
+        std::copy(_inner_index + n + 1, _inner_index + nnz, _inner_index + n);
+
+        for (size_t oo = o + 1; oo < outer_size() + 1; ++oo) {
+            --_outer_index[oo];
+        }
+
+        --nnz;
+    }
+
+    /*!
+     * \brief Find the position of the value at (i,j). If the value
+     * does not exist, returns its insertion point.
+     */
+    size_t find_n(size_t i, size_t j) const noexcept {
+        const size_t o = outer_of(i, j);
+
+        return std::lower_bound(_inner_index + _outer_index[o], _inner_index + _outer_index[o + 1], inner_of(i, j)) - _inner_index;
+    }
+
+    /*!
+     * \brief Indicates if the position n contains the value at (i,j)
+     */
+    bool is_hint(size_t i, size_t j, size_t n) const noexcept {
+        return n < _outer_index[outer_of(i, j) + 1] && _inner_index[n] == inner_of(i, j);
+    }
+
+    /*!
+     * \brief Set the value at index (i,j) and position n
+     * \param value The new value to set
+     */
+    void unsafe_set_hint(size_t i, size_t j, size_t n, value_type value) {
+        //The value exists, modify it
+        if (is_hint(i, j, n)) {
+            _memory[n] = value;
+            return;
+        }
+
+        reserve_hint(outer_of(i, j), n);
+
+        _memory[n]      = value;
+        _inner_index[n] = inner_of(i, j);
+    }
+
+    /*!
+     * \brief Get the value at index (i,j) and position n
+     */
+    value_type get_hint(size_t i, size_t j, size_t n) const noexcept {
+        if (is_hint(i, j, n)) {
+            return _memory[n];
+        }
+
+        return 0.0;
+    }
+
+    /*!
+     * \brief Set the value at index (i,j) and position n.
+     */
+    void set_hint(size_t i, size_t j, size_t n, value_type value) {
+        if (is_hint(i, j, n)) {
+            //At this point, there is already a value for (i,j)
+            //If zero, we remove it, otherwise edit it
+            if (sparse_detail::is_non_zero(value)) {
+                _memory[n] = value;
+            } else {
+                erase_hint(outer_of(i, j), n);
+            }
+        } else if (sparse_detail::is_non_zero(value)) {
+            //At this point, the value does not exist
+            //We insert it if not zero
+            unsafe_set_hint(i, j, n, value);
+        }
+    }
+
+    /*!
+     * \brief Get a direct reference to the element at position n
+     */
+    value_type& unsafe_ref_hint(size_t n) {
+        return _memory[n];
+    }
+
+    /*!
+     * \brief Get a direct const reference to the element at position n
+     */
+    const value_type& unsafe_ref_hint(size_t n) const {
+        return _memory[n];
+    }
+
+    /*!
+     * \brief Inherit the dimensions of an ETL expressions.
+     * This must only be called when the matrix has no dimensions
+     * \param e The expression to get the dimensions from.
+     */
+    template <typename E, cpp_enable_iff(etl::decay_traits<E>::is_generator)>
+    void inherit([[maybe_unused]] const E& e) {
+        cpp_unreachable("Impossible to inherit dimensions from generators");
+    }
+
+    /*!
+     * \brief Inherit the dimensions of an ETL expressions.
+     * This must only be called when the matrix has no dimensions
+     * \param e The expression to get the dimensions from.
+     */
+    template <typename E, cpp_disable_iff(etl::decay_traits<E>::is_generator)>
+    void inherit(const E& e) {
+        cpp_assert(n_dimensions == etl::dimensions(e), "Invalid number of dimensions");
+
+        if (_outer_index) {
+            release(_outer_index, outer_size() + 1);
+        }
+
+        // Compute the size and new dimensions
+        _size = 1;
+        for (size_t d = 0; d < n_dimensions; ++d) {
+            _dimensions[d] = etl::dim(e, d);
+            _size *= _dimensions[d];
+        }
+
+        init_outer();
+    }
+
+public:
+    using base_type::columns;
+    using base_type::dim;
+    using base_type::rows;
+    using base_type::size;
+
+    // Construction
+
+    /*!
+     * \brief Constructs a new empty sparse matrix
+     */
+    sparse_matrix_impl() : base_type(), _memory(nullptr), _inner_index(nullptr), _outer_index(nullptr), nnz(0) {
+        init_outer();
+    }
+
+    /*!
+     * \brief Construct a new sparse matrix of the given dimensions,
+     * filled with zeroes
+     */
+    template <typename... S, cpp_enable_iff(sizeof...(S) == D && cpp::all_convertible_to_v<size_t, S...>)>
+    explicit sparse_matrix_impl(S... sizes)
+            : base_type(util::size(sizes...), {{static_cast<size_t>(sizes)...}}), _memory(nullptr), _inner_index(nullptr), _outer_index(nullptr), nnz(0) {
+        init_outer();
+    }
+
+    /*!
+     * \brief Construct a new sparse matrix of the given dimensions
+     * and use the initializer list to fill the matrix
+     */
+    template <typename... S, cpp_enable_iff(dyn_detail::is_initializer_list_constructor<S...>::value)>
+    explicit sparse_matrix_impl(S... sizes)
+            : base_type(util::size(std::make_index_sequence<(sizeof...(S) - 1)>(), sizes...),
+                        dyn_detail::sizes(std::make_index_sequence<(sizeof...(S) - 1)>(), sizes...)),
+              _memory(nullptr),
+              _inner_index(nullptr),
+              _outer_index(nullptr),
+              nnz(0) {
+        static_assert(sizeof...(S) == D + 1, "Invalid number of dimensions");
+
+        auto list = cpp::last_value(sizes...);
+        build_from_iterable(list);
+    }
+
+    /*!
+     * \brief Construct a new sparse matrix of the given dimensions
+     * and use the list of values list to fill the matrix
+     */
+    template <typename S1, typename... S, cpp_enable_iff((sizeof...(S) == D) && cpp::is_specialization_of_v<values_t, typename cpp::last_type<S1, S...>::type>)>
+    explicit sparse_matrix_impl(S1 s1, S... sizes)
+            : base_type(util::size(std::make_index_sequence<(sizeof...(S))>(), s1, sizes...),
+                        dyn_detail::sizes(std::make_index_sequence<(sizeof...(S))>(), s1, sizes...)),
+              _memory(nullptr),
+              _inner_index(nullptr),
+              _outer_index(nullptr),
+              nnz(0) {
+        auto list = cpp::last_value(sizes...).template list<value_type>();
+        build_from_iterable(list);
+    }
+
+    /*!
+     * \brief Copy construct a sparse matrix
+     * \param rhs The matrix to copy from
+     */
+    sparse_matrix_impl(const sparse_matrix_impl& rhs) : base_type(rhs), _memory(nullptr), _inner_index(nullptr), _outer_index(nullptr), nnz(rhs.nnz) {
+        _outer_index = base_type::template allocate<index_type>(outer_size() + 1);
+        std::copy_n(rhs._outer_index, outer_size() + 1, _outer_index);
+
+        if (nnz) {
+            _memory      = allocate(nnz);
+            _inner_index = base_type::template allocate<index_type>(nnz);
+            _capacity    = nnz;
+
+            std::copy_n(rhs._memory, nnz, _memory);
+            std::copy_n(rhs._inner_index, nnz, _inner_index);
+        }
+    }
+
+    /*!
+     * \brief Move construct a sparse matrix
+     * \param rhs The matrix to move from
+     */
+    sparse_matrix_impl(sparse_matrix_impl&& rhs) noexcept
+            : base_type(std::move(rhs)), _memory(rhs._memory), _inner_index(rhs._inner_index), _outer_index(rhs._outer_index), nnz(rhs.nnz), _capacity(rhs._capacity) {
+        rhs._memory      = nullptr;
+        rhs._inner_index = nullptr;
+        rhs._outer_index = nullptr;
+        rhs.nnz          = 0;
+        rhs._capacity    = 0;
+    }
+
+    /*!
+     * \brief Construct a sparse matrix from a sparse matrix with another
+     * storage format (for instance COO to CSR).
+     *
+     * The conversion is done in linear time with a counting sort of the
+     * non-zero elements.
+     *
+     * \param rhs The matrix to convert
+     */
+    template <sparse_storage SS2, cpp_enable_iff(SS2 != SS)>
+    explicit sparse_matrix_impl(const sparse_matrix_impl<T, SS2, D>& rhs)
+            : base_type(rhs), _memory(nullptr), _inner_index(nullptr), _outer_index(nullptr), nnz(0) {
+        build(rhs.non_zeros(), [&rhs](auto&& functor) { rhs.for_each_non_zero(functor); });
+    }
+
+    /*!
+     * \brief Copy assign from another matrix
+     *
+     * This operator can change the dimensions of the matrix
+     *
+     * \param rhs The matrix to copy from
+     * \return A reference to the matrix
+     */
+    sparse_matrix_impl& operator=(const sparse_matrix_impl& rhs) {
+        if (this != &rhs) {
+            if (!_size) {
+                inherit(rhs);
+            } else {
+                validate_assign(*this, rhs);
+            }
+
+            build(rhs.nnz, [&rhs](auto&& functor) { rhs.for_each_non_zero(functor); });
+        }
+
+        check_invariants();
+
+        return *this;
+    }
+
+    /*!
+     * \brief Move assign from another matrix
+     * \param rhs The matrix to move from
+     * \return A reference to the matrix
+     */
+    sparse_matrix_impl& operator=(sparse_matrix_impl&& rhs) noexcept {
+        if (this != &rhs) {
+            release_all();
+
+            _size        = rhs._size;
+            _dimensions  = rhs._dimensions;
+            _memory      = rhs._memory;
+            _inner_index = rhs._inner_index;
+            _outer_index = rhs._outer_index;
+            nnz          = rhs.nnz;
+            _capacity    = rhs._capacity;
+
+            rhs._memory      = nullptr;
+            rhs._inner_index = nullptr;
+            rhs._outer_index = nullptr;
+            rhs.nnz          = 0;
+            rhs._capacity    = 0;
+        }
+
+        return *this;
+    }
+
+    /*!
+     * \brief Assign an ETL expression to the sparse matrix
+     */
+    template <typename E,
+              cpp_enable_iff(!std::is_same_v<std::decay_t<E>, sparse_matrix_impl<T, storage_format, D>>
+                             && std::is_convertible_v<value_t<E>, value_type> && is_etl_expr<E>)>
+    sparse_matrix_impl& operator=(E&& e) {
+        // It is possible that the matrix was not initialized before
+        // In the case, get the the dimensions from the expression and
+        // initialize the matrix
+        if (!_size) {
+            inherit(e);
+        } else {
+            validate_assign(*this, e);
+        }
+
+        if constexpr (is_sparse_matrix<E>) {
+            build(e.non_zeros(), [&e](auto&& functor) { e.for_each_non_zero(functor); });
+        } else if constexpr (is_sparse_mergeable<E, this_type>) {
+            // Computed on the non-zero elements only
+            sparse_merge_assign(e, *this);
+        } else {
+            // The expression is evaluated once in a dense temporary, this
+            // also avoids aliasing issues
+            auto tmp = force_temporary_dyn(e);
+
+            size_t count = 0;
+            for (size_t i = 0; i < etl::size(tmp); ++i) {
+                if (sparse_detail::is_non_zero(tmp[i])) {
+                    ++count;
+                }
+            }
+
+            build(count, [this, &tmp](auto&& functor) {
+                for (size_t i = 0; i < rows(); ++i) {
+                    for (size_t j = 0; j < columns(); ++j) {
+                        if (sparse_detail::is_non_zero(tmp(i, j))) {
+                            functor(i, j, value_type(tmp(i, j)));
+                        }
+                    }
+                }
+            });
+        }
+
+        check_invariants();
+
+        return *this;
+    }
+
+    /*!
+     * \brief Returns the number of outer slices (rows for CSR, columns for CSC)
+     */
+    size_t outer_size() const noexcept {
+        return row_compressed ? rows() : columns();
+    }
+
+    /*!
+     * \brief Returns the value at the given (i,j) position in the matrix.
+     *
+     * This function will never insert a new element in the matrix. It is
+     * suited when only reading the matrix and not neeeding references.
+     *
+     * \param i The row
+     * \param j The column
+     *
+     * \return The value at the (i,j) position.
+     */
+    value_type get(size_t i, size_t j) const noexcept(assert_nothrow) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+        return get_hint(i, j, n);
+    }
+
+    /*!
+     * \brief Returns a reference to the element at the position (i,j)
+     * \param i The first index
+     * \param j The second index
+     * \return a sparse reference (proxy reference) to the element at position (i,j)
+     */
+    reference_type operator()(size_t i, size_t j) noexcept(assert_nothrow) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        return {*this, i, j};
+    }
+
+    /*!
+     * \brief Returns the value of the element at the position (i,j)
+     * \param i The first index
+     * \param j The second index
+     * \return the value of the element at position (i,j)
+     */
+    value_type operator()(size_t i, size_t j) const noexcept(assert_nothrow) {
+        return get(i, j);
+    }
+
+    /*!
+     * \brief Returns the element at the given index
+     * This function may result in insertion of deletion of elements
+     * in the matrix and therefore invalidation of some references.
+     * \param n The index
+     * \return a reference to the element at the given index.
+     */
+    reference_type operator[](size_t n) noexcept(assert_nothrow) {
+        cpp_assert(n < size(), "Out of bounds");
+
+        return {*this, n / columns(), n % columns()};
+    }
+
+    /*!
+     * \brief Returns the value of the element at the given index
+     * \param n The index
+     * \return the value of the element at the given index.
+     */
+    value_type operator[](size_t n) const noexcept(assert_nothrow) {
+        cpp_assert(n < size(), "Out of bounds");
+
+        return get(n / columns(), n % columns());
+    }
+
+    /*!
+     * \brief Returns the value at the given index
+     * This function never alters the state of the container.
+     * \param n The index
+     * \return the value at the given index.
+     */
+    value_type read_flat(size_t n) const noexcept {
+        return get(n / columns(), n % columns());
+    }
+
+    /*!
+     * \brief Returns Returns the number of non zeros entries in the sparse matrix.
+     *
+     * This is a constant time O(1) operation.
+     *
+     * \return The number of non zeros entries in the sparse matrix.
+     */
+    size_t non_zeros() const noexcept {
+        return nnz;
+    }
+
+    /*!
+     * \brief Returns a pointer to the non-zero values
+     */
+    const_memory_type values() const noexcept {
+        return _memory;
+    }
+
+    /*!
+     * \brief Returns a pointer to the inner index (column for CSR, row
+     * for CSC) of each non-zero value
+     */
+    const index_type* inner_index() const noexcept {
+        return _inner_index;
+    }
+
+    /*!
+     * \brief Returns a pointer to the position of the first value of
+     * each outer slice. The outer index has outer_size() + 1 elements.
+     */
+    const index_type* outer_index() const noexcept {
+        return _outer_index;
+    }
+
+    /*!
+     * \brief Call the given functor with (i, j, value) for each non-zero
+     * element of the matrix, in row-major order for CSR and in
+     * column-major order for CSC.
+     * \param functor The functor to call
+     */
+    template <typename F>
+    void for_each_non_zero(F&& functor) const {
+        for (size_t o = 0; o < outer_size(); ++o) {
+            for (size_t n = _outer_index[o]; n < _outer_index[o + 1]; ++n) {
+                if constexpr (row_compressed) {
+                    functor(o, _inner_index[n], _memory[n]);
+                } else {
+                    functor(_inner_index[n], o, _memory[n]);
+                }
+            }
+        }
+    }
+
+    /*!
+     * \brief Returns the number of non-zero elements that can be stored
+     * without reallocation.
+     */
+    size_t capacity() const noexcept {
+        return _capacity;
+    }
+
+    /*!
+     * \brief Reserve memory for at least the given number of non-zero
+     * elements
+     * \param capacity The number of non-zero elements to reserve space for
+     */
+    void reserve(size_t capacity) {
+        if (capacity > _capacity) {
+            reallocate(capacity);
+        }
+    }
+
+    /*!
+     * \brief Insert a batch of elements in the matrix.
+     *
+     * The result is the same as calling set(i, j, value) for each
+     * triplet in order: the new values replace the existing ones, the
+     * last duplicate wins and a zero value erases the element. The
+     * batch is sorted and merged with the existing elements and the
+     * matrix is compressed again once, in O(nnz + b log b).
+     *
+     * \param batch The elements to insert
+     */
+    void insert_batch(std::vector<sparse_triplet<value_type>> batch) {
+        for ([[maybe_unused]] auto& t : batch) {
+            cpp_assert(t.i < dim(0), "Out of bounds");
+            cpp_assert(t.j < dim(1), "Out of bounds");
+        }
+
+        sparse_detail::sort_triplets<row_compressed>(batch, outer_size());
+        sparse_detail::merge_duplicates(batch, false);
+
+        std::vector<sparse_triplet<value_type>> existing;
+        existing.reserve(nnz);
+        for_each_non_zero([&existing](size_t i, size_t j, value_type v) { existing.push_back({i, j, v}); });
+
+        assign_triplets(sparse_detail::merge_triplets<row_compressed>(existing, batch));
+    }
+
+    /*!
+     * \brief Build a sparse matrix from a list of triplets.
+     *
+     * The triplets can be given in any order. The values of the
+     * duplicates are summed. The matrix is built with a single sort and
+     * a single compression.
+     *
+     * \param rows The number of rows of the matrix
+     * \param columns The number of columns of the matrix
+     * \param triplets The elements of the matrix
+     * \return The new sparse matrix
+     */
+    static sparse_matrix_impl from_triplets(size_t rows, size_t columns, std::vector<sparse_triplet<value_type>> triplets) {
+        sparse_matrix_impl matrix(rows, columns);
+
+        for ([[maybe_unused]] auto& t : triplets) {
+            cpp_assert(t.i < rows, "Out of bounds");
+            cpp_assert(t.j < columns, "Out of bounds");
+        }
+
+        sparse_detail::sort_triplets<row_compressed>(triplets, matrix.outer_size());
+        sparse_detail::merge_duplicates(triplets, true);
+
+        matrix.assign_triplets(triplets);
+
+        return matrix;
+    }
+
+    /*!
+     * \brief Replace the content of the matrix with the given sorted
+     * triplets. The zero values are not stored.
+     * \param triplets The triplets, sorted by (outer, inner) and without duplicates
+     */
+    void assign_triplets(const std::vector<sparse_triplet<value_type>>& triplets) {
+        cpp_assert(std::adjacent_find(triplets.begin(), triplets.end(),
+                                      [](auto& a, auto& b) {
+                                          return std::make_pair(outer_of(a.i, a.j), inner_of(a.i, a.j)) >= std::make_pair(outer_of(b.i, b.j), inner_of(b.i, b.j));
+                                      })
+                       == triplets.end(),
+                   "The triplets must be sorted by (outer, inner) and without duplicates");
+
+        const size_t count = std::count_if(triplets.begin(), triplets.end(), [](auto& t) { return sparse_detail::is_non_zero(t.value); });
+
+        build(count, [&triplets](auto&& functor) {
+            for (auto& t : triplets) {
+                if (sparse_detail::is_non_zero(t.value)) {
+                    functor(t.i, t.j, t.value);
+                }
+            }
+        });
+    }
+
+    /*!
+     * \brief Sets the element at the given position (i, j) to the given value
+     * \param i The first index
+     * \param j The second index
+     * \param value The new value
+     */
+    void set(size_t i, size_t j, value_type value) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+        set_hint(i, j, n, value);
+    }
+
+    /*!
+     * \brief Sets the element at the given position (i, j) to the given value
+     *
+     * This function will always set the element to the given value, even if it
+     * is zero (the normal behaviour would have been to erase it). This must be
+     * used when we need a pointer to the element in memory.
+     *
+     * \param i The first index
+     * \param j The second index
+     * \param value The new value
+     */
+    void unsafe_set(size_t i, size_t j, value_type value) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+
+        unsafe_set_hint(i, j, n, value);
+    }
+
+    /*!
+     * \brief Erases (sets to zero) the element at the given position (i, j)
+     * \param i The first index
+     * \param j The second index
+     */
+    void erase(size_t i, size_t j) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+
+        if (is_hint(i, j, n)) {
+            erase_hint(outer_of(i, j), n);
+        }
+    }
+
+    /*!
+     * \brief Test if this expression aliases with the given expression
+     * \param rhs The other expression to test
+     * \return true if the two expressions aliases, false otherwise
+     */
+    template <typename E, cpp_enable_iff(is_sparse_matrix<E>)>
+    bool alias(const E& rhs) const noexcept {
+        return static_cast<const void*>(this) == static_cast<const void*>(&rhs);
+    }
+
+    /*!
+     * \brief Test if this expression aliases with the given expression
+     * \param rhs The other expression to test
+     * \return true if the two expressions aliases, false otherwise
+     */
+    template <typename E, cpp_disable_iff(is_sparse_matrix<E>)>
+    bool alias(const E& rhs) const noexcept {
+        if constexpr (is_dma<E>) {
+            // A dense container cannot share memory with a sparse matrix
+            return false;
+        } else {
+            return rhs.alias(*this);
+        }
+    }
+
+    // Internals
+
+    /*!
+     * \brief Apply the given visitor to this expression and its descendants.
+     * \param visitor The visitor to apply
+     */
+    template <typename V>
+    void visit([[maybe_unused]] V&& visitor) const {}
+
+    /*!
+     * \brief Destructs the matrix and releases all its memory
+     */
+    ~sparse_matrix_impl() noexcept {
+        release_all();
+    }
+
+    /*!
+     * \brief Ensures that the GPU memory is allocated and that the GPU memory
+     * is up to date (to undefined value).
+     */
+    void ensure_cpu_up_to_date() const {
+        // No GPU support for sparse matrix so far
+    }
+
+    /*!
+     * \brief Copy back from the GPU to the expression memory if
+     * necessary.
+     */
+    void ensure_gpu_up_to_date() const {
+        // No GPU support for sparse matrix so far
+    }
+
+    /*!
+     * \brief Assign to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_to(L&& lhs) const {
+        std_assign_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief sub to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief mul to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Div to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Mod to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Prints a fast matrix type (not the contents) to the given stream
+     * \param os The output stream
+     * \param matrix The fast matrix to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const sparse_matrix_impl& matrix) {
+        os << (row_compressed ? "CSR[" : "CSC[") << matrix.dim(0);
+
+        for (size_t i = 1; i < D; ++i) {
+            os << "," << matrix.dim(i);
+        }
+
+        return os << "]";
+    }
+};
+
 } //end of namespace etl
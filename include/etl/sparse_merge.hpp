@@ -0,0 +1,368 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Sparse triplets and sparse-aware evaluation of element-wise
+ * expressions.
+ *
+ * The element-wise operations on sparse matrices are computed by
+ * merging the sorted lists of non-zero elements of the operands (union
+ * for addition and subtraction, intersection for multiplication) instead
+ * of visiting every element of the matrices. The work is proportional
+ * to the number of non-zero elements.
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief A non-zero element of a sparse matrix, given by its position
+ * and its value. This is used to build sparse matrices in bulk.
+ * \tparam T The type of value
+ */
+template <typename T>
+struct sparse_triplet {
+    size_t i; ///< The row of the element
+    size_t j; ///< The column of the element
+    T value;  ///< The value of the element
+};
+
+namespace sparse_detail {
+
+/*!
+ * \brief Compare the positions of two triplets
+ * \tparam RowMajor Indicates if the rows are the outer slices
+ * \return true if a is before b, false otherwise
+ */
+template <bool RowMajor, typename T>
+bool triplet_less(const sparse_triplet<T>& a, const sparse_triplet<T>& b) {
+    if constexpr (RowMajor) {
+        return a.i < b.i || (a.i == b.i && a.j < b.j);
+    } else {
+        return a.j < b.j || (a.j == b.j && a.i < b.i);
+    }
+}
+
+/*!
+ * \brief Sort a list of triplets by (outer, inner) indices.
+ *
+ * The triplets are first distributed in their outer slice with a
+ * counting sort and then each slice is sorted by inner index. The sort
+ * is stable, the relative order of duplicates is preserved.
+ *
+ * \param triplets The triplets to sort
+ * \param outer The number of outer slices
+ * \tparam RowMajor Indicates if the rows are the outer slices
+ */
+template <bool RowMajor, typename T>
+void sort_triplets(std::vector<sparse_triplet<T>>& triplets, size_t outer) {
+    auto outer_of = [](const sparse_triplet<T>& t) { return RowMajor ? t.i : t.j; };
+    auto inner_of = [](const sparse_triplet<T>& t) { return RowMajor ? t.j : t.i; };
+
+    std::vector<size_t> start(outer + 1, 0);
+
+    for (auto& t : triplets) {
+        ++start[outer_of(t) + 1];
+    }
+
+    for (size_t o = 0; o < outer; ++o) {
+        start[o + 1] += start[o];
+    }
+
+    std::vector<size_t> next(start.begin(), start.end() - 1);
+    std::vector<sparse_triplet<T>> sorted(triplets.size());
+
+    for (auto& t : triplets) {
+        sorted[next[outer_of(t)]++] = t;
+    }
+
+    auto inner_less = [&inner_of](const sparse_triplet<T>& a, const sparse_triplet<T>& b) { return inner_of(a) < inner_of(b); };
+
+    for (size_t o = 0; o < outer; ++o) {
+        auto first = sorted.begin() + start[o];
+        auto last  = sorted.begin() + start[o + 1];
+
+        if (!std::is_sorted(first, last, inner_less)) {
+            std::stable_sort(first, last, inner_less);
+        }
+    }
+
+    triplets = std::move(sorted);
+}
+
+/*!
+ * \brief Merge the consecutive duplicates of a sorted list of triplets
+ * \param triplets The sorted triplets
+ * \param sum If true, the duplicates are summed, otherwise the last one is kept
+ */
+template <typename T>
+void merge_duplicates(std::vector<sparse_triplet<T>>& triplets, bool sum) {
+    size_t n = 0;
+
+    for (size_t k = 0; k < triplets.size(); ++k) {
+        if (n && triplets[n - 1].i == triplets[k].i && triplets[n - 1].j == triplets[k].j) {
+            triplets[n - 1].value = sum ? triplets[n - 1].value + triplets[k].value : triplets[k].value;
+        } else {
+            triplets[n++] = triplets[k];
+        }
+    }
+
+    triplets.resize(n);
+}
+
+/*!
+ * \brief Merge a sorted batch of triplets into a sorted list of
+ * existing triplets. The batch must not contain duplicates and its
+ * values replace the existing ones.
+ *
+ * \param existing The sorted existing triplets
+ * \param batch The sorted batch
+ * \tparam RowMajor Indicates if the rows are the outer slices
+ * \return the sorted merged triplets
+ */
+template <bool RowMajor, typename T>
+std::vector<sparse_triplet<T>> merge_triplets(const std::vector<sparse_triplet<T>>& existing, const std::vector<sparse_triplet<T>>& batch) {
+    std::vector<sparse_triplet<T>> merged;
+    merged.reserve(existing.size() + batch.size());
+
+    size_t e = 0;
+    size_t b = 0;
+
+    while (e < existing.size() || b < batch.size()) {
+        if (b == batch.size() || (e < existing.size() && triplet_less<RowMajor>(existing[e], batch[b]))) {
+            merged.push_back(existing[e++]);
+        } else {
+            // The batch replaces an existing value at the same position
+            if (e < existing.size() && !triplet_less<RowMajor>(batch[b], existing[e])) {
+                ++e;
+            }
+
+            merged.push_back(batch[b++]);
+        }
+    }
+
+    return merged;
+}
+
+/*!
+ * \brief Returns the non-zero elements of the given sparse matrix as
+ * triplets, sorted in row-major or column-major order.
+ * \param a The sparse matrix
+ * \tparam RowMajor Indicates if the triplets must be in row-major order
+ * \return the sorted triplets
+ */
+template <bool RowMajor, typename A>
+std::vector<sparse_triplet<value_t<A>>> ordered_triplets(const A& a) {
+    using T = value_t<A>;
+
+    std::vector<sparse_triplet<T>> triplets;
+    triplets.reserve(a.non_zeros());
+
+    a.for_each_non_zero([&triplets](size_t i, size_t j, T v) { triplets.push_back({i, j, v}); });
+
+    // COO and CSR are visited in row-major order, CSC in column-major order
+    if constexpr ((std::decay_t<A>::storage_format == sparse_storage::CSC) == RowMajor) {
+        sort_triplets<RowMajor>(triplets, RowMajor ? a.rows() : a.columns());
+    }
+
+    return triplets;
+}
+
+/*!
+ * \brief Merge the sorted non-zero elements of two sparse matrices.
+ *
+ * With union, the positions present in only one operand are combined
+ * with a zero. With intersection, only the positions present in both
+ * operands are kept.
+ *
+ * \param a The sorted triplets of the left operand
+ * \param b The sorted triplets of the right operand
+ * \param intersection Indicates if the intersection or the union is computed
+ * \tparam RowMajor Indicates if the triplets are in row-major order
+ * \tparam Op The binary operator
+ * \return the sorted merged triplets
+ */
+template <bool RowMajor, typename Op, typename T>
+std::vector<sparse_triplet<T>> merge_sparse(const std::vector<sparse_triplet<T>>& a, const std::vector<sparse_triplet<T>>& b, bool intersection) {
+    std::vector<sparse_triplet<T>> merged;
+    merged.reserve(intersection ? std::min(a.size(), b.size()) : a.size() + b.size());
+
+    size_t ia = 0;
+    size_t ib = 0;
+
+    while (ia < a.size() && ib < b.size()) {
+        if (triplet_less<RowMajor>(a[ia], b[ib])) {
+            if (!intersection) {
+                merged.push_back({a[ia].i, a[ia].j, Op::apply(a[ia].value, T(0))});
+            }
+
+            ++ia;
+        } else if (triplet_less<RowMajor>(b[ib], a[ia])) {
+            if (!intersection) {
+                merged.push_back({b[ib].i, b[ib].j, Op::apply(T(0), b[ib].value)});
+            }
+
+            ++ib;
+        } else {
+            merged.push_back({a[ia].i, a[ia].j, Op::apply(a[ia].value, b[ib].value)});
+
+            ++ia;
+            ++ib;
+        }
+    }
+
+    if (!intersection) {
+        for (; ia < a.size(); ++ia) {
+            merged.push_back({a[ia].i, a[ia].j, Op::apply(a[ia].value, T(0))});
+        }
+
+        for (; ib < b.size(); ++ib) {
+            merged.push_back({b[ib].i, b[ib].j, Op::apply(T(0), b[ib].value)});
+        }
+    }
+
+    return merged;
+}
+
+/*!
+ * \brief Traits to detect the element-wise expressions that can be
+ * computed on the non-zero elements of their sparse operands only.
+ * \tparam E The expression type
+ */
+template <typename E>
+struct sparse_merge_traits {
+    static constexpr bool value = false; ///< Indicates if the expression can be merged
+};
+
+/*!
+ * \copydoc sparse_merge_traits
+ */
+template <typename T, typename L, typename Op, typename R>
+struct sparse_merge_traits<binary_expr<T, L, Op, R>> {
+    using op_type = Op; ///< The binary operator
+
+    static constexpr bool left_sparse  = is_sparse_matrix<L>; ///< Indicates if the left operand is sparse
+    static constexpr bool right_sparse = is_sparse_matrix<R>; ///< Indicates if the right operand is sparse
+
+    static constexpr bool additive       = std::is_same_v<Op, plus_binary_op<T>> || std::is_same_v<Op, minus_binary_op<T>>; ///< Zero only when both are zero
+    static constexpr bool multiplicative = std::is_same_v<Op, mul_binary_op<T>>;                                            ///< Zero when one is zero
+
+    /*!
+     * \brief Indicates if the non-zero elements are the union of the
+     * non-zero elements of both sparse operands (a + b, a - b)
+     */
+    static constexpr bool is_union = left_sparse && right_sparse && additive;
+
+    /*!
+     * \brief Indicates if the non-zero elements are the intersection of
+     * the non-zero elements of both sparse operands (a >> b)
+     */
+    static constexpr bool is_intersection = left_sparse && right_sparse && multiplicative;
+
+    /*!
+     * \brief Indicates if the non-zero elements are the ones of the left
+     * sparse operand (a >> dense, a * s, a / s)
+     */
+    static constexpr bool is_left_masked = left_sparse && !right_sparse && (multiplicative || (std::is_same_v<Op, div_binary_op<T>> && is_scalar<R>));
+
+    /*!
+     * \brief Indicates if the non-zero elements are the ones of the right
+     * sparse operand (dense >> b, s * b)
+     */
+    static constexpr bool is_right_masked = !left_sparse && right_sparse && multiplicative;
+
+    static constexpr bool value = is_union || is_intersection || is_left_masked || is_right_masked; ///< Indicates if the expression can be merged
+};
+
+} //end of namespace sparse_detail
+
+/*!
+ * \brief Indicates if the expression E can be assigned to R by merging
+ * the non-zero elements of its sparse operands.
+ *
+ * The values of the dense operand are only read at the positions of
+ * the non-zero elements of the sparse operand, as is usual for sparse
+ * formats (0 * inf is zero).
+ */
+template <typename E, typename R>
+constexpr bool is_sparse_mergeable =
+    sparse_detail::sparse_merge_traits<std::decay_t<E>>::value && (is_sparse_matrix<R> || (is_dma<R> && decay_traits<R>::dimensions() == 2));
+
+/*!
+ * \brief Assign an element-wise expression with sparse operands to the
+ * result, by merging the non-zero elements of the operands.
+ *
+ * The expression is entirely computed before the result is modified,
+ * the result can therefore alias any of the operands.
+ *
+ * \param expr The expression to assign
+ * \param result The sparse or dense result
+ */
+template <typename E, typename R>
+void sparse_merge_assign(const E& expr, R& result) {
+    using traits = sparse_detail::sparse_merge_traits<std::decay_t<E>>;
+    using Op     = typename traits::op_type;
+    using T      = value_t<E>;
+
+    inc_counter("sparse:merge");
+
+    // Evaluate the temporaries of the dense operand, if any
+    detail::evaluator_visitor visitor;
+    expr.visit(visitor);
+    expr.ensure_cpu_up_to_date();
+
+    decltype(auto) lhs = expr.get_lhs();
+    decltype(auto) rhs = expr.get_rhs();
+
+    // The non-zero elements are produced in the order of the sparse
+    // result or, for a dense result, in the order of the first sparse
+    // operand
+    constexpr bool row_major = [] {
+        if constexpr (is_sparse_matrix<R>) {
+            return std::decay_t<R>::storage_format != sparse_storage::CSC;
+        } else if constexpr (traits::left_sparse) {
+            return std::decay_t<decltype(lhs)>::storage_format != sparse_storage::CSC;
+        } else {
+            return std::decay_t<decltype(rhs)>::storage_format != sparse_storage::CSC;
+        }
+    }();
+
+    std::vector<sparse_triplet<T>> triplets;
+
+    if constexpr (traits::is_union || traits::is_intersection) {
+        auto a = sparse_detail::ordered_triplets<row_major>(lhs);
+        auto b = sparse_detail::ordered_triplets<row_major>(rhs);
+
+        triplets = sparse_detail::merge_sparse<row_major, Op>(a, b, traits::is_intersection);
+    } else if constexpr (traits::is_left_masked) {
+        triplets = sparse_detail::ordered_triplets<row_major>(lhs);
+
+        for (auto& t : triplets) {
+            t.value = Op::apply(t.value, T(rhs(t.i, t.j)));
+        }
+    } else {
+        triplets = sparse_detail::ordered_triplets<row_major>(rhs);
+
+        for (auto& t : triplets) {
+            t.value = Op::apply(T(lhs(t.i, t.j)), t.value);
+        }
+    }
+
+    if constexpr (is_sparse_matrix<R>) {
+        result.assign_triplets(triplets);
+    } else {
+        result = value_t<R>(0);
+
+        for (auto& t : triplets) {
+            result(t.i, t.j) = t.value;
+        }
+    }
+}
+
+} //end of namespace etl
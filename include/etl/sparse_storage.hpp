@@ -18,7 +18,9 @@ namespace etl {
  * \brief Enumeration for sparse storage formats
  */
 enum class sparse_storage {
-    COO ///< Coordinate Format (COO)
+    COO, ///< Coordinate Format (COO)
+    CSR, ///< Compressed Sparse Row (CSR)
+    CSC  ///< Compressed Sparse Column (CSC)
 };
 
 } //end of namespace etl
@@ -41,7 +41,17 @@ struct conf_thread_engine {
      */
     template <typename Functor, typename... Args>
     static void schedule(Functor&& fun, Args&&... args) {
+#ifdef ETL_PROFILE
+        // The task is attached to the scope that scheduled it
+        auto task = [fun, parent = profile_current()](auto&&... task_args) mutable {
+            profile_task_scope scope(parent);
+            fun(task_args...);
+        };
+
+        get_pool().do_task(task, std::forward<Args>(args)...);
+#else
         get_pool().do_task(std::forward<Functor>(fun), std::forward<Args>(args)...);
+#endif
     }
 
     /*!
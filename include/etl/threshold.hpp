@@ -9,6 +9,9 @@
  * \file
  * \brief Contains thresholds to select implementations based
  * on the expression size
+ *
+ * Some of these thresholds are only the initial values of the tuning
+ * profile (see tuning.hpp), which is what the selection functions read.
  */
 
 #pragma once
@@ -34,6 +37,10 @@ constexpr size_t parallel_threshold = 2 * 1024; ///< The minimum number of eleme
 
 constexpr size_t sum_parallel_threshold     = 1024 * 2; ///< The minimum number of elements before considering parallel acc implementation
 constexpr size_t vec_sum_parallel_threshold = 1024 * 2; ///< The minimum number of elements before considering parallel acc implementation
+constexpr size_t index_parallel_threshold   = 1024 * 2; ///< The minimum number of elements before considering parallel max_index/min_index
+constexpr size_t cce_parallel_threshold     = 1024 * 2; ///< The minimum number of elements before considering parallel softmax cross entropy
+
+constexpr size_t sparse_parallel_threshold = 1024 * 2; ///< The minimum number of multiply-adds before considering parallel sparse products
 
 constexpr size_t conv1_parallel_threshold_conv   = 100; ///< The mimum output size before considering parallel convolution
 constexpr size_t conv1_parallel_threshold_kernel = 16;  ///< The mimum kernel size before considering parallel convolution
@@ -46,6 +53,9 @@ constexpr size_t fft2_many_threshold_n          = 1024; ///< The mimum size of t
 
 constexpr size_t stream_threshold = 1024; ///< The threshold at which stream is used
 
+constexpr size_t conv4_small_kernel_threshold = 5;   ///< The maximum kernel size considered small for conv4 selection
+constexpr size_t conv4_vec_image_threshold    = 100; ///< The image size after which VEC is used for small conv4 kernels
+
 #else
 
 constexpr size_t gemm_std_max    = 75 * 75;   ///< The maximum number of elements to be handled by std algorithm
@@ -65,6 +75,10 @@ constexpr size_t parallel_threshold = 128 * 1024; ///< The minimum number of ele
 
 constexpr size_t sum_parallel_threshold     = 1024 * 32;  ///< The minimum number of elements before considering parallel acc implementation
 constexpr size_t vec_sum_parallel_threshold = 1024 * 128; ///< The minimum number of elements before considering parallel acc implementation
+constexpr size_t index_parallel_threshold   = 1024 * 128; ///< The minimum number of elements before considering parallel max_index/min_index
+constexpr size_t cce_parallel_threshold     = 1024 * 64;  ///< The minimum number of elements before considering parallel softmax cross entropy
+
+constexpr size_t sparse_parallel_threshold = 1024 * 64; ///< The minimum number of multiply-adds before considering parallel sparse products
 
 constexpr size_t conv1_parallel_threshold_conv   = 100; ///< The mimum output size before considering parallel convolution
 constexpr size_t conv1_parallel_threshold_kernel = 16;  ///< The mimum kernel size before considering parallel convolution
@@ -77,6 +91,9 @@ constexpr size_t fft2_many_threshold_n          = 1024; ///< The mimum size of t
 
 constexpr size_t stream_threshold = cache_size; ///< The threshold at which stream is used
 
+constexpr size_t conv4_small_kernel_threshold = 5;   ///< The maximum kernel size considered small for conv4 selection
+constexpr size_t conv4_vec_image_threshold    = 100; ///< The image size after which VEC is used for small conv4 kernels
+
 #endif
 
 } //end of namespace etl
@@ -0,0 +1,186 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Tuning profile of the thresholds used to select implementations.
+ *
+ * The profile starts with the default thresholds. If the
+ * ETL_TUNING_PROFILE environment variable names a file (as written by the
+ * etl_autotune program), the profile is loaded from it on first use. The
+ * selection functions read the thresholds through tuning().
+ *
+ * The thresholds are not synchronized: the profile can only be loaded or
+ * modified before evaluating expressions, or while no other thread is
+ * evaluating expressions.
+ */
+
+#pragma once
+
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace etl {
+
+/*!
+ * \brief The tunable thresholds
+ */
+struct tuning_profile {
+    size_t gemm_rr_small_threshold    = etl::gemm_rr_small_threshold;    ///< The number of elements of B after which we use BLAS-like kernel (for GEMM)
+    size_t gemm_nt_rr_small_threshold = etl::gemm_nt_rr_small_threshold; ///< The number of elements of B after which we use BLAS-like kernel (for GEMM)
+    size_t gemm_cc_small_threshold    = etl::gemm_cc_small_threshold;    ///< The number of elements of B after which we use BLAS-like kernel (for GEMM)
+
+    size_t gevm_rm_small_threshold = etl::gevm_rm_small_threshold; ///< The number of elements of b after which we use BLAS-like kernel
+    size_t gevm_cm_small_threshold = etl::gevm_cm_small_threshold; ///< The number of elements of b after which we use BLAS-like kernel
+
+    size_t gemv_rm_small_threshold = etl::gemv_rm_small_threshold; ///< The number of elements of A after which we use BLAS-like kernel
+    size_t gemv_cm_small_threshold = etl::gemv_cm_small_threshold; ///< The number of elements of A after which we use BLAS-like kernel
+
+    size_t parallel_threshold = etl::parallel_threshold; ///< The minimum number of elements before considering parallel implementation
+
+    size_t sum_parallel_threshold     = etl::sum_parallel_threshold;     ///< The minimum number of elements before considering parallel acc implementation
+    size_t vec_sum_parallel_threshold = etl::vec_sum_parallel_threshold; ///< The minimum number of elements before considering parallel acc implementation
+
+    size_t cce_parallel_threshold = etl::cce_parallel_threshold; ///< The minimum number of elements before considering parallel softmax cross entropy
+
+    size_t conv4_small_kernel_threshold = etl::conv4_small_kernel_threshold; ///< The maximum kernel size considered small for conv4 selection
+    size_t conv4_vec_image_threshold    = etl::conv4_vec_image_threshold;    ///< The image size after which VEC is used for small conv4 kernels
+
+    /*!
+     * \brief Call the functor with the name and a reference to each
+     * threshold of the profile
+     * \param profile The profile
+     * \param functor The functor to call
+     */
+    template <typename P, typename Functor>
+    static void visit(P& profile, Functor&& functor) {
+        functor("gemm_rr_small_threshold", profile.gemm_rr_small_threshold);
+        functor("gemm_nt_rr_small_threshold", profile.gemm_nt_rr_small_threshold);
+        functor("gemm_cc_small_threshold", profile.gemm_cc_small_threshold);
+        functor("gevm_rm_small_threshold", profile.gevm_rm_small_threshold);
+        functor("gevm_cm_small_threshold", profile.gevm_cm_small_threshold);
+        functor("gemv_rm_small_threshold", profile.gemv_rm_small_threshold);
+        functor("gemv_cm_small_threshold", profile.gemv_cm_small_threshold);
+        functor("parallel_threshold", profile.parallel_threshold);
+        functor("sum_parallel_threshold", profile.sum_parallel_threshold);
+        functor("vec_sum_parallel_threshold", profile.vec_sum_parallel_threshold);
+        functor("cce_parallel_threshold", profile.cce_parallel_threshold);
+        functor("conv4_small_kernel_threshold", profile.conv4_small_kernel_threshold);
+        functor("conv4_vec_image_threshold", profile.conv4_vec_image_threshold);
+    }
+
+    /*!
+     * \brief Load the profile from the given file.
+     *
+     * The file contains one "name value" pair per line, the lines starting
+     * with # are ignored. The thresholds that are not in the file are not
+     * modified.
+     *
+     * \param path The path of the file
+     * \return true if the file was read entirely, false otherwise
+     */
+    bool load(const std::string& path) {
+        std::ifstream stream(path);
+
+        if (!stream) {
+            return false;
+        }
+
+        bool valid = true;
+
+        std::string line;
+
+        while (std::getline(stream, line)) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+
+            std::istringstream entry(line);
+
+            std::string key;
+            size_t value;
+
+            if (!(entry >> key >> value)) {
+                valid = false;
+                continue;
+            }
+
+            bool found = false;
+
+            visit(*this, [&](const char* name, size_t& threshold) {
+                if (key == name) {
+                    threshold = value;
+                    found     = true;
+                }
+            });
+
+            valid = valid && found;
+        }
+
+        return valid;
+    }
+
+    /*!
+     * \brief Save the profile to the given file
+     * \param path The path of the file
+     * \return true if the file was written, false otherwise
+     */
+    bool save(const std::string& path) const {
+        std::ofstream stream(path);
+
+        if (!stream) {
+            return false;
+        }
+
+        stream << "# ETL tuning profile\n";
+
+        visit(*this, [&stream](const char* name, const size_t& threshold) { stream << name << " " << threshold << "\n"; });
+
+        return bool(stream);
+    }
+};
+
+/*!
+ * \brief Returns the tuning profile used by the selection functions
+ *
+ * The profile is created on first use, which makes it safe to use during
+ * static initialization. It must not be modified while expressions are
+ * evaluated in another thread.
+ */
+inline tuning_profile& tuning() {
+    static tuning_profile profile = []() {
+        tuning_profile p;
+
+        if (const char* path = std::getenv("ETL_TUNING_PROFILE")) {
+            if (!p.load(path)) {
+                std::cerr << "ETL: invalid tuning profile " << path << std::endl;
+            }
+        }
+
+        return p;
+    }();
+
+    return profile;
+}
+
+/*!
+ * \brief Load the tuning profile from the given file
+ *
+ * This must be done before evaluating expressions, or while no other
+ * thread is evaluating expressions.
+ *
+ * \param path The path of the file
+ * \return true if the file was read entirely, false otherwise
+ */
+inline bool load_tuning_profile(const std::string& path) {
+    return tuning().load(path);
+}
+
+} //end of namespace etl
@@ -5,12 +5,53 @@
 //  http://opensource.org/licenses/MIT)
 //=======================================================================
 
+/*!
+ * \file
+ * \brief Named counters of the evaluations (ETL_COUNTERS).
+ *
+ * Each counter is registered once and then identified by its index. Each
+ * thread increments its own slots, without any lock or atomic
+ * read-modify-write, and the slots of all the threads are only summed
+ * when the counters are read.
+ */
+
 #pragma once
 
 #ifndef ETL_COUNTERS
 
 namespace etl {
 
+/*!
+ * \brief A static handle to a counter (disabled)
+ */
+struct counter_handle {
+    /*!
+     * \brief Register the counter with the given name
+     * \param name The name of the counter
+     */
+    explicit counter_handle([[maybe_unused]] const char* name) {}
+
+    /*!
+     * \brief Increase the counter
+     */
+    void inc() const {}
+};
+
+/*!
+ * \brief Reset all counters
+ */
+inline void reset_counters() {
+    //No counters
+}
+
+/*!
+ * \brief Returns the value of the given counter
+ * \param name The name of the counter
+ */
+inline size_t counter_value([[maybe_unused]] const char* name) {
+    return 0;
+}
+
 /*!
  * \brief Dump all counters values to the console.
  */
@@ -18,6 +59,13 @@ inline void dump_counters() {
     //No counters
 }
 
+/*!
+ * \brief Dump all counters values to the console.
+ */
+inline void dump_counters_pretty() {
+    //No counters
+}
+
 /*!
  * \brief Increase the given counter
  * \param name The name of the counter to increase
@@ -28,54 +76,121 @@ inline void inc_counter([[maybe_unused]] const char* name) {}
 
 #else
 
-#include <chrono>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <iosfwd>
 #include <iomanip>
+#include <mutex>
 #include <sstream>
 
 namespace etl {
 
 constexpr const size_t max_counters = 64;
 
-struct counter_t {
-    const char* name;
-    std::atomic<size_t> count;
+/*!
+ * \brief The number of entries of the per-thread cache from the names to
+ * the indices of the counters (a power of two)
+ */
+constexpr const size_t counter_cache_size = 128;
+
+/*!
+ * \brief The counters slots of one thread.
+ *
+ * A slot is only written by its thread, with relaxed load and store, so
+ * that the increments are plain memory operations while the other
+ * threads can still read the slots.
+ */
+struct counter_block {
+    std::array<std::atomic<size_t>, max_counters> counts{}; ///< The counts of the thread
+
+    counter_block();
+    ~counter_block();
+
+    /*!
+     * \brief Increase the counter of the given index
+     * \param index The index of the counter
+     */
+    void inc(size_t index) {
+        counts[index].store(counts[index].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+};
+
+/*!
+ * \brief The registry of all the counters
+ */
+struct counters_t {
+    std::array<const char*, max_counters> names{}; ///< The names of the counters
+    std::atomic<size_t> size{0};                   ///< The number of registered counters
+    std::array<size_t, max_counters> retired{};    ///< The counts of the finished threads
+    std::vector<counter_block*> blocks;            ///< The slots of the running threads
+    std::mutex lock;                               ///< The lock for registration and aggregation
+
+    /*!
+     * \brief Returns the index of the counter with the given name,
+     * registering it if necessary.
+     *
+     * \param name The name of the counter
+     * \return The index of the counter or max_counters if there are too
+     * many counters
+     */
+    size_t index(const char* name) {
+        std::lock_guard<std::mutex> l(lock);
 
-    counter_t() : name(nullptr), count(0) {}
+        const size_t n = size.load();
 
-    counter_t(const counter_t& rhs) : name(rhs.name), count(rhs.count.load()) {}
+        for (size_t i = 0; i < n; ++i) {
+            if (names[i] == name || !std::strcmp(names[i], name)) {
+                return i;
+            }
+        }
 
-    counter_t& operator=(const counter_t& rhs) {
-        if (&rhs != this) {
-            name  = rhs.name;
-            count = rhs.count.load();
+        if (n == max_counters) {
+            std::cerr << "Unable to register counter " << name << std::endl;
+            return max_counters;
         }
 
-        return *this;
+        names[n] = name;
+        size     = n + 1;
+
+        return n;
     }
 
-    counter_t(counter_t&& rhs) : name(std::move(rhs.name)), count(rhs.count.load()) {}
+    /*!
+     * \brief Returns the total count of each registered counter
+     */
+    std::vector<std::pair<const char*, size_t>> values() {
+        std::lock_guard<std::mutex> l(lock);
+
+        std::vector<std::pair<const char*, size_t>> result;
+
+        for (size_t i = 0; i < size.load(); ++i) {
+            size_t count = retired[i];
 
-    counter_t& operator=(counter_t&& rhs) {
-        if (&rhs != this) {
-            name  = std::move(rhs.name);
-            count = rhs.count.load();
+            for (auto* block : blocks) {
+                count += block->counts[i].load(std::memory_order_relaxed);
+            }
+
+            result.emplace_back(names[i], count);
         }
 
-        return *this;
+        return result;
     }
-};
-
-struct counters_t {
-    std::array<counter_t, max_counters> counters;
-    std::mutex lock;
 
+    /*!
+     * \brief Reset all the counts.
+     *
+     * The increments made concurrently by other threads may be lost.
+     */
     void reset() {
         std::lock_guard<std::mutex> l(lock);
 
-        for (auto& counter : counters) {
-            counter.name  = nullptr;
-            counter.count = 0;
+        retired.fill(0);
+
+        for (auto* block : blocks) {
+            for (auto& count : block->counts) {
+                count.store(0, std::memory_order_relaxed);
+            }
         }
     }
 };
@@ -85,6 +200,57 @@ inline counters_t& get_counters() {
     return counters;
 }
 
+inline counter_block::counter_block() {
+    auto& counters = get_counters();
+
+    std::lock_guard<std::mutex> l(counters.lock);
+    counters.blocks.push_back(this);
+}
+
+inline counter_block::~counter_block() {
+    auto& counters = get_counters();
+
+    std::lock_guard<std::mutex> l(counters.lock);
+
+    // Keep the counts of the thread
+    for (size_t i = 0; i < max_counters; ++i) {
+        counters.retired[i] += counts[i].load(std::memory_order_relaxed);
+    }
+
+    counters.blocks.erase(std::find(counters.blocks.begin(), counters.blocks.end(), this));
+}
+
+/*!
+ * \brief Returns the counters slots of the current thread
+ */
+inline counter_block& local_counters() {
+    thread_local counter_block block;
+    return block;
+}
+
+/*!
+ * \brief A static handle to a counter, registered once
+ */
+struct counter_handle {
+    /*!
+     * \brief Register the counter with the given name
+     * \param name The name of the counter
+     */
+    explicit counter_handle(const char* name) : index(get_counters().index(name)) {}
+
+    /*!
+     * \brief Increase the counter
+     */
+    void inc() const {
+        if (index < max_counters) {
+            local_counters().inc(index);
+        }
+    }
+
+private:
+    size_t index; ///< The index of the counter
+};
+
 /*!
  * \brief Reset all counters
  */
@@ -94,19 +260,39 @@ inline void reset_counters() {
 }
 
 /*!
- * \brief Dump all counters values to the console.
+ * \brief Returns the value of the given counter
+ * \param name The name of the counter
  */
-inline void dump_counters() {
-    decltype(auto) counters = get_counters().counters;
+inline size_t counter_value(const char* name) {
+    for (auto [counter, count] : get_counters().values()) {
+        if (!std::strcmp(counter, name)) {
+            return count;
+        }
+    }
+
+    return 0;
+}
+
+/*!
+ * \brief Returns the used counters, sorted by count (DESC)
+ */
+inline std::vector<std::pair<const char*, size_t>> sorted_counters() {
+    auto counters = get_counters().values();
+
+    counters.erase(std::remove_if(counters.begin(), counters.end(), [](auto& counter) { return !counter.second; }), counters.end());
+
+    std::stable_sort(counters.begin(), counters.end(), [](auto& left, auto& right) { return left.second > right.second; });
 
-    //Sort the counters by count (DESC)
-    std::sort(counters.begin(), counters.end(), [](auto& left, auto& right) { return left.count > right.count; });
+    return counters;
+}
 
+/*!
+ * \brief Dump all counters values to the console.
+ */
+inline void dump_counters() {
     // Print all the used counters
-    for (decltype(auto) counter : counters) {
-        if (counter.name) {
-            std::cout << counter.name << ": " << counter.count << std::endl;
-        }
+    for (auto [name, count] : sorted_counters()) {
+        std::cout << name << ": " << count << std::endl;
     }
 }
 
@@ -114,7 +300,7 @@ inline void dump_counters() {
  * \brief Dump all counters values to the console.
  */
 inline void dump_counters_pretty() {
-    decltype(auto) counters = get_counters().counters;
+    auto counters = sorted_counters();
 
     if(counters.empty()){
         std::cout << "No counters have been recorded!" << std::endl;
@@ -123,9 +309,6 @@ inline void dump_counters_pretty() {
 
     std::cout << std::endl;
 
-    //Sort the counters by count (DESC)
-    std::sort(counters.begin(), counters.end(), [](auto& left, auto& right) { return left.count > right.count; });
-
     constexpr size_t columns = 2;
 
     std::string column_name[columns];
@@ -137,11 +320,9 @@ inline void dump_counters_pretty() {
     column_length[1] = column_name[1].size();
 
     // Compute the width of each column
-    for (decltype(auto) counter : counters) {
-        if (counter.name) {
-            column_length[0] = std::max(column_length[0], std::string(counter.name).size());
-            column_length[1] = std::max(column_length[1], std::to_string(counter.count).size());
-        }
+    for (auto [name, count] : counters) {
+        column_length[0] = std::max(column_length[0], std::string(name).size());
+        column_length[1] = std::max(column_length[1], std::to_string(count).size());
     }
 
     const size_t line_length = (columns + 1) * 1 + 2 + (columns - 1) * 2 + std::accumulate(column_length, column_length + columns, 0);
@@ -155,19 +336,23 @@ inline void dump_counters_pretty() {
     std::cout << " " << std::string(line_length, '-') << '\n';
 
     // Print all the used counters
-    for (decltype(auto) counter : counters) {
-        if (counter.name) {
-            printf(" | %-*s | %-*s |\n",
-                int(column_length[0]), counter.name,
-                int(column_length[1]), std::to_string(counter.count).c_str());
-        }
+    for (auto [name, count] : counters) {
+        printf(" | %-*s | %-*s |\n",
+            int(column_length[0]), name,
+            int(column_length[1]), std::to_string(count).c_str());
     }
 
     std::cout << " " << std::string(line_length, '-') << '\n';
 }
 
 /*!
- * \brief Increase the given counter
+ * \brief Increase the given counter.
+ *
+ * The index of the counter is found in a small per-thread cache indexed
+ * by the address of the name, the registry is only locked on a miss.
+ * The name must remain valid as long as the counters are used (a string
+ * literal).
+ *
  * \param name The name of the counter to increase
  */
 inline void inc_counter(const char* name) {
@@ -175,36 +360,36 @@ inline void inc_counter(const char* name) {
     std::cout << "counter:inc:" << name << std::endl;
 #endif
 
-    decltype(auto) counters = get_counters();
-
-    for (decltype(auto) counter : counters.counters) {
-        if (counter.name == name) {
-            ++counter.count;
+    thread_local std::array<std::pair<const char*, size_t>, counter_cache_size> cache{};
 
-            return;
-        }
-    }
+    // Fibonacci hashing of the address, then linear probing
+    const size_t slot = size_t((uint64_t(reinterpret_cast<uintptr_t>(name)) * 0x9E3779B97F4A7C15ULL) >> 32);
 
-    std::lock_guard<std::mutex> lock(counters.lock);
+    size_t index = max_counters;
 
-    for (decltype(auto) counter : counters.counters) {
-        if (counter.name == name) {
-            ++counter.count;
+    for (size_t probe = 0; probe < counter_cache_size; ++probe) {
+        auto& entry = cache[(slot + probe) & (counter_cache_size - 1)];
 
-            return;
+        if (cpp_likely(entry.first == name)) {
+            index = entry.second;
+            break;
         }
-    }
 
-    for (decltype(auto) counter : counters.counters) {
-        if (!counter.name) {
-            counter.name  = name;
-            counter.count = 1;
+        if (!entry.first) {
+            entry = {name, get_counters().index(name)};
+            index = entry.second;
+            break;
+        }
 
-            return;
+        // The cache is full
+        if (probe == counter_cache_size - 1) {
+            index = get_counters().index(name);
         }
     }
 
-    std::cerr << "Unable to register counter " << name << std::endl;
+    if (index < max_counters) {
+        local_counters().inc(index);
+    }
 }
 
 } //end of namespace etl
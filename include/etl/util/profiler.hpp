@@ -0,0 +1,575 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Hierarchical profiler of the evaluations (ETL_PROFILE).
+ *
+ * Each profiled scope records its name, the selected implementation, the
+ * dimensions of its operands, its number of floating point operations
+ * and of bytes moved, and its wall time. The scopes are nested per
+ * thread and the tasks scheduled on the thread engine are attached to
+ * the scope that scheduled them, giving the busy time of each thread.
+ *
+ * The recorded scopes can be dumped as a flat report of the most
+ * expensive operations, as a tree or as a Chrome trace (chrome://tracing
+ * or Perfetto).
+ */
+
+#pragma once
+
+#include <string>
+
+#ifndef ETL_PROFILE
+
+namespace etl {
+
+/*!
+ * \brief A profiled scope (disabled)
+ */
+struct profile_scope {
+    /*!
+     * \brief Open a new scope
+     * \param name The name of the scope
+     */
+    explicit profile_scope([[maybe_unused]] const char* name) {}
+
+    /*!
+     * \brief Set the implementation selected in this scope
+     * \param impl The name of the implementation
+     */
+    void implementation([[maybe_unused]] const char* impl) {}
+
+    /*!
+     * \brief Set the dimensions of the operands of this scope
+     * \param exprs The operands
+     */
+    template <typename... E>
+    void shape([[maybe_unused]] const E&... exprs) {}
+
+    /*!
+     * \brief Set the number of floating point operations of this scope
+     * \param n The number of operations
+     */
+    void flops([[maybe_unused]] size_t n) {}
+
+    /*!
+     * \brief Set the number of bytes moved by this scope
+     * \param n The number of bytes
+     */
+    void bytes([[maybe_unused]] size_t n) {}
+};
+
+/*!
+ * \brief Reset the profiler
+ */
+inline void reset_profile() {
+    //No profiler
+}
+
+/*!
+ * \brief Dump the most expensive profiled operations to the console
+ * \param top The maximum number of operations to print
+ */
+inline void dump_profile([[maybe_unused]] size_t top = 20) {
+    //No profiler
+}
+
+/*!
+ * \brief Dump the tree of the profiled scopes to the console
+ */
+inline void dump_profile_tree() {
+    //No profiler
+}
+
+/*!
+ * \brief Write the profiled scopes as a Chrome trace
+ * \param path The path of the JSON file
+ * \return true if the file was written, false otherwise
+ */
+inline bool dump_profile_trace([[maybe_unused]] const std::string& path) {
+    return false;
+}
+
+} //end of namespace etl
+
+#else
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace etl {
+
+/*!
+ * \brief A scope recorded by the profiler
+ */
+struct profile_event {
+    const char* name;   ///< The name of the scope
+    const char* impl;   ///< The selected implementation (or nullptr)
+    std::string shape;  ///< The dimensions of the operands
+    size_t flops;       ///< The number of floating point operations
+    size_t bytes;       ///< The number of bytes moved
+    int64_t start;      ///< The start time (ns since the epoch of the profiler)
+    int64_t duration;   ///< The wall time (ns)
+    size_t thread;      ///< The index of the thread
+    size_t id;          ///< The unique identifier of the scope
+    size_t parent;      ///< The identifier of the parent scope (0 for roots)
+    bool task;          ///< Indicates if the scope is a task of the thread engine
+};
+
+/*!
+ * \brief The global state of the profiler
+ */
+struct profiler_t {
+    timer_clock::time_point epoch = timer_clock::now(); ///< The origin of the timestamps
+    std::vector<profile_event> events;                  ///< The completed scopes
+    std::mutex lock;                                    ///< The lock protecting the events
+    std::atomic<size_t> next_id{1};                     ///< The next scope identifier
+    std::atomic<size_t> next_thread{0};                 ///< The next thread index
+
+    /*!
+     * \brief Returns the current time relative to the epoch
+     */
+    int64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(timer_clock::now() - epoch).count();
+    }
+};
+
+/*!
+ * \brief Returns the global profiler
+ */
+inline profiler_t& get_profiler() {
+    static profiler_t profiler;
+    return profiler;
+}
+
+/*!
+ * \brief The profiler state of a thread
+ */
+struct profile_thread_t {
+    size_t index;              ///< The index of the thread
+    std::vector<size_t> stack; ///< The identifiers of the open scopes
+};
+
+/*!
+ * \brief Returns the profiler state of the current thread
+ */
+inline profile_thread_t& local_profile() {
+    thread_local profile_thread_t state{get_profiler().next_thread++, {}};
+    return state;
+}
+
+/*!
+ * \brief Returns the identifier of the innermost open scope of the
+ * current thread (0 if there is none)
+ */
+inline size_t profile_current() {
+    auto& stack = local_profile().stack;
+    return stack.empty() ? 0 : stack.back();
+}
+
+/*!
+ * \brief A profiled scope, recorded when it is destroyed
+ */
+struct profile_scope {
+    /*!
+     * \brief Open a new scope nested in the current scope of the thread
+     * \param name The name of the scope
+     */
+    explicit profile_scope(const char* name) : profile_scope(name, profile_current(), false) {}
+
+    /*!
+     * \brief Open a new scope with the given parent
+     * \param name The name of the scope
+     * \param parent The identifier of the parent scope
+     * \param task Indicates if the scope is a task of the thread engine
+     */
+    profile_scope(const char* name, size_t parent, bool task) {
+        auto& profiler = get_profiler();
+        auto& local    = local_profile();
+
+        event.name   = name;
+        event.impl   = nullptr;
+        event.flops  = 0;
+        event.bytes  = 0;
+        event.thread = local.index;
+        event.id     = profiler.next_id++;
+        event.parent = parent;
+        event.task   = task;
+
+        local.stack.push_back(event.id);
+
+        event.start = profiler.now();
+    }
+
+    profile_scope(const profile_scope& rhs) = delete;
+    profile_scope& operator=(const profile_scope& rhs) = delete;
+
+    /*!
+     * \brief Close the scope and record it
+     */
+    ~profile_scope() {
+        auto& profiler = get_profiler();
+
+        event.duration = profiler.now() - event.start;
+
+        local_profile().stack.pop_back();
+
+        std::lock_guard<std::mutex> l(profiler.lock);
+        profiler.events.push_back(std::move(event));
+    }
+
+    /*!
+     * \brief Set the implementation selected in this scope
+     * \param impl The name of the implementation
+     */
+    void implementation(const char* impl) {
+        event.impl = impl;
+    }
+
+    /*!
+     * \brief Set the dimensions of the operands of this scope
+     * \param exprs The operands
+     */
+    template <typename... E>
+    void shape(const E&... exprs) {
+        auto append = [this](const auto& expr) {
+            if (!event.shape.empty()) {
+                event.shape += ", ";
+            }
+
+            for (size_t d = 0; d < dimensions(expr); ++d) {
+                if (d) {
+                    event.shape += 'x';
+                }
+
+                event.shape += std::to_string(dim(expr, d));
+            }
+        };
+
+        (append(exprs), ...);
+    }
+
+    /*!
+     * \brief Set the number of floating point operations of this scope
+     * \param n The number of operations
+     */
+    void flops(size_t n) {
+        event.flops = n;
+    }
+
+    /*!
+     * \brief Set the number of bytes moved by this scope
+     * \param n The number of bytes
+     */
+    void bytes(size_t n) {
+        event.bytes = n;
+    }
+
+private:
+    profile_event event;
+};
+
+/*!
+ * \brief The scope of a task executed by the thread engine
+ */
+struct profile_task_scope : profile_scope {
+    /*!
+     * \brief Open the scope of a task
+     * \param parent The identifier of the scope that scheduled the task
+     */
+    explicit profile_task_scope(size_t parent) : profile_scope("task", parent, true) {}
+};
+
+/*!
+ * \brief Reset the profiler
+ */
+inline void reset_profile() {
+    auto& profiler = get_profiler();
+
+    std::lock_guard<std::mutex> l(profiler.lock);
+    profiler.events.clear();
+}
+
+/*!
+ * \brief Returns a copy of the recorded scopes
+ */
+inline std::vector<profile_event> profile_events() {
+    auto& profiler = get_profiler();
+
+    std::lock_guard<std::mutex> l(profiler.lock);
+    return profiler.events;
+}
+
+/*!
+ * \brief Returns the busy time of each thread in the tasks of each scope
+ * \param events The recorded scopes
+ * \return A map from the identifier of a scope to the busy time (ns) of
+ * each thread that executed one of its tasks
+ */
+inline std::unordered_map<size_t, std::map<size_t, int64_t>> profile_busy(const std::vector<profile_event>& events) {
+    std::unordered_map<size_t, std::map<size_t, int64_t>> busy;
+
+    for (auto& event : events) {
+        if (event.task) {
+            busy[event.parent][event.thread] += event.duration;
+        }
+    }
+
+    return busy;
+}
+
+/*!
+ * \brief Dump the most expensive profiled operations to the console.
+ *
+ * The scopes are aggregated by name and implementation and sorted by
+ * total time. The parallelism is the total busy time of the threads
+ * divided by the wall time.
+ *
+ * \param top The maximum number of operations to print
+ */
+inline void dump_profile(size_t top = 20) {
+    auto events = profile_events();
+    auto busy   = profile_busy(events);
+
+    struct entry {
+        std::string name;
+        size_t calls  = 0;
+        int64_t time  = 0;
+        int64_t work  = 0;
+        size_t flops  = 0;
+        size_t bytes  = 0;
+    };
+
+    std::map<std::string, entry> entries;
+
+    for (auto& event : events) {
+        if (event.task) {
+            continue;
+        }
+
+        std::string name = event.name;
+
+        if (event.impl) {
+            name += "[";
+            name += event.impl;
+            name += "]";
+        }
+
+        auto& e = entries[name];
+
+        e.name = name;
+        ++e.calls;
+        e.time += event.duration;
+        e.flops += event.flops;
+        e.bytes += event.bytes;
+
+        if (busy.count(event.id)) {
+            for (auto [thread, time] : busy[event.id]) {
+                e.work += time;
+            }
+        } else {
+            e.work += event.duration;
+        }
+    }
+
+    std::vector<entry> sorted;
+
+    for (auto& [name, e] : entries) {
+        sorted.push_back(e);
+    }
+
+    std::sort(sorted.begin(), sorted.end(), [](auto& lhs, auto& rhs) { return lhs.time > rhs.time; });
+
+    if (sorted.size() > top) {
+        sorted.resize(top);
+    }
+
+    if (sorted.empty()) {
+        std::cout << "No scopes have been profiled!" << std::endl;
+        return;
+    }
+
+    size_t length = std::string("Scope").size();
+
+    for (auto& e : sorted) {
+        length = std::max(length, e.name.size());
+    }
+
+    printf(" %-*s | %8s | %12s | %12s | %9s | %9s | %5s\n", int(length), "Scope", "Calls", "Total", "Mean", "GFLOPS", "GB/s", "Par");
+
+    for (auto& e : sorted) {
+        const double seconds = e.time / 1e9;
+
+        printf(" %-*s | %8zu | %12s | %12s | %9.2f | %9.2f | %5.2f\n",
+               int(length), e.name.c_str(), e.calls,
+               duration_string(double(e.time)).c_str(),
+               duration_string(double(e.time) / e.calls).c_str(),
+               seconds > 0.0 ? e.flops / seconds / 1e9 : 0.0,
+               seconds > 0.0 ? e.bytes / seconds / 1e9 : 0.0,
+               e.time > 0 ? double(e.work) / double(e.time) : 1.0);
+    }
+}
+
+/*!
+ * \brief Dump the tree of the profiled scopes to the console.
+ *
+ * The scopes with the same path are aggregated. For the scopes that
+ * scheduled tasks on the thread engine, the busy time of each thread is
+ * printed as well.
+ */
+inline void dump_profile_tree() {
+    auto events = profile_events();
+    auto busy   = profile_busy(events);
+
+    std::unordered_map<size_t, const profile_event*> by_id;
+
+    for (auto& event : events) {
+        by_id[event.id] = &event;
+    }
+
+    auto label = [](const profile_event& event) {
+        std::string name = event.name;
+
+        if (event.impl) {
+            name += "[";
+            name += event.impl;
+            name += "]";
+        }
+
+        return name;
+    };
+
+    struct node {
+        size_t calls  = 0;
+        int64_t time  = 0;
+        std::string shape;
+        std::map<size_t, int64_t> threads;
+    };
+
+    std::map<std::vector<std::string>, node> nodes;
+
+    for (auto& event : events) {
+        if (event.task) {
+            continue;
+        }
+
+        // The tasks are transparent in the paths
+        std::vector<std::string> path{label(event)};
+
+        for (size_t parent = event.parent; parent && by_id.count(parent); parent = by_id[parent]->parent) {
+            if (!by_id[parent]->task) {
+                path.push_back(label(*by_id[parent]));
+            }
+        }
+
+        std::reverse(path.begin(), path.end());
+
+        auto& n = nodes[path];
+
+        ++n.calls;
+        n.time += event.duration;
+        n.shape = event.shape;
+
+        if (busy.count(event.id)) {
+            for (auto [thread, time] : busy[event.id]) {
+                n.threads[thread] += time;
+            }
+        }
+    }
+
+    for (auto& [path, n] : nodes) {
+        std::cout << std::string(2 * (path.size() - 1), ' ') << path.back();
+
+        if (!n.shape.empty()) {
+            std::cout << " (" << n.shape << ")";
+        }
+
+        std::cout << " x" << n.calls << " " << duration_string(double(n.time));
+
+        if (!n.threads.empty()) {
+            std::cout << " busy:";
+
+            for (auto [thread, time] : n.threads) {
+                std::cout << " t" << thread << "=" << duration_string(double(time));
+            }
+        }
+
+        std::cout << std::endl;
+    }
+}
+
+/*!
+ * \brief Write the profiled scopes as a Chrome trace (JSON array of
+ * complete events, one track per thread)
+ *
+ * \param path The path of the JSON file
+ * \return true if the file was written, false otherwise
+ */
+inline bool dump_profile_trace(const std::string& path) {
+    auto events = profile_events();
+
+    std::ofstream stream(path);
+
+    if (!stream) {
+        return false;
+    }
+
+    stream << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+
+    bool first = true;
+
+    for (auto& event : events) {
+        if (!first) {
+            stream << ",";
+        }
+
+        first = false;
+
+        stream << "\n{\"name\":\"" << event.name << "\""
+               << ",\"cat\":\"" << (event.task ? "task" : "etl") << "\""
+               << ",\"ph\":\"X\""
+               << ",\"ts\":" << event.start / 1e3
+               << ",\"dur\":" << event.duration / 1e3
+               << ",\"pid\":0"
+               << ",\"tid\":" << event.thread
+               << ",\"args\":{\"id\":" << event.id << ",\"parent\":" << event.parent;
+
+        if (event.impl) {
+            stream << ",\"impl\":\"" << event.impl << "\"";
+        }
+
+        if (!event.shape.empty()) {
+            stream << ",\"shape\":\"" << event.shape << "\"";
+        }
+
+        if (event.flops) {
+            stream << ",\"flops\":" << event.flops;
+        }
+
+        if (event.bytes) {
+            stream << ",\"bytes\":" << event.bytes;
+        }
+
+        stream << "}}";
+    }
+
+    stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+    return bool(stream);
+}
+
+} //end of namespace etl
+
+#endif
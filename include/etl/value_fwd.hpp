@@ -305,4 +305,16 @@ using custom_fast_matrix = custom_fast_matrix_impl<T, cpp::array_wrapper<T>, ord
 template <typename T, size_t D = 2>
 using sparse_matrix = sparse_matrix_impl<T, sparse_storage::COO, D>;
 
+/*!
+ * \brief A sparse matrix in Compressed Sparse Row format
+ */
+template <typename T, size_t D = 2>
+using csr_matrix = sparse_matrix_impl<T, sparse_storage::CSR, D>;
+
+/*!
+ * \brief A sparse matrix in Compressed Sparse Column format
+ */
+template <typename T, size_t D = 2>
+using csc_matrix = sparse_matrix_impl<T, sparse_storage::CSC, D>;
+
 } //end of namespace etl
@@ -64,9 +64,15 @@ export ETL_DEFAULTS="-DETL_DEBUG_THRESHOLDS -DETL_PARALLEL -DETL_VECTORIZE_FULL
 
 etl_run 6
 
+echo "Test 7. GCC (debug vectorize avx fma find select)"
+
+export ETL_DEFAULTS="-DETL_DEBUG_THRESHOLDS -DETL_VECTORIZE_FULL -DETL_FIND_SELECT -DETL_FMA_REWRITE -mavx2 -mfma"
+
+etl_run 7
+
 if [ "$ETL_NO_GPU" == "" ]
 then
-    echo "Test 7. GCC (debug cublas cufft)"
+    echo "Test 8. GCC (debug cublas cufft)"
 
     export ETL_DEFAULTS="-DETL_DEBUG_THRESHOLDS"
     unset ETL_MKL
@@ -74,5 +80,5 @@ then
     export ETL_CUFFT=true
     export ETL_CUDNN=true
 
-    etl_run 7
+    etl_run 8
 fi
@@ -79,9 +79,15 @@ export ETL_DEFAULTS="-DETL_DEBUG_THRESHOLDS -DETL_PARALLEL -DETL_VECTORIZE_FULL
 
 etl_run 6
 
+echo "Test 7. GCC (debug vectorize avx fma find select)"
+
+export ETL_DEFAULTS="-DETL_DEBUG_THRESHOLDS -DETL_VECTORIZE_FULL -DETL_FIND_SELECT -DETL_FMA_REWRITE -mavx2 -mfma"
+
+etl_run 7
+
 if [ "$ETL_NO_GPU" == "" ]
 then
-    echo "Test 7. GCC (debug cublas cufft)"
+    echo "Test 8. GCC (debug cublas cufft)"
 
     export ETL_DEFAULTS="-DETL_DEBUG_THRESHOLDS"
     unset ETL_MKL
@@ -89,15 +95,15 @@ then
     export ETL_CUFFT=true
     export ETL_CUDNN=true
 
-    etl_run 7
+    etl_run 8
 
     echo "Merge the coverage reports"
 
     if [ "$ETL_LCOV_MERGE" == "" ]
     then
-        merge-xml-coverage.py -o coverage_report.xml coverage_1.xml coverage_2.xml coverage_3.xml coverage_4.xml coverage_5.xml coverage_6.xml coverage_7.xml
+        merge-xml-coverage.py -o coverage_report.xml coverage_1.xml coverage_2.xml coverage_3.xml coverage_4.xml coverage_5.xml coverage_6.xml coverage_7.xml coverage_8.xml
     else
-        lcov --rc lcov_branch_coverage=1 -a coverage_1.dat -a coverage_2.dat -a coverage_3.dat -a coverage_4.dat -a coverage_5.dat -a coverage_6.dat -a coverage_7.dat -o coverage_full.dat
+        lcov --rc lcov_branch_coverage=1 -a coverage_1.dat -a coverage_2.dat -a coverage_3.dat -a coverage_4.dat -a coverage_5.dat -a coverage_6.dat -a coverage_7.dat -a coverage_8.dat -o coverage_full.dat
         lcov_cobertura.py -b debug -o coverage_report.xml coverage_full.dat
         sed -i 's/filename="..\//filename="/' coverage_report.xml
     fi
@@ -106,9 +112,9 @@ else
 
     if [ "$ETL_LCOV_MERGE" == "" ]
     then
-        merge-xml-coverage.py -o coverage_report.xml coverage_1.xml coverage_2.xml coverage_3.xml coverage_4.xml coverage_5.xml coverage_6.xml
+        merge-xml-coverage.py -o coverage_report.xml coverage_1.xml coverage_2.xml coverage_3.xml coverage_4.xml coverage_5.xml coverage_6.xml coverage_7.xml
     else
-        lcov --rc lcov_branch_coverage=1 -a coverage_1.dat -a coverage_2.dat -a coverage_3.dat -a coverage_4.dat -a coverage_5.dat -a coverage_6.dat -o coverage_full.dat
+        lcov --rc lcov_branch_coverage=1 -a coverage_1.dat -a coverage_2.dat -a coverage_3.dat -a coverage_4.dat -a coverage_5.dat -a coverage_6.dat -a coverage_7.dat -o coverage_full.dat
         lcov_cobertura.py -b debug -o coverage_report.xml coverage_full.dat
         sed -i 's/filename="..\//filename="/' coverage_report.xml
     fi
@@ -63,3 +63,69 @@ BIAS_ADD_2D_TEST_CASE("bias_add/1", "[bias_add]") {
     REQUIRE_EQUALS(c(1, 1), T(a(1, 1) + 2));
     REQUIRE_EQUALS(c(1, 2), T(a(1, 2) + 3));
 }
+
+BIAS_ADD_4D_TEST_CASE("bias_add/2", "[bias_add]") {
+    etl::dyn_matrix<T, 4> a(5, 7, 19, 23);
+    etl::dyn_matrix<T, 1> b(7);
+    etl::dyn_matrix<T, 4> c(5, 7, 19, 23);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    Impl::apply(a, b, c);
+
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 7; ++j) {
+            for (size_t k = 0; k < 19; ++k) {
+                for (size_t l = 0; l < 23; ++l) {
+                    REQUIRE_EQUALS_APPROX(c(i, j, k, l), a(i, j, k, l) + b(j));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("bias_add/3", "[bias_add]", T, float, double) {
+    etl::dyn_matrix<T, 4> a(5, 7, 19, 23);
+    etl::dyn_matrix<T, 1> b(7);
+    etl::dyn_matrix<T, 4> c1(5, 7, 19, 23);
+    etl::dyn_matrix<T, 4> c2(5, 7, 19, 23);
+    etl::dyn_matrix<T, 4> c3(5, 7, 19, 23);
+
+    a = etl::uniform_generator(-2.0, 2.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    c1 = etl::bias_add_4d_relu(a, b);
+    c2 = etl::bias_add_4d_sigmoid(a, b);
+    c3 = etl::bias_add_4d_tanh(a, b);
+
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 7; ++j) {
+            for (size_t k = 0; k < 19; ++k) {
+                for (size_t l = 0; l < 23; ++l) {
+                    const T x = a(i, j, k, l) + b(j);
+
+                    REQUIRE_EQUALS_APPROX(c1(i, j, k, l), std::max(x, T(0)));
+                    REQUIRE_EQUALS_APPROX(c2(i, j, k, l), T(1) / (T(1) + std::exp(-x)));
+                    REQUIRE_EQUALS_APPROX(c3(i, j, k, l), std::tanh(x));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("bias_add/4", "[bias_add]", T, float, double) {
+    etl::dyn_matrix<T, 4> a(2, 3, 4, 5);
+    etl::dyn_matrix<T, 1> b(3);
+    etl::dyn_matrix<T, 4> c(2, 3, 4, 5);
+
+    a = etl::uniform_generator(-2.0, 2.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    c = a;
+    c = etl::bias_add_4d_relu(c, b);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], std::max(T(a[i] + b[(i / 20) % 3]), T(0)));
+    }
+}
@@ -0,0 +1,107 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEMPLATE_TEST_CASE_2("conv_1d_stream/0", "[conv][stream]", Z, float, double) {
+    etl::fast_vector<Z, 5> a = {1.0, 2.0, 3.0, 4.0, 5.0};
+    etl::fast_vector<Z, 3> b = {0.5, 1.0, 1.5};
+
+    etl::conv_1d_stream<Z> stream(b, 2);
+
+    etl::fast_vector<Z, 5> c;
+    etl::fast_vector<Z, 2> d;
+
+    stream.push(a, c);
+    stream.flush(d);
+
+    REQUIRE_EQUALS_APPROX(c[0], Z(0.5));
+    REQUIRE_EQUALS_APPROX(c[1], Z(2.0));
+    REQUIRE_EQUALS_APPROX(c[2], Z(5.0));
+    REQUIRE_EQUALS_APPROX(c[3], Z(8.0));
+    REQUIRE_EQUALS_APPROX(c[4], Z(11.0));
+    REQUIRE_EQUALS_APPROX(d[0], Z(11.0));
+    REQUIRE_EQUALS_APPROX(d[1], Z(7.5));
+}
+
+TEMPLATE_TEST_CASE_2("conv_1d_stream/1", "[conv][stream]", Z, float, double) {
+    etl::dyn_vector<Z> a(1500);
+    etl::dyn_vector<Z> b(37);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 13) * 0.25 - 1.0;
+    }
+
+    for (size_t i = 0; i < etl::size(b); ++i) {
+        b[i] = Z(i % 5) * 0.1 - 0.2;
+    }
+
+    etl::dyn_vector<Z> ref(1500 + 37 - 1);
+    ref = selected_helper(etl::conv_impl::STD, etl::conv_1d_full(a, b));
+
+    etl::conv_1d_stream<Z> stream(b, 64);
+
+    REQUIRE_EQUALS(stream.kernel_size(), 37UL);
+    REQUIRE_EQUALS(stream.block_size(), 64UL);
+    REQUIRE_EQUALS(stream.fft_size(), 128UL);
+
+    // Chunks of various sizes, smaller and larger than the block
+    const size_t chunks[] = {17, 64, 200, 1, 63, 155, 1000};
+
+    size_t first = 0;
+
+    for (auto chunk : chunks) {
+        etl::dyn_vector<Z> c(chunk);
+
+        stream.push(etl::slice(a, first, first + chunk), c);
+
+        for (size_t i = 0; i < chunk; ++i) {
+            REQUIRE_EQUALS_APPROX(c[i], ref[first + i]);
+        }
+
+        first += chunk;
+    }
+
+    REQUIRE_EQUALS(first, 1500UL);
+
+    etl::dyn_vector<Z> d(36);
+    stream.flush(d);
+
+    for (size_t i = 0; i < 36; ++i) {
+        REQUIRE_EQUALS_APPROX(d[i], ref[1500 + i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_1d_stream/2", "[conv][stream]", Z, float, double) {
+    etl::dyn_vector<Z> a(100);
+    etl::dyn_vector<Z> b(9);
+
+    a = etl::sequence_generator<Z>(1.0) * 0.1;
+    b = etl::sequence_generator<Z>(-2.0) * 0.5;
+
+    etl::dyn_vector<Z> ref(108);
+    ref = selected_helper(etl::conv_impl::STD, etl::conv_1d_full(a, b));
+
+    etl::conv_1d_stream<Z> stream(b, 16);
+
+    // The convolver can be reused after a flush
+    for (size_t r = 0; r < 2; ++r) {
+        etl::dyn_vector<Z> c(100);
+        etl::dyn_vector<Z> d(8);
+
+        stream.push(a, c);
+        stream.flush(d);
+
+        for (size_t i = 0; i < 100; ++i) {
+            REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+        }
+
+        for (size_t i = 0; i < 8; ++i) {
+            REQUIRE_EQUALS_APPROX(d[i], ref[100 + i]);
+        }
+    }
+}
@@ -0,0 +1,66 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+#ifdef ETL_COUNTERS
+
+ETL_TEST_CASE("counters/1", "[counters]") {
+    etl::reset_counters();
+
+    for (size_t i = 0; i < 100; ++i) {
+        etl::inc_counter("test:counters:a");
+    }
+
+    etl::inc_counter("test:counters:b");
+
+    // The same name at another address is the same counter
+    std::string name = "test:counters:b";
+    etl::inc_counter(name.c_str());
+
+    REQUIRE_EQUALS(etl::counter_value("test:counters:a"), 100UL);
+    REQUIRE_EQUALS(etl::counter_value("test:counters:b"), 2UL);
+
+    etl::reset_counters();
+
+    REQUIRE_EQUALS(etl::counter_value("test:counters:a"), 0UL);
+}
+
+ETL_TEST_CASE("counters/2", "[counters]") {
+    etl::reset_counters();
+
+    static etl::counter_handle handle("test:counters:c");
+
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([]() {
+            for (size_t i = 0; i < 1000; ++i) {
+                handle.inc();
+                etl::inc_counter("test:counters:d");
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // The counts of the finished threads are kept
+    REQUIRE_EQUALS(etl::counter_value("test:counters:c"), 4000UL);
+    REQUIRE_EQUALS(etl::counter_value("test:counters:d"), 4000UL);
+}
+
+#else
+
+ETL_TEST_CASE("counters/disabled/1", "[counters]") {
+    etl::inc_counter("test:counters:a");
+
+    REQUIRE_EQUALS(etl::counter_value("test:counters:a"), 0UL);
+}
+
+#endif
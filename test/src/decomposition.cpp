@@ -41,6 +41,85 @@ TEMPLATE_TEST_CASE_2("globals/lu/2", "[globals][LU]", Z, float, double) {
     REQUIRE_DIRECT(approx_equals(PA, LU, base_eps_etl));
 }
 
+TEMPLATE_TEST_CASE_2("globals/lu/3", "[globals][LU]", Z, float, double) {
+    const size_t n = 150;
+
+    etl::dyn_matrix<Z, 2> A(n, n);
+    etl::dyn_matrix<Z, 2> LU(n, n);
+    std::vector<size_t> pivots;
+
+    A = etl::uniform_generator(-1.0, 1.0);
+
+    REQUIRE_DIRECT(etl::lu(A, LU, pivots));
+    REQUIRE_EQUALS(pivots.size(), n);
+
+    // Apply the row exchanges to A
+    etl::dyn_matrix<Z, 2> PA(A);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            std::swap(PA(i, j), PA(pivots[i], j));
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            Z v(0);
+
+            for (size_t k = 0; k <= std::min(i, j); ++k) {
+                v += (k == i ? Z(1) : LU(i, k)) * LU(k, j);
+            }
+
+            REQUIRE_EQUALS_APPROX_E(v, PA(i, j), 1e-3);
+        }
+
+        // Partial pivoting bounds the multipliers
+        for (size_t k = 0; k < i; ++k) {
+            REQUIRE_DIRECT(std::abs(LU(i, k)) <= Z(1));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("globals/lu/4", "[globals][LU]", Z, float, double) {
+    const size_t n = 97;
+
+    etl::dyn_matrix<Z, 2> A(n, n);
+    etl::dyn_matrix<Z, 2> L(n, n);
+    etl::dyn_matrix<Z, 2> U(n, n);
+    etl::dyn_matrix<Z, 2> P(n, n);
+
+    A = etl::uniform_generator(-1.0, 1.0);
+
+    REQUIRE_DIRECT(etl::lu(A, L, U, P));
+
+    etl::dyn_matrix<Z, 2> PA;
+    etl::dyn_matrix<Z, 2> LU;
+    PA = P * A;
+    LU = L * U;
+
+    for (size_t i = 0; i < etl::size(PA); ++i) {
+        REQUIRE_EQUALS_APPROX_E(PA[i], LU[i], 1e-3);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("globals/lu/5", "[globals][LU]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{1, 2, 3, 2, 4, 6, 1, 1, 1};
+    etl::fast_matrix<Z, 3, 3> LU;
+    std::vector<size_t> pivots;
+
+    REQUIRE_DIRECT(!etl::lu(A, LU, pivots));
+}
+
+TEMPLATE_TEST_CASE_2("globals/lu/6", "[globals][LU]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{1, 2, 3, 4, 5, 6, 7, 8, 10};
+    etl::fast_matrix<Z, 3, 3> L;
+    etl::fast_matrix<Z, 2, 2> U;
+    etl::fast_matrix<Z, 3, 3> P;
+
+    // Matrices of different dimensions are rejected
+    REQUIRE_DIRECT(!etl::lu(A, L, U, P));
+}
+
 /* QR */
 
 TEMPLATE_TEST_CASE_2("globals/qr/1", "[globals][QR]", Z, float, double) {
@@ -57,3 +136,245 @@ TEMPLATE_TEST_CASE_2("globals/qr/1", "[globals][QR]", Z, float, double) {
     // and the large difference in computation around zero
     REQUIRE_DIRECT(approx_equals(QR, A, 100 * base_eps_etl));
 }
+
+TEMPLATE_TEST_CASE_2("globals/qr/2", "[globals][QR]", Z, float, double) {
+    for (auto [m, n] : {std::pair<size_t, size_t>{150, 130}, {90, 140}}) {
+        etl::dyn_matrix<Z, 2> A(m, n);
+        etl::dyn_matrix<Z, 2> Q(m, m);
+        etl::dyn_matrix<Z, 2> R(m, n);
+
+        A = etl::uniform_generator(-1.0, 1.0);
+
+        REQUIRE_DIRECT(etl::qr(A, Q, R));
+
+        etl::dyn_matrix<Z, 2> QR;
+        etl::dyn_matrix<Z, 2> QtQ;
+        QR  = Q * R;
+        QtQ = etl::transpose(Q) * Q;
+
+        for (size_t i = 0; i < etl::size(A); ++i) {
+            REQUIRE_EQUALS_APPROX_E(QR[i], A[i], 1e-3);
+        }
+
+        for (size_t i = 0; i < m; ++i) {
+            for (size_t j = 0; j < m; ++j) {
+                REQUIRE_EQUALS_APPROX_E(QtQ(i, j), i == j ? Z(1) : Z(0), 1e-3);
+            }
+
+            for (size_t j = 0; j < std::min(i, n); ++j) {
+                REQUIRE_EQUALS(R(i, j), Z(0));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("globals/cholesky/1", "[globals][cholesky]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{4, 12, -16, 12, 37, -43, -16, -43, 98};
+    etl::fast_matrix<Z, 3, 3> L;
+
+    REQUIRE_DIRECT(etl::cholesky(A, L));
+
+    REQUIRE_EQUALS_APPROX(L(0, 0), Z(2));
+    REQUIRE_EQUALS_APPROX(L(1, 0), Z(6));
+    REQUIRE_EQUALS_APPROX(L(1, 1), Z(1));
+    REQUIRE_EQUALS_APPROX(L(2, 0), Z(-8));
+    REQUIRE_EQUALS_APPROX(L(2, 1), Z(5));
+    REQUIRE_EQUALS_APPROX(L(2, 2), Z(3));
+
+    REQUIRE_EQUALS(L(0, 1), Z(0));
+    REQUIRE_EQUALS(L(0, 2), Z(0));
+    REQUIRE_EQUALS(L(1, 2), Z(0));
+}
+
+TEMPLATE_TEST_CASE_2("globals/cholesky/2", "[globals][cholesky]", Z, float, double) {
+    const size_t n = 150;
+
+    etl::dyn_matrix<Z, 2> M(n, n);
+    etl::dyn_matrix<Z, 2> A(n, n);
+    etl::dyn_matrix<Z, 2> L(n, n);
+
+    M = etl::uniform_generator(-1.0, 1.0);
+    A = M * etl::transpose(M);
+
+    for (size_t i = 0; i < n; ++i) {
+        A(i, i) += Z(n);
+    }
+
+    REQUIRE_DIRECT(etl::cholesky(A, L));
+
+    etl::dyn_matrix<Z, 2> LLt;
+    LLt = L * etl::transpose(L);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j <= i; ++j) {
+            REQUIRE_EQUALS_APPROX_E(LLt(i, j), A(i, j), 1e-3);
+        }
+
+        for (size_t j = i + 1; j < n; ++j) {
+            REQUIRE_EQUALS(L(i, j), Z(0));
+        }
+    }
+
+    // Not positive definite
+    A(100, 100) = -1;
+
+    REQUIRE_DIRECT(!etl::cholesky(A, L));
+}
+
+TEMPLATE_TEST_CASE_2("globals/eigen_sym/1", "[globals][eigen]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 2> A{2, 1, 1, 2};
+    etl::fast_vector<Z, 2> values;
+    etl::fast_matrix<Z, 2, 2> vectors;
+
+    REQUIRE_DIRECT(etl::eigen_sym(A, values, vectors));
+
+    REQUIRE_EQUALS_APPROX(values[0], Z(1));
+    REQUIRE_EQUALS_APPROX(values[1], Z(3));
+
+    REQUIRE_EQUALS_APPROX(std::abs(vectors(0, 0)), Z(std::sqrt(0.5)));
+    REQUIRE_EQUALS_APPROX(vectors(0, 0), -vectors(1, 0));
+    REQUIRE_EQUALS_APPROX(vectors(0, 1), vectors(1, 1));
+}
+
+TEMPLATE_TEST_CASE_2("globals/eigen_sym/2", "[globals][eigen]", Z, float, double) {
+    for (size_t n : {1UL, 7UL, 150UL}) {
+        etl::dyn_matrix<Z, 2> M(n, n);
+        etl::dyn_matrix<Z, 2> A(n, n);
+        etl::dyn_vector<Z> values(n);
+        etl::dyn_matrix<Z, 2> vectors(n, n);
+
+        M = etl::uniform_generator(-1.0, 1.0);
+        A = M + etl::transpose(M);
+
+        REQUIRE_DIRECT(etl::eigen_sym(A, values, vectors));
+
+        etl::dyn_matrix<Z, 2> AV;
+        etl::dyn_matrix<Z, 2> VtV;
+        AV  = A * vectors;
+        VtV = etl::transpose(vectors) * vectors;
+
+        for (size_t j = 0; j < n; ++j) {
+            if (j > 0) {
+                REQUIRE_DIRECT(values[j - 1] <= values[j]);
+            }
+
+            for (size_t i = 0; i < n; ++i) {
+                REQUIRE_EQUALS_APPROX_E(AV(i, j), values[j] * vectors(i, j), 1e-3);
+                REQUIRE_EQUALS_APPROX_E(VtV(i, j), i == j ? Z(1) : Z(0), 1e-3);
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("globals/svd/1", "[globals][svd]", Z, float, double) {
+    const size_t m = 120;
+    const size_t n = 90;
+    const size_t r = 5;
+
+    etl::dyn_matrix<Z, 2> L(m, r);
+    etl::dyn_matrix<Z, 2> R(r, n);
+    etl::dyn_matrix<Z, 2> A(m, n);
+
+    L = etl::uniform_generator(-1.0, 1.0);
+    R = etl::uniform_generator(-1.0, 1.0);
+    A = L * R;
+
+    etl::dyn_matrix<Z, 2> U(m, r);
+    etl::dyn_vector<Z> s(r);
+    etl::dyn_matrix<Z, 2> V(n, r);
+
+    etl::random_engine g(42);
+
+    REQUIRE_DIRECT(etl::svd(A, U, s, V, g));
+
+    // The singular values are the square roots of the eigenvalues of A^T A
+
+    etl::dyn_matrix<Z, 2> AtA;
+    etl::dyn_vector<Z> values(n);
+    etl::dyn_matrix<Z, 2> vectors(n, n);
+
+    AtA = etl::transpose(A) * A;
+
+    REQUIRE_DIRECT(etl::eigen_sym(AtA, values, vectors));
+
+    for (size_t j = 0; j < r; ++j) {
+        REQUIRE_EQUALS_APPROX_E(s[j], Z(std::sqrt(values[n - 1 - j])), 1e-2);
+
+        if (j > 0) {
+            REQUIRE_DIRECT(s[j - 1] >= s[j]);
+        }
+    }
+
+    etl::dyn_matrix<Z, 2> US(m, r);
+    etl::dyn_matrix<Z, 2> USVt;
+    etl::dyn_matrix<Z, 2> UtU;
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < r; ++j) {
+            US(i, j) = U(i, j) * s[j];
+        }
+    }
+
+    USVt = US * etl::transpose(V);
+    UtU  = etl::transpose(U) * U;
+
+    for (size_t i = 0; i < etl::size(A); ++i) {
+        REQUIRE_EQUALS_APPROX_E(USVt[i], A[i], 1e-3);
+    }
+
+    for (size_t i = 0; i < r; ++i) {
+        for (size_t j = 0; j < r; ++j) {
+            REQUIRE_EQUALS_APPROX_E(UtU(i, j), i == j ? Z(1) : Z(0), 1e-3);
+        }
+    }
+
+    // Invalid number of singular values
+    etl::dyn_vector<Z> too_many(n + 1);
+    REQUIRE_DIRECT(!etl::svd(A, U, too_many, V, g));
+}
+
+ETL_TEST_CASE("globals/svd/2", "[globals][svd]") {
+    const size_t m = 60;
+    const size_t n = 40;
+    const size_t r = 3;
+
+    etl::dyn_matrix<double, 2> L(m, r);
+    etl::dyn_matrix<double, 2> R(r, n);
+    etl::dyn_matrix<double, 2> A(m, n);
+
+    L = etl::uniform_generator(-1.0, 1.0);
+    R = etl::uniform_generator(-1.0, 1.0);
+    A = L * R;
+
+    // Concurrent decompositions with their own random engine
+
+    constexpr size_t T = 4;
+
+    std::vector<etl::dyn_vector<double>> s(T, etl::dyn_vector<double>(r));
+    std::vector<char> valid(T, 0);
+
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < T; ++t) {
+        threads.emplace_back([&, t]() {
+            SERIAL_SECTION {
+                etl::dyn_matrix<double, 2> U(m, r);
+                etl::dyn_matrix<double, 2> V(n, r);
+
+                valid[t] = etl::svd(A, U, s[t], V);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t t = 0; t < T; ++t) {
+        REQUIRE_DIRECT(valid[t]);
+
+        for (size_t j = 0; j < r; ++j) {
+            REQUIRE_EQUALS_APPROX_E(s[t][j], s[0][j], 1e-6);
+        }
+    }
+}
@@ -588,6 +588,30 @@ ASUM_TEST_CASE("asum/2", "asum") {
     REQUIRE_EQUALS(value, T(76.9));
 }
 
+SUM_TEST_CASE("sum/3", "sum") {
+    etl::dyn_vector<T> a(1024 * 1024 + 3);
+
+    a = T(0.1);
+
+    T value = 0;
+    Impl::apply(a, value);
+
+    REQUIRE_EQUALS_APPROX_E(value, T((1024 * 1024 + 3) * double(T(0.1))), 1e-5);
+}
+
+ASUM_TEST_CASE("asum/3", "asum") {
+    etl::dyn_vector<T> a(1024 * 1024 + 3);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = i % 2 ? T(0.1) : T(-0.1);
+    }
+
+    T value = 0;
+    Impl::apply(a, value);
+
+    REQUIRE_EQUALS_APPROX_E(value, T((1024 * 1024 + 3) * double(T(0.1))), 1e-5);
+}
+
 TEMPLATE_TEST_CASE_2("dyn_vector/sum_2", "sum", Z, double, float) {
     etl::dyn_vector<Z> a = {-1.0, 2.0, 8.5};
 
@@ -612,6 +636,79 @@ TEMPLATE_TEST_CASE_2("dyn_vector/norm_1", "[dyn][reduc][norm]", Z, double, float
     REQUIRE_EQUALS_APPROX(d, 8.30662);
 }
 
+TEMPLATE_TEST_CASE_2("dyn_vector/norm_2", "[dyn][reduc][norm]", Z, double, float) {
+    etl::dyn_vector<Z> a(100000);
+
+    a = Z(0.5);
+
+    auto d = norm(a);
+
+    REQUIRE_EQUALS_APPROX_E(d, Z(std::sqrt(100000 * 0.25)), 1e-5);
+}
+
+TEMPLATE_TEST_CASE_2("dyn_vector/mean_variance_1", "[dyn][reduc][mean]", Z, double, float) {
+    etl::dyn_vector<Z> a = {-1.5, 2.5, 8.0, 1.0};
+
+    auto [m, v] = mean_variance(a);
+
+    REQUIRE_EQUALS_APPROX(m, Z(2.5));
+    REQUIRE_EQUALS_APPROX(v, Z(12.125));
+    REQUIRE_EQUALS_APPROX(variance(a), Z(12.125));
+    REQUIRE_EQUALS_APPROX(stddev(a), Z(3.48210));
+}
+
+TEMPLATE_TEST_CASE_2("dyn_vector/mean_variance_2", "[dyn][reduc][mean]", Z, double, float) {
+    etl::dyn_vector<Z> a(500001);
+
+    // Large offset and small spread to catch cancellation
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(1000.0) + (i % 2 ? Z(0.25) : Z(-0.25));
+    }
+
+    auto [m, v] = mean_variance(a);
+
+    REQUIRE_EQUALS_APPROX_E(m, Z(1000.0 - 0.25 / 500001.0), 1e-6);
+    REQUIRE_EQUALS_APPROX_E(v, Z(0.0625), 1e-3);
+}
+
+TEMPLATE_TEST_CASE_2("dyn_vector/mean_variance_3", "[dyn][reduc][mean]", Z, int, long) {
+    // More elements than the parallel threshold and than a block
+    etl::dyn_vector<Z> a(7 * 20000);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 7);
+    }
+
+    auto [m, v] = mean_variance(a);
+
+    REQUIRE_EQUALS(m, Z(3));
+    REQUIRE_EQUALS(v, Z(4));
+    REQUIRE_EQUALS(variance(a), Z(4));
+    REQUIRE_EQUALS(stddev(a), Z(2));
+}
+
+TEMPLATE_TEST_CASE_2("dyn_vector/mean_variance_4", "[dyn][reduc][mean]", Z, int, long) {
+    etl::dyn_vector<Z> a(20);
+
+    // Variance of 3.6
+    for (size_t i = 0; i < 18; ++i) {
+        a[i] = i % 2 ? Z(2) : Z(-2);
+    }
+
+    a[18] = Z(0);
+    a[19] = Z(0);
+
+    REQUIRE_EQUALS(mean_variance(a).first, Z(0));
+    REQUIRE_EQUALS(variance(a), Z(3));
+    REQUIRE_EQUALS(stddev(a), Z(1));
+
+    // The mean is truncated like etl::mean
+    etl::dyn_vector<Z> b = {-3, -4, -4};
+
+    REQUIRE_EQUALS(mean_variance(b).first, etl::mean(b));
+    REQUIRE_EQUALS(mean_variance(b).first, Z(-3));
+}
+
 // Complex tests
 
 TEMPLATE_TEST_CASE_2("dyn_vector/complex", "dyn_vector::complex", Z, double, float) {
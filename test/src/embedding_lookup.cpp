@@ -213,3 +213,135 @@ TEMPLATE_TEST_CASE_2("batch_embedding_gradients/0", "[batch_embedding_gradients]
     REQUIRE_EQUALS(c(7, 1), 0);
     REQUIRE_EQUALS(c(7, 2), 0);
 }
+
+TEMPLATE_TEST_CASE_2("batch_embedding_lookup/1", "[batch_embedding_lookup]", T, float, double) {
+    etl::dyn_matrix<T, 2> a(16, 33);
+    etl::dyn_matrix<T, 2> b(100, 37);
+    etl::dyn_matrix<T, 3> c(16, 33, 37);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = T((i * 37 + 11) % 100);
+    }
+
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    c = batch_embedding_lookup(a, b);
+
+    for (size_t bb = 0; bb < 16; ++bb) {
+        for (size_t i = 0; i < 33; ++i) {
+            for (size_t d = 0; d < 37; ++d) {
+                REQUIRE_EQUALS(c(bb, i, d), b(size_t(a(bb, i)), d));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_embedding_gradients/1", "[batch_embedding_gradients]", T, float, double) {
+    etl::dyn_matrix<T, 2> a(16, 33);
+    etl::dyn_matrix<T, 3> b(16, 33, 37);
+    etl::dyn_matrix<T, 2> c(100, 37);
+    etl::dyn_matrix<T, 2> ref(100, 37);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = T((i * 7) % 60);
+    }
+
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    c = batch_embedding_gradients(a, b, c);
+
+    ref = 0;
+
+    for (size_t bb = 0; bb < 16; ++bb) {
+        for (size_t i = 0; i < 33; ++i) {
+            for (size_t d = 0; d < 37; ++d) {
+                ref(size_t(a(bb, i)), d) += b(bb, i, d);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+ETL_TEST_CASE("embedding_gradients/mixed", "[embedding_gradients]") {
+    etl::fast_matrix<float, 4> a({1, 2, 1, 0});
+    etl::fast_matrix<float, 4, 2> b{1, 2, 3, 4, 0.5, 0.5, -1, -2};
+
+    // The errors are float and the gradients are double, the rows cannot
+    // be accumulated through raw pointers
+    etl::fast_matrix<double, 3, 2> c;
+    c = embedding_gradients(a, b, c);
+
+    REQUIRE_EQUALS(c(0, 0), -1.0);
+    REQUIRE_EQUALS(c(0, 1), -2.0);
+    REQUIRE_EQUALS(c(1, 0), 1.5);
+    REQUIRE_EQUALS(c(1, 1), 2.5);
+    REQUIRE_EQUALS(c(2, 0), 3.0);
+    REQUIRE_EQUALS(c(2, 1), 4.0);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_embedding_gradients/0", "[embedding_gradients]", T, float, double) {
+    etl::fast_matrix<T, 6> a({1, 2, 3, 2, 6, 1});
+    etl::fast_matrix<T, 6, 3> b{ 1, 2, 3,  4, 5, 6,  0.1, 0.2, 0.3,  -1.0, -1.0, 0.0,  1, 1, 1,  2, 2, 2 };
+
+    std::vector<size_t> rows;
+    etl::dyn_matrix<T, 2> values;
+
+    etl::sparse_embedding_gradients(a, b, rows, values);
+
+    REQUIRE_EQUALS(rows.size(), 4UL);
+    REQUIRE_EQUALS(rows[0], 1UL);
+    REQUIRE_EQUALS(rows[1], 2UL);
+    REQUIRE_EQUALS(rows[2], 3UL);
+    REQUIRE_EQUALS(rows[3], 6UL);
+
+    REQUIRE_EQUALS(etl::dim<0>(values), 4UL);
+    REQUIRE_EQUALS(etl::dim<1>(values), 3UL);
+
+    REQUIRE_EQUALS(values(0, 0), T(3));
+    REQUIRE_EQUALS(values(0, 1), T(4));
+    REQUIRE_EQUALS(values(0, 2), T(5));
+
+    REQUIRE_EQUALS(values(1, 0), T(3));
+    REQUIRE_EQUALS(values(1, 1), T(4));
+    REQUIRE_EQUALS(values(1, 2), T(6));
+
+    REQUIRE_EQUALS(values(2, 0), T(0.1));
+    REQUIRE_EQUALS(values(2, 1), T(0.2));
+    REQUIRE_EQUALS(values(2, 2), T(0.3));
+
+    REQUIRE_EQUALS(values(3, 0), T(1));
+    REQUIRE_EQUALS(values(3, 1), T(1));
+    REQUIRE_EQUALS(values(3, 2), T(1));
+}
+
+TEMPLATE_TEST_CASE_2("sparse_embedding_gradients/1", "[embedding_gradients]", T, float, double) {
+    etl::dyn_matrix<T, 2> a(16, 33);
+    etl::dyn_matrix<T, 3> b(16, 33, 37);
+    etl::dyn_matrix<T, 2> dense(100, 37);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = T((i * 7) % 60);
+    }
+
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    dense = batch_embedding_gradients(a, b, dense);
+
+    std::vector<size_t> rows;
+    etl::dyn_matrix<T, 2> values;
+
+    etl::sparse_embedding_gradients(a, b, rows, values);
+
+    REQUIRE_EQUALS(rows.size(), 60UL);
+
+    for (size_t u = 0; u < rows.size(); ++u) {
+        REQUIRE_EQUALS(rows[u], u);
+
+        for (size_t d = 0; d < 37; ++d) {
+            REQUIRE_EQUALS_APPROX(values(u, d), dense(rows[u], d));
+        }
+    }
+}
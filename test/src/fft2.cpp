@@ -235,3 +235,55 @@ TEMPLATE_TEST_CASE_2("fft_2d_many/2", "[fast][fft]", Z, float, double) {
     REQUIRE_EQUALS_APPROX(a(1, 1, 1).real(), Z(-3.5));
     REQUIRE_EQUALS_APPROX(a(1, 1, 1).imag(), Z(1.0));
 }
+
+FFT2_TEST_CASE("fft_2d_c/5", "[fast][fft]") {
+    etl::dyn_matrix<std::complex<T>> a(40, 24);
+    etl::dyn_matrix<std::complex<T>> c(40, 24);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = std::complex<T>(T(i % 7) - 3.0, T(i % 5) * 0.5);
+    }
+
+    Impl::apply(a, c);
+
+    const double pi = M_PI;
+
+    for (size_t k1 = 0; k1 < 40; k1 += 7) {
+        for (size_t k2 = 0; k2 < 24; k2 += 5) {
+            std::complex<double> ref(0.0, 0.0);
+
+            for (size_t i = 0; i < 40; ++i) {
+                for (size_t j = 0; j < 24; ++j) {
+                    const double angle = -2.0 * pi * (double(k1 * i) / 40.0 + double(k2 * j) / 24.0);
+                    ref += std::complex<double>(a(i, j)) * std::complex<double>(std::cos(angle), std::sin(angle));
+                }
+            }
+
+            REQUIRE_EQUALS_APPROX_E(c(k1, k2).real(), T(ref.real()), base_eps_etl_large);
+            REQUIRE_EQUALS_APPROX_E(c(k1, k2).imag(), T(ref.imag()), base_eps_etl_large);
+        }
+    }
+}
+
+FFT2_MANY_TEST_CASE("fft_2d_many/3", "[fast][fft]") {
+    etl::dyn_matrix<std::complex<T>, 3> a(64, 6, 10);
+    etl::dyn_matrix<std::complex<T>, 3> c(64, 6, 10);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = std::complex<T>(T(i % 11) - 5.0, T(i % 3));
+    }
+
+    Impl::apply(a, c);
+
+    for (size_t b = 0; b < 64; ++b) {
+        etl::dyn_matrix<std::complex<T>> ref(6, 10);
+        ref = etl::fft_2d(a(b));
+
+        for (size_t i = 0; i < 6; ++i) {
+            for (size_t j = 0; j < 10; ++j) {
+                REQUIRE_EQUALS_APPROX(c(b, i, j).real(), ref(i, j).real());
+                REQUIRE_EQUALS_APPROX(c(b, i, j).imag(), ref(i, j).imag());
+            }
+        }
+    }
+}
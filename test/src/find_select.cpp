@@ -0,0 +1,163 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+#ifdef ETL_FIND_SELECT
+
+TEMPLATE_TEST_CASE_2("find_select/gemm/1", "[find_select]", Z, float, double) {
+    etl::dyn_matrix<Z> a(33, 17);
+    etl::dyn_matrix<Z> b(17, 21);
+    etl::dyn_matrix<Z> c(33, 21);
+    etl::dyn_matrix<Z> ref(33, 21);
+
+    a = etl::sequence_generator<Z>(1.0) * Z(0.01);
+    b = etl::sequence_generator<Z>(1.0) * Z(-0.02);
+
+    SELECTED_SECTION(etl::gemm_impl::STD) {
+        ref = a * b;
+    }
+
+    // A selection is only cached when there is a choice to make
+    using M = etl::dyn_matrix<Z>;
+
+    const size_t timed = etl::gemm_expr<M, M, false>::template find_gemm_candidates<M, M, M>().size() > 1 ? 1 : 0;
+
+    etl::reset_find_select();
+
+    c = a * b;
+
+    REQUIRE_EQUALS(etl::find_select_size(), timed);
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+
+    // The same shape uses the cached selection
+    c = 0;
+    c = a * b;
+
+    REQUIRE_EQUALS(etl::find_select_size(), timed);
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+
+    // The forced selections are not touched
+    SELECTED_SECTION(etl::gemm_impl::STD) {
+        etl::dyn_matrix<Z> d(33, 33);
+        d = a * transpose(a);
+    }
+
+    REQUIRE_EQUALS(etl::find_select_size(), timed);
+}
+
+TEMPLATE_TEST_CASE_2("find_select/conv4/1", "[find_select]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> input(2, 3, 9, 9);
+    etl::dyn_matrix<Z, 4> kernel(4, 3, 3, 3);
+    etl::dyn_matrix<Z, 4> c(2, 4, 7, 7);
+    etl::dyn_matrix<Z, 4> ref(2, 4, 7, 7);
+
+    input  = etl::sequence_generator<Z>(1.0) * Z(0.1);
+    kernel = etl::sequence_generator<Z>(1.0) * Z(-0.2);
+
+    SELECTED_SECTION(etl::conv4_impl::STD) {
+        ref = etl::conv_4d_valid(input, kernel);
+    }
+
+    using M = etl::dyn_matrix<Z, 4>;
+
+    const bool timed = etl::detail::find_conv4_valid_candidates<M, M, M>().size() > 1;
+
+    etl::reset_find_select();
+
+    c = etl::conv_4d_valid(input, kernel);
+
+    REQUIRE_DIRECT(!timed || etl::find_select_size() >= 1);
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("find_select/fft1/1", "[find_select]", Z, float, double) {
+    etl::dyn_vector<Z> a(64);
+    etl::dyn_vector<std::complex<Z>> c(64);
+    etl::dyn_vector<std::complex<Z>> ref(64);
+
+    a = etl::sequence_generator<Z>(1.0) * Z(0.1);
+
+    SELECTED_SECTION(etl::fft_impl::STD) {
+        ref = etl::fft_1d(a);
+    }
+
+    const size_t timed = etl::detail::find_fft_candidates(etl::detail::select_default_fft1_impl(etl::local_context().cpu)).size() > 1 ? 1 : 0;
+
+    etl::reset_find_select();
+
+    c = etl::fft_1d(a);
+
+    REQUIRE_EQUALS(etl::find_select_size(), timed);
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i].real(), ref[i].real());
+        REQUIRE_EQUALS_APPROX(c[i].imag(), ref[i].imag());
+    }
+
+    // The in-place transforms are not timed
+    etl::dyn_vector<std::complex<Z>> d(33);
+
+    for (size_t i = 0; i < etl::size(d); ++i) {
+        d[i] = std::complex<Z>(Z(i), Z(0));
+    }
+
+    d.fft_inplace();
+
+    REQUIRE_EQUALS(etl::find_select_size(), timed);
+}
+
+TEMPLATE_TEST_CASE_2("find_select/fft2/1", "[find_select]", Z, float, double) {
+    etl::dyn_matrix<std::complex<Z>> a(16, 12);
+    etl::dyn_matrix<std::complex<Z>> c(16, 12);
+    etl::dyn_matrix<std::complex<Z>> ref(16, 12);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = std::complex<Z>(Z(i) * Z(0.1), Z(i % 7) * Z(-0.2));
+    }
+
+    SELECTED_SECTION(etl::fft_impl::STD) {
+        ref = etl::ifft_2d(a);
+    }
+
+    const size_t timed = etl::detail::find_fft_candidates(etl::detail::select_default_fft2_impl(etl::local_context().cpu)).size() > 1 ? 1 : 0;
+
+    etl::reset_find_select();
+
+    c = etl::ifft_2d(a);
+
+    REQUIRE_EQUALS(etl::find_select_size(), timed);
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i].real(), ref[i].real());
+        REQUIRE_EQUALS_APPROX(c[i].imag(), ref[i].imag());
+    }
+}
+
+#else
+
+ETL_TEST_CASE("find_select/disabled/1", "[find_select]") {
+    etl::dyn_matrix<float> a(3, 3);
+    etl::dyn_matrix<float> c(3, 3);
+
+    a = etl::sequence_generator<float>(1.0);
+
+    c = a * a;
+
+    REQUIRE_EQUALS(c(0, 0), 30.0f);
+}
+
+#endif
@@ -0,0 +1,129 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEMPLATE_TEST_CASE_2("gemm/adapters/lower", "[gemm][adapters]", Z, float, double) {
+    const size_t n = 150;
+    const size_t m = 90;
+
+    etl::lower_matrix<etl::dyn_matrix<Z>> a(n);
+    etl::dyn_matrix<Z> d(n, n);
+    etl::dyn_matrix<Z> b(n, m);
+    etl::dyn_matrix<Z> bt(m, n);
+
+    d  = etl::uniform_generator(-1.0, 1.0);
+    b  = etl::uniform_generator(-1.0, 1.0);
+    bt = etl::uniform_generator(-1.0, 1.0);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            if (j <= i) {
+                a(i, j) = d(i, j);
+            } else {
+                d(i, j) = Z(0);
+            }
+        }
+    }
+
+    etl::dyn_matrix<Z> c1(n, m);
+    etl::dyn_matrix<Z> c2(n, m);
+    etl::dyn_matrix<Z> c3(m, n);
+    etl::dyn_matrix<Z> c4(m, n);
+
+    c1 = a * b;
+    c2 = d * b;
+    c3 = bt * a;
+    c4 = bt * d;
+
+    for (size_t i = 0; i < etl::size(c1); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c1[i], c2[i], 1e-3);
+    }
+
+    for (size_t i = 0; i < etl::size(c3); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c3[i], c4[i], 1e-3);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("gemm/adapters/upper", "[gemm][adapters]", Z, float, double) {
+    const size_t n = 150;
+    const size_t m = 90;
+
+    etl::upper_matrix<etl::dyn_matrix<Z>> a(n);
+    etl::dyn_matrix<Z> d(n, n);
+    etl::dyn_matrix<Z> b(n, m);
+    etl::dyn_matrix<Z> bt(m, n);
+
+    d  = etl::uniform_generator(-1.0, 1.0);
+    b  = etl::uniform_generator(-1.0, 1.0);
+    bt = etl::uniform_generator(-1.0, 1.0);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            if (j >= i) {
+                a(i, j) = d(i, j);
+            } else {
+                d(i, j) = Z(0);
+            }
+        }
+    }
+
+    etl::dyn_matrix<Z> c1(n, m);
+    etl::dyn_matrix<Z> c2(n, m);
+    etl::dyn_matrix<Z> c3(m, n);
+    etl::dyn_matrix<Z> c4(m, n);
+
+    c1 = a * b;
+    c2 = d * b;
+    c3 = bt * a;
+    c4 = bt * d;
+
+    for (size_t i = 0; i < etl::size(c1); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c1[i], c2[i], 1e-3);
+    }
+
+    for (size_t i = 0; i < etl::size(c3); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c3[i], c4[i], 1e-3);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("gemm/adapters/diagonal", "[gemm][adapters]", Z, float, double) {
+    const size_t n = 70;
+    const size_t m = 45;
+
+    etl::diagonal_matrix<etl::dyn_matrix<Z>> a(n);
+    etl::dyn_matrix<Z> d(n, n);
+    etl::dyn_matrix<Z> b(n, m);
+    etl::dyn_matrix<Z> bt(m, n);
+
+    d  = 0;
+    b  = etl::uniform_generator(-1.0, 1.0);
+    bt = etl::uniform_generator(-1.0, 1.0);
+
+    for (size_t i = 0; i < n; ++i) {
+        d(i, i) = Z(i + 1) / Z(10);
+        a(i, i) = d(i, i);
+    }
+
+    etl::dyn_matrix<Z> c1(n, m);
+    etl::dyn_matrix<Z> c2(n, m);
+    etl::dyn_matrix<Z> c3(m, n);
+    etl::dyn_matrix<Z> c4(m, n);
+
+    c1 = a * b;
+    c2 = d * b;
+    c3 = bt * a;
+    c4 = bt * d;
+
+    for (size_t i = 0; i < etl::size(c1); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c1[i], c2[i], 1e-5);
+    }
+
+    for (size_t i = 0; i < etl::size(c3); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c3[i], c4[i], 1e-5);
+    }
+}
@@ -134,3 +134,215 @@ TEMPLATE_TEST_CASE_2("ml/bce/error/2", "[ml]", Z, double, float) {
     auto both = etl::ml::bce(o, l, Z(1.1), Z(1.0 / 128));
     REQUIRE_EQUALS_APPROX(both.second, Z(error));
 }
+
+TEMPLATE_TEST_CASE_2("ml/softmax_cross_entropy/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> o(37, 13);
+    etl::dyn_matrix<Z> l(37, 13);
+
+    for (size_t i = 0; i < 37 * 13; ++i) {
+        o[i] = 0.1 * ((i * 7) % 23) - 1.0;
+        l[i] = (i % 13) == (i / 13) % 13 ? 1.0 : 0.0;
+    }
+
+    etl::dyn_matrix<Z> s(37, 13);
+    s = etl::stable_softmax(o);
+
+    etl::dyn_matrix<Z> g(37, 13);
+    auto loss = etl::ml::softmax_cross_entropy(o, l, g, Z(1.0 / 37));
+
+    REQUIRE_EQUALS_APPROX(loss, etl::ml::cce_loss(s, l, Z(-1.0 / 37)));
+
+    for (size_t i = 0; i < 37 * 13; ++i) {
+        REQUIRE_EQUALS_APPROX(g[i], s[i] - l[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("ml/softmax_cross_entropy/2", "[ml]", Z, double, float) {
+    // Large logits (exp overflows without the maximum) and soft labels
+    etl::dyn_matrix<Z> o(129, 33);
+    etl::dyn_matrix<Z> l(129, 33);
+
+    for (size_t i = 0; i < 129 * 33; ++i) {
+        o[i] = 1000.0 + 3.0 * ((i * 13) % 17);
+        l[i] = Z(1.0 / 33);
+    }
+
+    etl::dyn_matrix<Z> g(129, 33);
+    auto loss = etl::ml::softmax_cross_entropy(o, l, g);
+
+    long double expected = 0;
+
+    for (size_t r = 0; r < 129; ++r) {
+        long double m = o(r, 0);
+
+        for (size_t j = 0; j < 33; ++j) {
+            m = std::max(m, (long double)o(r, j));
+        }
+
+        long double s = 0;
+
+        for (size_t j = 0; j < 33; ++j) {
+            s += std::exp(o(r, j) - m);
+        }
+
+        for (size_t j = 0; j < 33; ++j) {
+            expected -= l(r, j) * (o(r, j) - m - std::log(s));
+            REQUIRE_EQUALS_APPROX(g(r, j), Z(std::exp(o(r, j) - m) / s - l(r, j)));
+        }
+    }
+
+    REQUIRE_EQUALS_APPROX(loss, Z(expected));
+
+    // The gradient of each row sums to zero
+    REQUIRE_DIRECT(std::abs(etl::sum(g)) < 1e-3);
+}
+
+ETL_TEST_CASE("ml/softmax_cross_entropy/3", "[ml]") {
+    // Labels with a different value type than the logits
+    etl::dyn_matrix<float> o(19, 21);
+    etl::dyn_matrix<double> l(19, 21);
+    etl::dyn_matrix<float> lf(19, 21);
+
+    for (size_t i = 0; i < 19 * 21; ++i) {
+        o[i]  = 0.1 * ((i * 7) % 23) - 1.0;
+        l[i]  = (i % 21) == (i / 21) % 21 ? 1.0 : 0.0;
+        lf[i] = l[i];
+    }
+
+    etl::dyn_matrix<float> g(19, 21);
+    etl::dyn_matrix<float> ref_g(19, 21);
+
+    auto loss     = etl::ml::softmax_cross_entropy(o, l, g);
+    auto ref_loss = etl::ml::softmax_cross_entropy(o, lf, ref_g);
+
+    REQUIRE_EQUALS_APPROX(loss, ref_loss);
+
+    for (size_t i = 0; i < 19 * 21; ++i) {
+        REQUIRE_EQUALS_APPROX(g[i], ref_g[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("ml/batch_norm/stats/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> a(67, 37);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = 100.0 + 0.01 * ((i * 37) % 101) + (i % 37);
+    }
+
+    etl::dyn_vector<Z> mean(37);
+    etl::dyn_vector<Z> var(37);
+
+    etl::ml::batch_norm_stats(a, mean, var);
+
+    etl::dyn_vector<Z> ref_mean(37);
+    etl::dyn_vector<Z> ref_var(37);
+
+    ref_mean = etl::bias_batch_mean_2d(a);
+    ref_var  = etl::bias_batch_var_2d(a, ref_mean);
+
+    for (size_t k = 0; k < 37; ++k) {
+        REQUIRE_EQUALS_APPROX(mean[k], ref_mean[k]);
+        REQUIRE_EQUALS_APPROX_E(var[k], ref_var[k], 1e-3);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("ml/batch_norm/stats/2", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z, 4> a(5, 19, 7, 9);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = 0.1 * ((i * 13) % 29) - 1.0;
+    }
+
+    etl::dyn_vector<Z> mean(19);
+    etl::dyn_vector<Z> var(19);
+
+    etl::ml::batch_norm_stats(a, mean, var);
+
+    etl::dyn_vector<Z> ref_mean(19);
+    ref_mean = etl::bias_batch_mean_4d(a);
+
+    for (size_t k = 0; k < 19; ++k) {
+        Z v = 0;
+
+        for (size_t b = 0; b < 5; ++b) {
+            for (size_t i = 0; i < 7; ++i) {
+                for (size_t j = 0; j < 9; ++j) {
+                    v += (a(b, k, i, j) - ref_mean[k]) * (a(b, k, i, j) - ref_mean[k]);
+                }
+            }
+        }
+
+        REQUIRE_EQUALS_APPROX(mean[k], ref_mean[k]);
+        REQUIRE_EQUALS_APPROX(var[k], v / (5 * 7 * 9));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("ml/batch_norm/apply/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> a(23, 21);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = 0.5 * ((i * 7) % 17) - 2.0;
+    }
+
+    etl::dyn_vector<Z> mean(21);
+    etl::dyn_vector<Z> var(21);
+    etl::dyn_vector<Z> gamma(21);
+    etl::dyn_vector<Z> beta(21);
+
+    gamma = etl::sequence_generator<Z>(1.0) * 0.1;
+    beta  = etl::sequence_generator<Z>(-1.0);
+
+    etl::ml::batch_norm_stats(a, mean, var);
+
+    etl::dyn_matrix<Z> c(23, 21);
+    etl::ml::batch_norm_apply(a, mean, var, gamma, beta, c, Z(1e-3));
+
+    for (size_t b = 0; b < 23; ++b) {
+        for (size_t k = 0; k < 21; ++k) {
+            REQUIRE_EQUALS_APPROX(c(b, k), gamma[k] * (a(b, k) - mean[k]) / std::sqrt(var[k] + Z(1e-3)) + beta[k]);
+        }
+    }
+
+    // In place
+    etl::ml::batch_norm_apply(a, mean, var, gamma, beta, a, Z(1e-3));
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(a[i], c[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("ml/batch_norm/apply/2", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z, 4> a(3, 5, 6, 7);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = 0.25 * ((i * 11) % 23) + 1.0;
+    }
+
+    etl::dyn_vector<Z> mean(5);
+    etl::dyn_vector<Z> var(5);
+    etl::dyn_vector<Z> gamma(5);
+    etl::dyn_vector<Z> beta(5);
+
+    gamma = 1.0;
+    beta  = 0.0;
+
+    etl::ml::batch_norm_stats(a, mean, var);
+
+    etl::dyn_matrix<Z, 4> c(3, 5, 6, 7);
+    etl::ml::batch_norm_apply(a, mean, var, gamma, beta, c, Z(0));
+
+    // Each channel of the output is normalized
+    etl::dyn_vector<Z> out_mean(5);
+    etl::dyn_vector<Z> out_var(5);
+
+    etl::ml::batch_norm_stats(c, out_mean, out_var);
+
+    for (size_t k = 0; k < 5; ++k) {
+        REQUIRE_DIRECT(std::abs(out_mean[k]) < 1e-4);
+        REQUIRE_EQUALS_APPROX(out_var[k], Z(1.0));
+
+        for (size_t b = 0; b < 3; ++b) {
+            REQUIRE_EQUALS_APPROX(c(b, k, 2, 3), (a(b, k, 2, 3) - mean[k]) / std::sqrt(var[k]));
+        }
+    }
+}
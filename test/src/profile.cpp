@@ -0,0 +1,111 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#ifdef ETL_PROFILE
+
+ETL_TEST_CASE("profile/scopes/1", "[profile]") {
+    etl::reset_profile();
+
+    {
+        etl::profile_scope outer("outer");
+
+        {
+            etl::profile_scope inner("inner");
+
+            inner.implementation("VEC");
+            inner.flops(100);
+            inner.bytes(200);
+        }
+    }
+
+    auto events = etl::profile_events();
+
+    REQUIRE_EQUALS(events.size(), 2UL);
+
+    // The inner scope is completed first
+    REQUIRE_EQUALS(std::string(events[0].name), "inner");
+    REQUIRE_EQUALS(std::string(events[0].impl), "VEC");
+    REQUIRE_EQUALS(events[0].flops, 100UL);
+    REQUIRE_EQUALS(events[0].bytes, 200UL);
+    REQUIRE_EQUALS(events[0].parent, events[1].id);
+
+    REQUIRE_EQUALS(std::string(events[1].name), "outer");
+    REQUIRE_EQUALS(events[1].parent, 0UL);
+    REQUIRE_DIRECT(events[1].duration >= events[0].duration);
+}
+
+TEMPLATE_TEST_CASE_2("profile/gemm/1", "[profile]", Z, float, double) {
+    etl::dyn_matrix<Z> a(64, 32);
+    etl::dyn_matrix<Z> b(32, 16);
+    etl::dyn_matrix<Z> c(64, 16);
+
+    a = Z(1);
+    b = Z(2);
+
+    etl::reset_profile();
+
+    c = a * b;
+
+    auto events = etl::profile_events();
+
+    bool found = false;
+
+    for (auto& event : events) {
+        if (std::string(event.name) == "gemm") {
+            found = true;
+
+            REQUIRE_DIRECT(event.impl != nullptr);
+            REQUIRE_EQUALS(event.shape, "64x32, 32x16");
+            REQUIRE_EQUALS(event.flops, 2UL * 64 * 32 * 16);
+            REQUIRE_EQUALS(event.bytes, sizeof(Z) * (64 * 32 + 32 * 16 + 64 * 16));
+        }
+    }
+
+    REQUIRE_DIRECT(found);
+    REQUIRE_EQUALS(c(0, 0), Z(64));
+}
+
+ETL_TEST_CASE("profile/trace/1", "[profile]") {
+    etl::reset_profile();
+
+    {
+        etl::profile_scope scope("traced");
+        scope.implementation("STD");
+    }
+
+    REQUIRE_DIRECT(etl::dump_profile_trace("test_profile.tmp.etl"));
+
+    std::ifstream stream("test_profile.tmp.etl");
+    std::stringstream content;
+    content << stream.rdbuf();
+
+    auto json = content.str();
+
+    REQUIRE_DIRECT(json.find("\"traceEvents\"") != std::string::npos);
+    REQUIRE_DIRECT(json.find("\"name\":\"traced\"") != std::string::npos);
+    REQUIRE_DIRECT(json.find("\"impl\":\"STD\"") != std::string::npos);
+    REQUIRE_DIRECT(json.find("\"ph\":\"X\"") != std::string::npos);
+}
+
+#else
+
+ETL_TEST_CASE("profile/disabled/1", "[profile]") {
+    {
+        etl::profile_scope scope("disabled");
+        scope.implementation("STD");
+        scope.flops(1);
+    }
+
+    REQUIRE_DIRECT(!etl::dump_profile_trace("test_profile.tmp.etl"));
+}
+
+#endif
@@ -448,3 +448,130 @@ TEMPLATE_TEST_CASE_2("argmin/2", "[mean]", Z, float, double) {
 
     REQUIRE_EQUALS(etl::argmin(a), 8UL);
 }
+
+TEMPLATE_TEST_CASE_2("argmax/3", "[mean]", Z, float, double) {
+    etl::dyn_vector<Z> a(10007);
+
+    // Several occurrences of the maximum, the first one must be found
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 101) * 0.5;
+    }
+
+    a[4567] = 100.0;
+    a[4568] = 100.0;
+    a[9999] = 100.0;
+
+    SELECTED_SECTION(etl::sum_impl::STD) {
+        REQUIRE_EQUALS(etl::argmax(a), 4567UL);
+        REQUIRE_EQUALS(etl::max(a), Z(100.0));
+    }
+
+    SELECTED_SECTION(etl::sum_impl::VEC) {
+        REQUIRE_EQUALS(etl::argmax(a), 4567UL);
+        REQUIRE_EQUALS(etl::max(a), Z(100.0));
+    }
+
+    PARALLEL_SECTION {
+        REQUIRE_EQUALS(etl::argmax(a), 4567UL);
+    }
+
+    a[10006] = 101.0;
+
+    REQUIRE_EQUALS(etl::argmax(a), 10006UL);
+
+    a[0] = 102.0;
+
+    REQUIRE_EQUALS(etl::argmax(a), 0UL);
+}
+
+TEMPLATE_TEST_CASE_2("argmin/3", "[mean]", Z, float, double) {
+    etl::dyn_vector<Z> a(10007);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 101) * -0.5;
+    }
+
+    a[7] = -100.0;
+    a[9001] = -100.0;
+
+    SELECTED_SECTION(etl::sum_impl::STD) {
+        REQUIRE_EQUALS(etl::argmin(a), 7UL);
+        REQUIRE_EQUALS(etl::min(a), Z(-100.0));
+    }
+
+    SELECTED_SECTION(etl::sum_impl::VEC) {
+        REQUIRE_EQUALS(etl::argmin(a), 7UL);
+        REQUIRE_EQUALS(etl::min(a), Z(-100.0));
+    }
+
+    PARALLEL_SECTION {
+        REQUIRE_EQUALS(etl::argmin(a), 7UL);
+    }
+
+    a[9000] = -101.0;
+
+    REQUIRE_EQUALS(etl::argmin(a), 9000UL);
+}
+
+TEMPLATE_TEST_CASE_2("batch_argmax/0", "[mean]", Z, float, double) {
+    etl::dyn_matrix<Z> a(7, 5003);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 97) * 0.25;
+    }
+
+    for (size_t i = 0; i < 7; ++i) {
+        a(i, (i * 997 + 1) % 5003) = 50.0;
+        a(i, (i * 1231 + 2) % 5003) = -50.0;
+    }
+
+    etl::dyn_vector<size_t> b;
+    etl::dyn_vector<size_t> c;
+
+    b = etl::batch_argmax(a);
+    c = etl::batch_argmin(a);
+
+    REQUIRE_EQUALS(etl::size(b), 7UL);
+    REQUIRE_EQUALS(etl::size(c), 7UL);
+
+    for (size_t i = 0; i < 7; ++i) {
+        REQUIRE_EQUALS(b[i], (i * 997 + 1) % 5003);
+        REQUIRE_EQUALS(c[i], (i * 1231 + 2) % 5003);
+        REQUIRE_EQUALS(b[i], etl::max_index(a(i)));
+        REQUIRE_EQUALS(c[i], etl::min_index(a(i)));
+    }
+
+    PARALLEL_SECTION {
+        b = etl::batch_argmax(a);
+
+        for (size_t i = 0; i < 7; ++i) {
+            REQUIRE_EQUALS(b[i], (i * 997 + 1) % 5003);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_argmax/1", "[mean]", Z, float, double) {
+    etl::dyn_matrix_cm<Z> a(7, 503);
+
+    for (size_t i = 0; i < 7; ++i) {
+        for (size_t j = 0; j < 503; ++j) {
+            a(i, j) = Z((i + j) % 97) * 0.25;
+        }
+    }
+
+    for (size_t i = 0; i < 7; ++i) {
+        a(i, (i * 97 + 1) % 503)  = 50.0;
+        a(i, (i * 131 + 2) % 503) = -50.0;
+    }
+
+    etl::dyn_vector<size_t> b;
+    etl::dyn_vector<size_t> c;
+
+    b = etl::batch_argmax(a);
+    c = etl::batch_argmin(a);
+
+    for (size_t i = 0; i < 7; ++i) {
+        REQUIRE_EQUALS(b[i], (i * 97 + 1) % 503);
+        REQUIRE_EQUALS(c[i], (i * 131 + 2) % 503);
+    }
+}
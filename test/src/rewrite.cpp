@@ -0,0 +1,493 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+#include <atomic>
+
+namespace {
+
+template <typename Z>
+Z ref_sigmoid(Z x) {
+    return Z(1) / (Z(1) + std::exp(-x));
+}
+
+template <typename A, typename B, typename C>
+void ref_mul(const A& a, const B& b, C& c) {
+    for (size_t i = 0; i < etl::dim<0>(a); ++i) {
+        for (size_t j = 0; j < etl::dim<1>(b); ++j) {
+            c(i, j) = 0;
+
+            for (size_t k = 0; k < etl::dim<1>(a); ++k) {
+                c(i, j) += a(i, k) * b(k, j);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief The number of applications of counted_op
+ */
+std::atomic<size_t> counted_calls{0};
+
+/*!
+ * \brief Unary operator counting its applications, to check that a
+ * common subexpression is only evaluated once
+ */
+template <typename T>
+struct counted_op {
+    static constexpr bool linear      = true;
+    static constexpr bool thread_safe = true;
+
+    template <etl::vector_mode_t V>
+    static constexpr bool vectorizable = false;
+
+    template <typename E>
+    static constexpr bool gpu_computable = false;
+
+    static T apply(const T& x) noexcept {
+        ++counted_calls;
+        return x + T(1);
+    }
+
+    static std::string desc() noexcept {
+        return "counted";
+    }
+};
+
+template <typename E>
+auto counted(E&& value) -> etl::detail::unary_helper<E, counted_op> {
+    return etl::detail::unary_helper<E, counted_op>{value};
+}
+
+} // end of anonymous namespace
+
+// Common subexpressions
+
+TEMPLATE_TEST_CASE_2("rewrite/cse/1", "[rewrite]", Z, float, double) {
+    etl::dyn_vector<Z> a(17);
+    etl::dyn_vector<Z> b(17);
+
+    a = etl::uniform_generator(-2.0, 2.0);
+
+    b = etl::sigmoid_derivative(a);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], ref_sigmoid(a[i]) * (Z(1) - ref_sigmoid(a[i])));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("rewrite/cse/2", "[rewrite]", Z, float, double) {
+    etl::dyn_vector<Z> a(17);
+    etl::dyn_vector<Z> b(17);
+
+    a = etl::uniform_generator(-2.0, 2.0);
+
+    b = etl::tanh_derivative(a);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], Z(1) - std::tanh(a[i]) * std::tanh(a[i]));
+        REQUIRE_EQUALS_APPROX(etl::tanh_derivative(a)[i], b[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("rewrite/cse/3", "[rewrite]", Z, float, double) {
+    etl::dyn_vector<Z> a(19);
+    etl::dyn_vector<Z> b(19);
+    etl::dyn_vector<Z> c(19);
+
+    a = etl::uniform_generator(-2.0, 2.0);
+    b = etl::uniform_generator(-2.0, 2.0);
+
+    // Same types, different sub expressions
+    c = etl::sigmoid(a) >> (Z(1) - etl::sigmoid(b));
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref_sigmoid(a[i]) * (Z(1) - ref_sigmoid(b[i])));
+    }
+
+    c = (etl::exp(a) + b) / etl::exp(a);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], (std::exp(a[i]) + b[i]) / std::exp(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("rewrite/cse/4", "[rewrite]", Z, float, double) {
+    etl::dyn_vector<Z> a(23);
+    etl::dyn_vector<Z> b(23);
+    etl::dyn_vector<Z> c(23);
+
+    a = etl::sequence_generator(1.0);
+    b = etl::sequence_generator(-5.0);
+
+    counted_calls = 0;
+    c             = counted(a) >> counted(a);
+
+    REQUIRE_EQUALS(counted_calls.load(), 23UL);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], (a[i] + Z(1)) * (a[i] + Z(1)));
+    }
+
+    counted_calls = 0;
+    c             = counted(a) >> (Z(2) - counted(a));
+
+    REQUIRE_EQUALS(counted_calls.load(), 23UL);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], (a[i] + Z(1)) * (Z(2) - (a[i] + Z(1))));
+    }
+
+    counted_calls = 0;
+    c             = (b + counted(a)) / counted(a);
+
+    REQUIRE_EQUALS(counted_calls.load(), 23UL);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], (b[i] + a[i] + Z(1)) / (a[i] + Z(1)));
+    }
+
+    // Different operands are evaluated separately
+    counted_calls = 0;
+    c             = counted(a) >> counted(b);
+
+    REQUIRE_EQUALS(counted_calls.load(), 46UL);
+}
+
+// Multiply-add
+
+TEMPLATE_TEST_CASE_2("rewrite/fma/1", "[rewrite]", Z, float, double) {
+    etl::dyn_vector<Z> a(33);
+    etl::dyn_vector<Z> b(33);
+    etl::dyn_vector<Z> c(33);
+    etl::dyn_vector<Z> d(33);
+
+    a = etl::sequence_generator(1.0);
+    b = etl::sequence_generator(-5.0);
+
+    c = Z(2.5) * a + b;
+    d = b + a * Z(0.5);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], Z(2.5) * a[i] + b[i]);
+        REQUIRE_EQUALS_APPROX(d[i], b[i] + a[i] * Z(0.5));
+    }
+
+    c = (a >> b) + a;
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], a[i] * b[i] + a[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("rewrite/fma/2", "[rewrite]", Z, float, double) {
+    etl::dyn_vector<Z> a(37);
+    etl::dyn_vector<Z> b(37);
+    etl::dyn_vector<Z> c(37);
+
+    a = etl::uniform_generator(-10.0, 10.0);
+    b = etl::uniform_generator(-10.0, 10.0);
+
+    // The vectorized loop, its remainder and the element accessors must
+    // round the same way
+    c = a * Z(1.1) + b;
+
+    auto expr = a * Z(1.1) + b;
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS(c[i], expr[i]);
+        REQUIRE_EQUALS(c[i], expr.read_flat(i));
+
+        if (etl::fma_rewrite) {
+            REQUIRE_EQUALS(c[i], std::fma(a[i], Z(1.1), b[i]));
+        }
+    }
+}
+
+// Fused transposition
+
+TEMPLATE_TEST_CASE_2("rewrite/gemm_tn/1", "[rewrite][gemm]", Z, float, double) {
+    etl::dyn_matrix<Z> a(7, 5);
+    etl::dyn_matrix<Z> b(7, 9);
+    etl::dyn_matrix<Z> c(5, 9);
+    etl::dyn_matrix<Z> ref(5, 9);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> ta(5, 7);
+    ta = etl::transpose(a);
+
+    ref_mul(ta, b, ref);
+
+    c = Z(2) * (etl::transpose(a) * b);
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], Z(2) * ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("rewrite/gemm_nt/1", "[rewrite][gemm]", Z, float, double) {
+    etl::dyn_matrix<Z> a(5, 7);
+    etl::dyn_matrix<Z> b(9, 7);
+    etl::dyn_matrix<Z> c(5, 9);
+    etl::dyn_matrix<Z> ref(5, 9);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> tb(7, 9);
+    tb = etl::transpose(b);
+
+    ref_mul(a, tb, ref);
+
+    c = (a * etl::transpose(b)) + Z(1);
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i] + Z(1));
+    }
+}
+
+// Chains of multiplications
+
+TEMPLATE_TEST_CASE_2("rewrite/chain/1", "[rewrite][gemm]", Z, float, double) {
+    // (a * b) * c is cheaper
+    etl::dyn_matrix<Z> a(3, 17);
+    etl::dyn_matrix<Z> b(17, 2);
+    etl::dyn_matrix<Z> c(2, 11);
+    etl::dyn_matrix<Z> ab(3, 2);
+    etl::dyn_matrix<Z> ref(3, 11);
+    etl::dyn_matrix<Z> d(3, 11);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+    c = etl::uniform_generator(-1.0, 1.0);
+
+    ref_mul(a, b, ab);
+    ref_mul(ab, c, ref);
+
+    d = a * b * c;
+
+    for (size_t i = 0; i < etl::size(d); ++i) {
+        REQUIRE_EQUALS_APPROX(d[i], ref[i]);
+    }
+
+    d = a * (b * c);
+
+    for (size_t i = 0; i < etl::size(d); ++i) {
+        REQUIRE_EQUALS_APPROX(d[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("rewrite/chain/2", "[rewrite][gemm]", Z, float, double) {
+    // a * (b * c) is cheaper
+    etl::dyn_matrix<Z> a(13, 11);
+    etl::dyn_matrix<Z> b(11, 9);
+    etl::dyn_matrix<Z> c(9, 2);
+    etl::dyn_matrix<Z> bc(11, 2);
+    etl::dyn_matrix<Z> ref(13, 2);
+    etl::dyn_matrix<Z> d(13, 2);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+    c = etl::uniform_generator(-1.0, 1.0);
+
+    ref_mul(b, c, bc);
+    ref_mul(a, bc, ref);
+
+    d = a * b * c;
+
+    for (size_t i = 0; i < etl::size(d); ++i) {
+        REQUIRE_EQUALS_APPROX(d[i], ref[i]);
+    }
+
+    // Chain inside an element-wise expression
+    d = Z(3) * (a * b * c) - Z(1);
+
+    for (size_t i = 0; i < etl::size(d); ++i) {
+        REQUIRE_EQUALS_APPROX(d[i], Z(3) * ref[i] - Z(1));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("rewrite/chain/3", "[rewrite][gemm]", Z, float, double) {
+    etl::dyn_matrix<Z> a(4, 6);
+    etl::dyn_matrix<Z> b(4, 5);
+    etl::dyn_matrix<Z> c(5, 3);
+    etl::dyn_matrix<Z> d(3, 2);
+    etl::dyn_matrix<Z> ta(6, 4);
+    etl::dyn_matrix<Z> t1(6, 5);
+    etl::dyn_matrix<Z> t2(6, 3);
+    etl::dyn_matrix<Z> ref(6, 2);
+    etl::dyn_matrix<Z> e(6, 2);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+    c = etl::uniform_generator(-1.0, 1.0);
+    d = etl::uniform_generator(-1.0, 1.0);
+
+    ta = etl::transpose(a);
+
+    ref_mul(ta, b, t1);
+    ref_mul(t1, c, t2);
+    ref_mul(t2, d, ref);
+
+    e = etl::transpose(a) * b * c * d;
+
+    for (size_t i = 0; i < etl::size(e); ++i) {
+        REQUIRE_EQUALS_APPROX(e[i], ref[i]);
+    }
+
+    e = Z(0.5) * (etl::transpose(a) * b * c * d);
+
+    for (size_t i = 0; i < etl::size(e); ++i) {
+        REQUIRE_EQUALS_APPROX(e[i], Z(0.5) * ref[i]);
+    }
+}
+
+#ifdef ETL_COUNTERS
+
+TEMPLATE_TEST_CASE_2("rewrite/counters/cse", "[rewrite][counters]", Z, float, double) {
+    etl::dyn_vector<Z> a(33);
+    etl::dyn_vector<Z> b(33);
+    etl::dyn_vector<Z> c(33);
+
+    a = etl::uniform_generator(-2.0, 2.0);
+    b = etl::uniform_generator(-2.0, 2.0);
+
+    etl::reset_counters();
+
+    c = etl::sigmoid_derivative(a);
+
+    REQUIRE_EQUALS(etl::counter_value("rewrite:cse"), 1UL);
+
+    etl::reset_counters();
+
+    c = etl::tanh_derivative(a);
+
+    REQUIRE_EQUALS(etl::counter_value("rewrite:cse"), 1UL);
+
+    etl::reset_counters();
+
+    c = (etl::exp(a) + b) / etl::exp(a);
+
+    REQUIRE_EQUALS(etl::counter_value("rewrite:cse"), 1UL);
+
+    // Same types, but different sub expressions
+    etl::reset_counters();
+
+    c = etl::sigmoid(a) >> (Z(1) - etl::sigmoid(b));
+
+    REQUIRE_EQUALS(etl::counter_value("rewrite:cse"), 0UL);
+}
+
+TEMPLATE_TEST_CASE_2("rewrite/counters/fma", "[rewrite][counters]", Z, float, double) {
+    etl::dyn_vector<Z> a(33);
+    etl::dyn_vector<Z> b(33);
+    etl::dyn_vector<Z> c(33);
+
+    a = etl::sequence_generator(1.0);
+    b = etl::sequence_generator(-5.0);
+
+    // The multiply-add is only fused with ETL_FMA_REWRITE, when the target
+    // has FMA instructions
+    const size_t fused = etl::fma_rewrite ? 1 : 0;
+
+    etl::reset_counters();
+
+    c = Z(2.5) * a + b;
+
+    REQUIRE_EQUALS(etl::counter_value("rewrite:fma"), fused);
+
+    etl::reset_counters();
+
+    c = b + a * Z(0.5);
+
+    REQUIRE_EQUALS(etl::counter_value("rewrite:fma"), fused);
+
+    etl::reset_counters();
+
+    c = (a >> b) + a;
+
+    REQUIRE_EQUALS(etl::counter_value("rewrite:fma"), fused);
+
+    etl::reset_counters();
+
+    c = a + b;
+
+    REQUIRE_EQUALS(etl::counter_value("rewrite:fma"), 0UL);
+}
+
+ETL_TEST_CASE("rewrite/counters/1", "[rewrite][counters]") {
+    etl::dyn_matrix<float> a(16, 16);
+    etl::dyn_matrix<float> b(16, 2);
+    etl::dyn_matrix<float> c(2, 16);
+    etl::dyn_matrix<float> d(16, 16);
+    etl::dyn_matrix<float> e(2, 16);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+    c = etl::uniform_generator(-1.0, 1.0);
+
+    etl::reset_counters();
+
+    d = a * b * c;
+
+    REQUIRE_EQUALS(etl::counter_value("gemm:chain_left"), 1UL);
+    REQUIRE_EQUALS(etl::counter_value("gemm:chain_right"), 0UL);
+
+    etl::reset_counters();
+
+    e = c * (a * a);
+
+    REQUIRE_EQUALS(etl::counter_value("gemm:chain_left"), 1UL);
+    REQUIRE_EQUALS(etl::counter_value("gemm:chain_right"), 0UL);
+
+    etl::reset_counters();
+
+    e = (c * a) * a;
+
+    REQUIRE_EQUALS(etl::counter_value("gemm:chain_left"), 1UL);
+    REQUIRE_EQUALS(etl::counter_value("gemm:chain_right"), 0UL);
+}
+
+ETL_TEST_CASE("rewrite/counters/2", "[rewrite][counters]") {
+    etl::dyn_matrix<float> a(16, 16);
+    etl::dyn_matrix<float> b(16, 2);
+    etl::dyn_matrix<float> c(16, 2);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    etl::reset_counters();
+
+    c = a * a * b;
+
+    REQUIRE_EQUALS(etl::counter_value("gemm:chain_left"), 0UL);
+    REQUIRE_EQUALS(etl::counter_value("gemm:chain_right"), 1UL);
+
+    // The transposition is not evaluated, only the temporary of the
+    // product is allocated
+    etl::dyn_matrix<float> d(16, 2);
+
+    d = transpose(a) * b;
+    c = 2.0f * (transpose(a) * b);
+
+    etl::reset_counters();
+
+    d = transpose(a) * b;
+
+    auto direct = etl::counter_value("cpu:allocate");
+
+    etl::reset_counters();
+
+    c = 2.0f * (transpose(a) * b);
+
+    REQUIRE_EQUALS(etl::counter_value("cpu:allocate"), direct + 1);
+}
+
+#endif
@@ -0,0 +1,168 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+// rfft_1d
+
+TEMPLATE_TEST_CASE_2("rfft_1d/0", "[fast][fft]", Z, float, double) {
+    etl::fast_matrix<Z, 8> a{1.0, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0};
+    etl::fast_matrix<std::complex<Z>, 5> c;
+
+    c = etl::rfft_1d(a);
+
+    REQUIRE_EQUALS_APPROX(c(0).real(), Z(4.0));
+    REQUIRE_EQUALS_APPROX(c(0).imag(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(1).real(), Z(1.0));
+    REQUIRE_EQUALS_APPROX(c(1).imag(), Z(-2.41421));
+    REQUIRE_EQUALS_APPROX(c(2).real(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(2).imag(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(3).real(), Z(1.0));
+    REQUIRE_EQUALS_APPROX(c(3).imag(), Z(-0.41421));
+    REQUIRE_EQUALS_APPROX(c(4).real(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(4).imag(), Z(0.0));
+}
+
+TEMPLATE_TEST_CASE_2("rfft_1d/1", "[fast][fft]", Z, float, double) {
+    etl::fast_matrix<Z, 5> a{1.0, 2.0, 3.0, 4.0, 5.0};
+    etl::fast_matrix<std::complex<Z>, 3> c;
+
+    c = etl::rfft_1d(a);
+
+    REQUIRE_EQUALS_APPROX(c(0).real(), Z(15.0));
+    REQUIRE_EQUALS_APPROX(c(0).imag(), Z(0.0));
+    REQUIRE_EQUALS_APPROX(c(1).real(), Z(-2.5));
+    REQUIRE_EQUALS_APPROX(c(1).imag(), Z(3.440955));
+    REQUIRE_EQUALS_APPROX(c(2).real(), Z(-2.5));
+    REQUIRE_EQUALS_APPROX(c(2).imag(), Z(0.8123));
+}
+
+TEMPLATE_TEST_CASE_2("rfft_1d/2", "[fast][fft]", Z, float, double) {
+    etl::dyn_vector<Z> a(1030);
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_vector<std::complex<Z>> c(516);
+    etl::dyn_vector<std::complex<Z>> ref(1030);
+
+    c   = etl::rfft_1d(a);
+    ref = etl::fft_1d(a);
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i].real(), ref[i].real(), base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c[i].imag(), ref[i].imag(), base_eps_etl_large);
+    }
+}
+
+// irfft_1d
+
+TEMPLATE_TEST_CASE_2("irfft_1d/0", "[fast][fft]", Z, float, double) {
+    etl::fast_matrix<Z, 8> a{0.5, 1.5, 3.5, -1.5, 3.9, -5.5, 2.0, 1.0};
+    etl::fast_matrix<Z, 8> c;
+
+    c = etl::irfft_1d(etl::rfft_1d(a));
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], a[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("irfft_1d/1", "[fast][fft]", Z, float, double) {
+    etl::dyn_vector<Z> a(7);
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_vector<std::complex<Z>> b(4);
+    b = etl::rfft_1d(a);
+
+    etl::dyn_vector<Z> c(7);
+
+    etl::irfft_1d(b, c);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], a[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("irfft_1d/2", "[fast][fft]", Z, float, double) {
+    etl::dyn_vector<Z> a(1046);
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_vector<Z> c(1046);
+
+    c = etl::irfft_1d(etl::rfft_1d(a));
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], a[i], base_eps_etl_large);
+    }
+}
+
+// rfft_2d
+
+TEMPLATE_TEST_CASE_2("rfft_2d/0", "[fast][fft]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 6> a;
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    etl::fast_matrix<std::complex<Z>, 3, 4> c;
+    etl::fast_matrix<std::complex<Z>, 3, 6> ref;
+
+    c   = etl::rfft_2d(a);
+    ref = etl::fft_2d(a);
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            REQUIRE_EQUALS_APPROX_E(c(i, j).real(), ref(i, j).real(), base_eps_etl_large);
+            REQUIRE_EQUALS_APPROX_E(c(i, j).imag(), ref(i, j).imag(), base_eps_etl_large);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("rfft_2d/1", "[fast][fft]", Z, float, double) {
+    etl::dyn_matrix<Z> a(9, 13);
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<std::complex<Z>> c(9, 7);
+    etl::dyn_matrix<std::complex<Z>> ref(9, 13);
+
+    c   = etl::rfft_2d(a);
+    ref = etl::fft_2d(a);
+
+    for (size_t i = 0; i < 9; ++i) {
+        for (size_t j = 0; j < 7; ++j) {
+            REQUIRE_EQUALS_APPROX_E(c(i, j).real(), ref(i, j).real(), base_eps_etl_large);
+            REQUIRE_EQUALS_APPROX_E(c(i, j).imag(), ref(i, j).imag(), base_eps_etl_large);
+        }
+    }
+}
+
+// irfft_2d
+
+TEMPLATE_TEST_CASE_2("irfft_2d/0", "[fast][fft]", Z, float, double) {
+    etl::fast_matrix<Z, 4, 8> a;
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    etl::fast_matrix<Z, 4, 8> c;
+    c = etl::irfft_2d(etl::rfft_2d(a));
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], a[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("irfft_2d/1", "[fast][fft]", Z, float, double) {
+    etl::dyn_matrix<Z> a(5, 7);
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<std::complex<Z>> b(5, 4);
+    b = etl::rfft_2d(a);
+
+    etl::dyn_matrix<Z> c(5, 7);
+
+    etl::irfft_2d(b, c);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], a[i], base_eps_etl_large);
+    }
+}
@@ -106,3 +106,446 @@ TEMPLATE_TEST_CASE_2("serializer/4", "[serializer]", Z, float, double) {
     REQUIRE_EQUALS(a[4], 0.0);
     REQUIRE_EQUALS(a[5], 2.5);
 }
+
+TEMPLATE_TEST_CASE_2("serializer/5", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z> a_memory(2, 3, etl::values<Z>(1.0, 3.0, -4.0, -1.0, 0.0, 2.5));
+    etl::dyn_matrix<Z> b_memory(2, 3);
+
+    auto a = etl::custom_dyn_matrix<Z>(a_memory.memory_start(), 2, 3);
+    auto b = etl::custom_dyn_matrix<Z>(b_memory.memory_start(), 2, 3);
+
+    {
+        etl::serializer<std::ofstream> serializer("test5.tmp.etl", std::ios::binary);
+        serializer << a;
+    }
+
+    {
+        etl::deserializer<std::ifstream> deserializer("test5.tmp.etl", std::ios::binary);
+        deserializer >> b;
+    }
+
+    for (size_t i = 0; i < 6; ++i) {
+        REQUIRE_EQUALS(b[i], a[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("serializer/6", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z> a_memory(2, 3);
+    etl::dyn_matrix<Z> b_memory(3, 2);
+
+    a_memory = etl::sequence_generator<Z>(1.0);
+    b_memory = Z(-1.0);
+
+    auto a = etl::custom_dyn_matrix<Z>(a_memory.memory_start(), 2, 3);
+    auto b = etl::custom_dyn_matrix<Z>(b_memory.memory_start(), 3, 2);
+
+    {
+        etl::serializer<std::ofstream> serializer("test6.tmp.etl", std::ios::binary);
+        serializer << a;
+    }
+
+    // The dimensions do not match, nothing is read
+    etl::deserializer<std::ifstream> deserializer("test6.tmp.etl", std::ios::binary);
+    deserializer >> b;
+
+    REQUIRE_DIRECT(!deserializer.stream);
+
+    for (size_t i = 0; i < 6; ++i) {
+        REQUIRE_EQUALS(b[i], Z(-1.0));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("binary_format/1", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(2, 3, 5);
+    etl::fast_matrix<Z, 3, 7> b;
+    etl::dyn_matrix<Z> c_memory(4, 3);
+
+    a = etl::sequence_generator<Z>(1.0) * 0.5;
+    b = etl::sequence_generator<Z>(-10.0) * 0.25;
+    c_memory = etl::sequence_generator<Z>(3.0);
+
+    auto c = etl::custom_dyn_matrix<Z>(c_memory.memory_start(), 4, 3);
+
+    std::stringstream stream;
+
+    REQUIRE_DIRECT(etl::save_binary(stream, a, true) == etl::binary_status::OK);
+    REQUIRE_DIRECT(etl::save_binary(stream, b) == etl::binary_status::OK);
+    REQUIRE_DIRECT(etl::save_binary(stream, c, true) == etl::binary_status::OK);
+
+    etl::dyn_matrix<Z, 3> aa;
+    etl::fast_matrix<Z, 3, 7> bb;
+    etl::dyn_matrix<Z> cc_memory(4, 3);
+
+    auto cc = etl::custom_dyn_matrix<Z>(cc_memory.memory_start(), 4, 3);
+
+    REQUIRE_DIRECT(etl::load_binary(stream, aa) == etl::binary_status::OK);
+    REQUIRE_DIRECT(etl::load_binary(stream, bb) == etl::binary_status::OK);
+    REQUIRE_DIRECT(etl::load_binary(stream, cc) == etl::binary_status::OK);
+
+    REQUIRE_EQUALS(etl::dim(aa, 0), 2UL);
+    REQUIRE_EQUALS(etl::dim(aa, 1), 3UL);
+    REQUIRE_EQUALS(etl::dim(aa, 2), 5UL);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS(aa[i], a[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(b); ++i) {
+        REQUIRE_EQUALS(bb[i], b[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS(cc[i], c[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("binary_format/2", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z> a(3, 4);
+    a = etl::sequence_generator<Z>(1.0);
+
+    std::stringstream stream;
+    etl::save_binary(stream, a, true);
+
+    const std::string file = stream.str();
+
+    // The values start at an aligned offset
+    REQUIRE_EQUALS(file.size(), etl::binary_format_alignment + etl::size(a) * sizeof(Z) + 8);
+
+    auto load = [](const std::string& content, auto& matrix) {
+        std::stringstream is(content);
+        return etl::load_binary(is, matrix);
+    };
+
+    etl::dyn_matrix<int> b;
+    etl::fast_matrix<Z, 4, 3> c;
+    etl::dyn_matrix<Z, 3> d;
+    etl::dyn_matrix_cm<Z> e;
+    etl::dyn_matrix<Z> f;
+
+    REQUIRE_DIRECT(load(file, b) == etl::binary_status::BAD_TYPE);
+    REQUIRE_DIRECT(load(file, c) == etl::binary_status::BAD_DIMENSIONS);
+    REQUIRE_DIRECT(load(file, d) == etl::binary_status::BAD_DIMENSIONS);
+    REQUIRE_DIRECT(load(file, e) == etl::binary_status::BAD_ORDER);
+    REQUIRE_DIRECT(load("ETL", f) == etl::binary_status::IO_ERROR);
+    REQUIRE_DIRECT(load("ETLA" + file.substr(4), f) == etl::binary_status::BAD_MAGIC);
+    REQUIRE_DIRECT(load(file.substr(0, file.size() - 20), f) == etl::binary_status::IO_ERROR);
+
+    std::string corrupted = file;
+    corrupted[etl::binary_format_alignment + 5] ^= 0x10;
+
+    REQUIRE_DIRECT(load(corrupted, f) == etl::binary_status::BAD_CHECKSUM);
+    REQUIRE_DIRECT(load(file, f) == etl::binary_status::OK);
+    REQUIRE_EQUALS(f(2, 3), Z(12.0));
+}
+
+TEMPLATE_TEST_CASE_2("binary_format/3", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z> a(3, 5);
+    a = etl::sequence_generator<Z>(-2.0) * 0.75;
+
+    std::stringstream stream;
+    etl::save_binary(stream, a);
+
+    // Simulate a file written with the other byte order
+    std::string file = stream.str();
+
+    auto swap = [&file](size_t offset, size_t width) { std::reverse(file.begin() + offset, file.begin() + offset + width); };
+
+    swap(4, 4);  // Byte-order mark
+    swap(8, 2);  // Version
+    swap(14, 2); // Dimensions
+    swap(16, 4); // Alignment
+    swap(20, 8); // First dimension
+    swap(28, 8); // Second dimension
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        swap(etl::binary_format_alignment + i * sizeof(Z), sizeof(Z));
+    }
+
+    std::stringstream is(file);
+
+    etl::dyn_matrix<Z> b;
+    REQUIRE_DIRECT(etl::load_binary(is, b) == etl::binary_status::OK);
+
+    REQUIRE_EQUALS(etl::dim(b, 0), 3UL);
+    REQUIRE_EQUALS(etl::dim(b, 1), 5UL);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS(b[i], a[i]);
+    }
+}
+
+#if ETL_MMAP_BOOL
+
+TEMPLATE_TEST_CASE_2("mapped_matrix/1", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z> a(33, 17);
+    a = etl::sequence_generator<Z>(-10.0) * 0.5;
+
+    {
+        std::ofstream os("test_mapped_1.tmp.etl", std::ios::binary);
+        REQUIRE_DIRECT(etl::save_binary(os, a, true) == etl::binary_status::OK);
+    }
+
+    etl::mapped_matrix<Z> mapped("test_mapped_1.tmp.etl");
+
+    REQUIRE_DIRECT(mapped.status() == etl::binary_status::OK);
+    REQUIRE_DIRECT(mapped.verify() == etl::binary_status::OK);
+    REQUIRE_EQUALS(mapped.dim(0), 33UL);
+    REQUIRE_EQUALS(mapped.dim(1), 17UL);
+    REQUIRE_EQUALS(mapped.size(), 33UL * 17UL);
+    REQUIRE_EQUALS(reinterpret_cast<uintptr_t>(mapped.memory_start()) % etl::binary_format_alignment, 0UL);
+
+    auto m = mapped.matrix();
+
+    // The read-only pages cannot be modified through the view
+    static_assert(std::is_same_v<decltype(m[0]), const Z&>);
+    static_assert(std::is_same_v<decltype(m(0, 0)), const Z&>);
+
+    REQUIRE_EQUALS(etl::dim<0>(m), 33UL);
+    REQUIRE_EQUALS(etl::dim<1>(m), 17UL);
+
+    etl::dyn_matrix<Z> c(33, 17);
+    c = m + a;
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS(m[i], a[i]);
+        REQUIRE_EQUALS(c[i], Z(2) * a[i]);
+    }
+
+    REQUIRE_EQUALS_APPROX(etl::sum(m), etl::sum(a));
+}
+
+TEMPLATE_TEST_CASE_2("mapped_matrix/2", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(2, 3, 4);
+    a = etl::sequence_generator<Z>(1.0);
+
+    {
+        std::ofstream os("test_mapped_2.tmp.etl", std::ios::binary);
+        REQUIRE_DIRECT(etl::save_binary(os, a) == etl::binary_status::OK);
+    }
+
+    {
+        etl::mapped_matrix<Z, 3> mapped("test_mapped_2.tmp.etl", etl::map_mode::COPY_ON_WRITE);
+        REQUIRE_DIRECT(mapped.status() == etl::binary_status::OK);
+
+        auto m = mapped.mutable_matrix();
+        m *= 2.0;
+
+        for (size_t i = 0; i < etl::size(a); ++i) {
+            REQUIRE_EQUALS(m[i], Z(2) * a[i]);
+        }
+
+        // The modified pages are private to the mapping
+        etl::mapped_matrix<Z, 3> other("test_mapped_2.tmp.etl");
+        REQUIRE_DIRECT(other.status() == etl::binary_status::OK);
+
+        for (size_t i = 0; i < etl::size(a); ++i) {
+            REQUIRE_EQUALS(other.matrix()[i], a[i]);
+        }
+
+        // Move transfers the mapping
+        auto moved = std::move(mapped);
+        REQUIRE_DIRECT(moved.status() == etl::binary_status::OK);
+        REQUIRE_DIRECT(mapped.status() != etl::binary_status::OK);
+        REQUIRE_EQUALS(moved.matrix()[0], Z(2));
+    }
+
+    etl::dyn_matrix<Z, 3> b;
+    std::ifstream is("test_mapped_2.tmp.etl", std::ios::binary);
+    REQUIRE_DIRECT(etl::load_binary(is, b) == etl::binary_status::OK);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS(b[i], a[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("mapped_matrix/3", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z> a(4, 6);
+    a = etl::sequence_generator<Z>(1.0);
+
+    std::stringstream stream;
+    etl::save_binary(stream, a, true);
+    std::string file = stream.str();
+
+    auto write = [](const std::string& content) {
+        std::ofstream os("test_mapped_3.tmp.etl", std::ios::binary);
+        os.write(content.data(), content.size());
+    };
+
+    REQUIRE_DIRECT(etl::mapped_matrix<Z>("test_mapped_missing.tmp.etl").status() == etl::binary_status::IO_ERROR);
+
+    write(file);
+
+    REQUIRE_DIRECT(etl::mapped_matrix<Z>("test_mapped_3.tmp.etl").status() == etl::binary_status::OK);
+    REQUIRE_DIRECT((etl::mapped_matrix<Z, 3>("test_mapped_3.tmp.etl").status() == etl::binary_status::BAD_DIMENSIONS));
+    REQUIRE_DIRECT((etl::mapped_matrix<Z, 2, etl::order::ColumnMajor>("test_mapped_3.tmp.etl").status() == etl::binary_status::BAD_ORDER));
+    REQUIRE_DIRECT(etl::mapped_matrix<int>("test_mapped_3.tmp.etl").status() == etl::binary_status::BAD_TYPE);
+
+    // Truncated values
+    write(file.substr(0, file.size() - 12));
+
+    etl::mapped_matrix<Z> truncated("test_mapped_3.tmp.etl");
+    REQUIRE_DIRECT(truncated.status() == etl::binary_status::IO_ERROR);
+    REQUIRE_EQUALS(truncated.size(), 0UL);
+
+    // Corrupted values are detected by verify
+    std::string corrupted = file;
+    corrupted[etl::binary_format_alignment + 3] ^= 0x10;
+    write(corrupted);
+
+    etl::mapped_matrix<Z> bad("test_mapped_3.tmp.etl");
+    REQUIRE_DIRECT(bad.status() == etl::binary_status::OK);
+    REQUIRE_DIRECT(bad.verify() == etl::binary_status::BAD_CHECKSUM);
+}
+
+TEMPLATE_TEST_CASE_2("mapped_matrix/4", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z> a(3, 5);
+    a = etl::sequence_generator<Z>(-2.0) * 0.75;
+
+    std::stringstream stream;
+    etl::save_binary(stream, a);
+
+    // Simulate a file written with the other byte order
+    std::string file = stream.str();
+
+    auto swap = [&file](size_t offset, size_t width) { std::reverse(file.begin() + offset, file.begin() + offset + width); };
+
+    swap(4, 4);  // Byte-order mark
+    swap(8, 2);  // Version
+    swap(14, 2); // Dimensions
+    swap(16, 4); // Alignment
+    swap(20, 8); // First dimension
+    swap(28, 8); // Second dimension
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        swap(etl::binary_format_alignment + i * sizeof(Z), sizeof(Z));
+    }
+
+    {
+        std::ofstream os("test_mapped_4.tmp.etl", std::ios::binary);
+        os.write(file.data(), file.size());
+    }
+
+    etl::mapped_matrix<Z> mapped("test_mapped_4.tmp.etl");
+    REQUIRE_DIRECT(mapped.status() == etl::binary_status::OK);
+    REQUIRE_EQUALS(mapped.dim(0), 3UL);
+    REQUIRE_EQUALS(mapped.dim(1), 5UL);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS(mapped.matrix()[i], a[i]);
+    }
+}
+
+#endif
+
+TEMPLATE_TEST_CASE_2("chunk_stream/1", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z> a(1001, 7);
+    a = etl::sequence_generator<Z>(1.0);
+
+    {
+        etl::chunk_writer<Z> writer("test_chunk_1.tmp.etl", 7);
+
+        // A batch, a single sample and another batch
+        REQUIRE_DIRECT(writer.write(etl::slice(a, 0, 300)) == etl::binary_status::OK);
+        REQUIRE_DIRECT(writer.write(a(300)) == etl::binary_status::OK);
+        REQUIRE_DIRECT(writer.write(etl::slice(a, 301, 1001)) == etl::binary_status::OK);
+        REQUIRE_EQUALS(writer.samples(), 1001UL);
+
+        etl::dyn_matrix<Z> wrong(2, 6);
+        REQUIRE_DIRECT(writer.write(wrong) == etl::binary_status::BAD_DIMENSIONS);
+    }
+
+    etl::chunk_reader<Z> reader("test_chunk_1.tmp.etl", 64, 2);
+
+    REQUIRE_DIRECT(reader.status() == etl::binary_status::OK);
+    REQUIRE_EQUALS(reader.samples(), 1001UL);
+    REQUIRE_EQUALS(reader.dim(1), 7UL);
+    REQUIRE_EQUALS(reader.batches(), 16UL);
+
+    size_t batches = 0;
+    size_t sample  = 0;
+
+    for (auto& batch : reader) {
+        REQUIRE_EQUALS(etl::dim<0>(batch), batches < 15 ? 64UL : 41UL);
+        REQUIRE_EQUALS(etl::dim<1>(batch), 7UL);
+
+        for (size_t i = 0; i < etl::dim<0>(batch); ++i) {
+            for (size_t j = 0; j < 7; ++j) {
+                REQUIRE_EQUALS(batch(i, j), a(sample + i, j));
+            }
+        }
+
+        sample += etl::dim<0>(batch);
+        ++batches;
+    }
+
+    REQUIRE_EQUALS(batches, 16UL);
+    REQUIRE_EQUALS(sample, 1001UL);
+    REQUIRE_DIRECT(reader.status() == etl::binary_status::OK);
+    REQUIRE_DIRECT(!reader.next());
+
+    // The file is a regular binary file
+    etl::dyn_matrix<Z> b;
+    std::ifstream is("test_chunk_1.tmp.etl", std::ios::binary);
+    REQUIRE_DIRECT(etl::load_binary(is, b) == etl::binary_status::OK);
+    REQUIRE_EQUALS(etl::dim<0>(b), 1001UL);
+    REQUIRE_EQUALS(etl::dim<1>(b), 7UL);
+    REQUIRE_EQUALS(b(1000, 6), a(1000, 6));
+}
+
+TEMPLATE_TEST_CASE_2("chunk_stream/2", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(50, 3, 4);
+    a = etl::sequence_generator<Z>(1.0);
+
+    {
+        etl::chunk_writer<Z, 3> writer("test_chunk_2.tmp.etl", 3, 4);
+        REQUIRE_DIRECT(writer.write(a) == etl::binary_status::OK);
+        REQUIRE_DIRECT(writer.close() == etl::binary_status::OK);
+    }
+
+    etl::chunk_reader<Z, 3> reader("test_chunk_2.tmp.etl", 16);
+    REQUIRE_DIRECT(reader.status() == etl::binary_status::OK);
+
+    // Stop in the middle of the first pass
+    REQUIRE_DIRECT(reader.next());
+    REQUIRE_DIRECT(reader.next());
+    REQUIRE_EQUALS(reader.batch()(0, 0, 0), a(16, 0, 0));
+
+    for (size_t epoch = 0; epoch < 2; ++epoch) {
+        reader.rewind();
+
+        Z sum       = 0;
+        size_t rows = 0;
+
+        while (reader.next()) {
+            sum += etl::sum(reader.batch());
+            rows += etl::dim<0>(reader.batch());
+        }
+
+        REQUIRE_EQUALS(rows, 50UL);
+        REQUIRE_EQUALS_APPROX(sum, etl::sum(a));
+    }
+
+    // Destruction in the middle of a pass
+    reader.rewind();
+    REQUIRE_DIRECT(reader.next());
+}
+
+TEMPLATE_TEST_CASE_2("chunk_stream/3", "[serializer]", Z, float, double) {
+    REQUIRE_DIRECT(etl::chunk_reader<Z>("test_chunk_missing.tmp.etl", 8).status() == etl::binary_status::IO_ERROR);
+
+    {
+        etl::chunk_writer<Z, 3> writer("test_chunk_3.tmp.etl", 2, 2);
+    }
+
+    {
+        etl::chunk_writer<Z> writer("test_chunk_missing/test_chunk_3.tmp.etl", 2);
+        REQUIRE_DIRECT(writer.close() == etl::binary_status::IO_ERROR);
+    }
+
+    REQUIRE_DIRECT(etl::chunk_reader<Z>("test_chunk_3.tmp.etl", 8).status() == etl::binary_status::BAD_DIMENSIONS);
+
+    etl::chunk_reader<Z, 3> empty("test_chunk_3.tmp.etl", 8);
+    REQUIRE_DIRECT(empty.status() == etl::binary_status::OK);
+    REQUIRE_EQUALS(empty.samples(), 0UL);
+    REQUIRE_DIRECT(empty.begin() == empty.end());
+}
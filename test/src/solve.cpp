@@ -0,0 +1,155 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+namespace {
+
+template <typename A, typename X, typename B>
+void check_solution(const A& a, const X& x, const B& b) {
+    using Z = etl::value_t<B>;
+
+    etl::dyn_matrix<Z, 2> aa(etl::dim<0>(a), etl::dim<1>(a));
+    etl::dyn_matrix<Z, 2> xx(etl::dim<0>(x), etl::size(x) / etl::dim<0>(x));
+    etl::dyn_matrix<Z, 2> ax;
+
+    for (size_t i = 0; i < etl::dim<0>(a); ++i) {
+        for (size_t j = 0; j < etl::dim<1>(a); ++j) {
+            aa(i, j) = a(i, j);
+        }
+    }
+
+    for (size_t i = 0; i < etl::size(x); ++i) {
+        xx[i] = x[i];
+    }
+
+    ax = aa * xx;
+
+    for (size_t i = 0; i < etl::size(b); ++i) {
+        REQUIRE_EQUALS_APPROX_E(ax[i], b[i], 1e-3);
+    }
+}
+
+} // end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("solve/1", "[solve]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> a{2, 1, -1, -3, -1, 2, -2, 1, 2};
+    etl::fast_vector<Z, 3> b{8, -11, -3};
+    etl::fast_vector<Z, 3> x;
+
+    x = etl::solve(a, b);
+
+    REQUIRE_EQUALS_APPROX(x[0], Z(2));
+    REQUIRE_EQUALS_APPROX(x[1], Z(3));
+    REQUIRE_EQUALS_APPROX(x[2], Z(-1));
+}
+
+TEMPLATE_TEST_CASE_2("solve/2", "[solve]", Z, float, double) {
+    const size_t n = 150;
+
+    for (size_t m : {1UL, 70UL, 200UL}) {
+        etl::dyn_matrix<Z, 2> a(n, n);
+        etl::dyn_matrix<Z, 2> b(n, m);
+        etl::dyn_matrix<Z, 2> x(n, m);
+
+        a = etl::uniform_generator(-1.0, 1.0);
+        b = etl::uniform_generator(-1.0, 1.0);
+
+        for (size_t i = 0; i < n; ++i) {
+            a(i, i) += Z(10);
+        }
+
+        x = etl::solve(a, b);
+
+        check_solution(a, x, b);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("solve/3", "[solve]", Z, float, double) {
+    const size_t n = 130;
+
+    etl::dyn_matrix<Z, 2> m(n, n);
+    etl::dyn_matrix<Z, 2> s(n, n);
+    etl::symmetric_matrix<etl::dyn_matrix<Z, 2>> a(n);
+    etl::dyn_vector<Z> b(n);
+    etl::dyn_vector<Z> x(n);
+
+    m = etl::uniform_generator(-1.0, 1.0);
+    s = m + etl::transpose(m);
+
+    for (size_t i = 0; i < n; ++i) {
+        s(i, i) += Z(2 * n);
+    }
+
+    a = s;
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    x = etl::solve(a, b);
+
+    check_solution(s, x, b);
+
+    // Symmetric but not positive definite
+    s(0, 0) = Z(-1);
+    a       = s;
+
+    x = etl::solve(a, b);
+
+    check_solution(s, x, b);
+}
+
+TEMPLATE_TEST_CASE_2("solve/4", "[solve]", Z, float, double) {
+    const size_t n = 140;
+
+    etl::dyn_matrix<Z, 2> m(n, n);
+    etl::dyn_matrix<Z, 2> b(n, 90);
+    etl::dyn_matrix<Z, 2> x(n, 90);
+
+    etl::lower_matrix<etl::dyn_matrix<Z, 2>> l(n);
+    etl::upper_matrix<etl::dyn_matrix<Z, 2>> u(n);
+
+    m = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    for (size_t i = 0; i < n; ++i) {
+        m(i, i) += Z(10);
+
+        for (size_t j = 0; j <= i; ++j) {
+            l(i, j) = m(i, j);
+            u(j, i) = m(j, i);
+        }
+    }
+
+    x = etl::solve(l, b);
+    check_solution(l, x, b);
+
+    x = etl::solve(u, b);
+    check_solution(u, x, b);
+
+    // Only the lower (upper) part of m is used
+
+    x = etl::solve_lower(m, b);
+    check_solution(l, x, b);
+
+    x = etl::solve_upper(m, b);
+    check_solution(u, x, b);
+}
+
+TEMPLATE_TEST_CASE_2("solve/5", "[solve]", Z, float, double) {
+    etl::uni_lower_matrix<etl::fast_matrix<Z, 3, 3>> a;
+    etl::fast_vector<Z, 3> b{1, 4, 12};
+    etl::fast_vector<Z, 3> x;
+
+    a(1, 0) = Z(2);
+    a(2, 0) = Z(3);
+    a(2, 1) = Z(4);
+
+    x = etl::solve(a, b);
+
+    REQUIRE_EQUALS_APPROX(x[0], Z(1));
+    REQUIRE_EQUALS_APPROX(x[1], Z(2));
+    REQUIRE_EQUALS_APPROX(x[2], Z(1));
+}
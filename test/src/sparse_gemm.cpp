@@ -0,0 +1,224 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+namespace {
+
+/*!
+ * \brief Fill the sparse matrix a and the dense matrix d with the same
+ * pseudo-random values, with one non-zero every period elements.
+ */
+template <typename S, typename D>
+void fill_sparse(S& a, D& d, size_t period) {
+    using T = etl::value_t<D>;
+
+    d = 0;
+
+    for (size_t n = 0; n < etl::size(d); n += period) {
+        d[n] = T((n * 7) % 11) - T(5.5);
+    }
+
+    a = d;
+}
+
+} // end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("sparse/gemv/0", "[sparse][gemv]", Z, float, double) {
+    etl::csr_matrix<Z> a(3, 3, std::initializer_list<Z>({0.0, 1.0, 2.0, 3.0, 0.0, 0.0, 0.0, 4.0, 5.0}));
+    etl::csc_matrix<Z> b(a);
+    etl::sparse_matrix<Z> c(3, 3, std::initializer_list<Z>({0.0, 1.0, 2.0, 3.0, 0.0, 0.0, 0.0, 4.0, 5.0}));
+    etl::dyn_vector<Z> x({1.0, 2.0, 3.0});
+    etl::dyn_vector<Z> y(3);
+
+    y = a * x;
+
+    REQUIRE_EQUALS(y[0], Z(8.0));
+    REQUIRE_EQUALS(y[1], Z(3.0));
+    REQUIRE_EQUALS(y[2], Z(23.0));
+
+    y = b * x;
+
+    REQUIRE_EQUALS(y[0], Z(8.0));
+    REQUIRE_EQUALS(y[1], Z(3.0));
+    REQUIRE_EQUALS(y[2], Z(23.0));
+
+    y = c * x;
+
+    REQUIRE_EQUALS(y[0], Z(8.0));
+    REQUIRE_EQUALS(y[1], Z(3.0));
+    REQUIRE_EQUALS(y[2], Z(23.0));
+}
+
+TEMPLATE_TEST_CASE_2("sparse/gemv/1", "[sparse][gemv]", Z, float, double) {
+    etl::dyn_matrix<Z> d(211, 397);
+    etl::csr_matrix<Z> a(211, 397);
+    etl::csc_matrix<Z> b(211, 397);
+    etl::dyn_vector<Z> x(397);
+    etl::dyn_vector<Z> ref(211);
+    etl::dyn_vector<Z> y(211);
+
+    fill_sparse(a, d, 13);
+    fill_sparse(b, d, 13);
+
+    x = etl::sequence_generator<Z>(1.0) * 0.01;
+
+    ref = selected_helper(etl::gemm_impl::STD, d * x);
+
+    y = a * x;
+
+    for (size_t i = 0; i < 211; ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], ref[i]);
+    }
+
+    y = b * (x + x);
+
+    for (size_t i = 0; i < 211; ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], Z(2) * ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse/gemv/2", "[sparse][gemv]", Z, float, double) {
+    etl::dyn_matrix<Z> d(613, 911);
+    etl::csr_matrix<Z> a(613, 911);
+    etl::csc_matrix<Z> b(613, 911);
+    etl::dyn_vector<Z> x(911);
+    etl::dyn_vector<Z> ref(613);
+    etl::dyn_vector<Z> y(613);
+
+    // Dense enough to go over the parallel threshold
+    fill_sparse(a, d, 3);
+    fill_sparse(b, d, 3);
+
+    x = etl::sequence_generator<Z>(1.0) * 0.001;
+
+    ref = selected_helper(etl::gemm_impl::STD, d * x);
+
+    y = a * x;
+
+    for (size_t i = 0; i < 613; ++i) {
+        REQUIRE_EQUALS_APPROX_E(y[i], ref[i], base_eps_etl_large);
+    }
+
+    y = b * x;
+
+    for (size_t i = 0; i < 613; ++i) {
+        REQUIRE_EQUALS_APPROX_E(y[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse/gemm/0", "[sparse][gemm]", Z, float, double) {
+    etl::sparse_matrix<Z> a(2, 3, std::initializer_list<Z>({1.0, 0.0, 2.0, 0.0, 3.0, 0.0}));
+    etl::dyn_matrix<Z> b(3, 2, std::initializer_list<Z>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}));
+    etl::dyn_matrix<Z> c(2, 2);
+
+    c = a * b;
+
+    REQUIRE_EQUALS(c(0, 0), Z(11.0));
+    REQUIRE_EQUALS(c(0, 1), Z(14.0));
+    REQUIRE_EQUALS(c(1, 0), Z(9.0));
+    REQUIRE_EQUALS(c(1, 1), Z(12.0));
+
+    etl::dyn_matrix<Z> d(3, 3);
+
+    d = b * a;
+
+    REQUIRE_EQUALS(d(0, 0), Z(1.0));
+    REQUIRE_EQUALS(d(0, 1), Z(6.0));
+    REQUIRE_EQUALS(d(0, 2), Z(2.0));
+    REQUIRE_EQUALS(d(2, 0), Z(5.0));
+    REQUIRE_EQUALS(d(2, 1), Z(18.0));
+    REQUIRE_EQUALS(d(2, 2), Z(10.0));
+}
+
+TEMPLATE_TEST_CASE_2("sparse/gemm/1", "[sparse][gemm]", Z, float, double) {
+    etl::dyn_matrix<Z> d(97, 131);
+    etl::csr_matrix<Z> a(97, 131);
+    etl::csc_matrix<Z> b(97, 131);
+    etl::dyn_matrix<Z> x(131, 37);
+    etl::dyn_matrix<Z> ref(97, 37);
+    etl::dyn_matrix<Z> y(97, 37);
+
+    fill_sparse(a, d, 7);
+    fill_sparse(b, d, 7);
+
+    x = etl::sequence_generator<Z>(1.0) * 0.001;
+
+    ref = selected_helper(etl::gemm_impl::STD, d * x);
+
+    y = a * x;
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], ref[i]);
+    }
+
+    y = 1.0;
+    y = b * x;
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], ref[i]);
+    }
+
+    // Column-major output goes through the standard kernel
+    etl::dyn_matrix_cm<Z> yc(97, 37);
+
+    yc = a * x;
+
+    for (size_t i = 0; i < 97; ++i) {
+        for (size_t j = 0; j < 37; ++j) {
+            REQUIRE_EQUALS_APPROX(yc(i, j), ref(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse/gemm/2", "[sparse][gemm]", Z, float, double) {
+    etl::dyn_matrix<Z> d(131, 97);
+    etl::csr_matrix<Z> a(131, 97);
+    etl::csc_matrix<Z> b(131, 97);
+    etl::dyn_matrix<Z> x(37, 131);
+    etl::dyn_matrix<Z> ref(37, 97);
+    etl::dyn_matrix<Z> y(37, 97);
+
+    fill_sparse(a, d, 5);
+    fill_sparse(b, d, 5);
+
+    x = etl::sequence_generator<Z>(1.0) * 0.001;
+
+    ref = selected_helper(etl::gemm_impl::STD, x * d);
+
+    y = x * a;
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], ref[i]);
+    }
+
+    y = x * b;
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse/gemm/3", "[sparse][gemm]", Z, float, double) {
+    etl::dyn_matrix<Z> d1(23, 31);
+    etl::dyn_matrix<Z> d2(31, 19);
+    etl::csr_matrix<Z> a(23, 31);
+    etl::csc_matrix<Z> b(31, 19);
+    etl::dyn_matrix<Z> ref(23, 19);
+    etl::dyn_matrix<Z> y(23, 19);
+
+    fill_sparse(a, d1, 3);
+    fill_sparse(b, d2, 4);
+
+    ref = selected_helper(etl::gemm_impl::STD, d1 * d2);
+
+    y = a * b;
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], ref[i]);
+    }
+}
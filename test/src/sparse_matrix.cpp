@@ -344,3 +344,305 @@ TEMPLATE_TEST_CASE_2("sparse_matrix/copy/1", "[mat][reference][sparse]", Z, doub
     REQUIRE_EQUALS(b.get(2, 2), 2.0);
     REQUIRE_EQUALS(b.non_zeros(), 3UL);
 }
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/csr/init/1", "[mat][init][sparse]", Z, double, float) {
+    etl::csr_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0}));
+
+    REQUIRE_DIRECT(etl::is_sparse_matrix<decltype(a)>);
+    REQUIRE_EQUALS(a.rows(), 3UL);
+    REQUIRE_EQUALS(a.columns(), 2UL);
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(1.0));
+    REQUIRE_EQUALS(a.get(0, 1), Z(0.0));
+    REQUIRE_EQUALS(a.get(1, 0), Z(0.0));
+    REQUIRE_EQUALS(a.get(1, 1), Z(2.0));
+    REQUIRE_EQUALS(a.get(2, 0), Z(3.0));
+    REQUIRE_EQUALS(a.get(2, 1), Z(0.0));
+
+    REQUIRE_EQUALS(a.outer_index()[0], 0UL);
+    REQUIRE_EQUALS(a.outer_index()[1], 1UL);
+    REQUIRE_EQUALS(a.outer_index()[2], 2UL);
+    REQUIRE_EQUALS(a.outer_index()[3], 3UL);
+    REQUIRE_EQUALS(a.inner_index()[0], 0UL);
+    REQUIRE_EQUALS(a.inner_index()[1], 1UL);
+    REQUIRE_EQUALS(a.inner_index()[2], 0UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/csc/init/1", "[mat][init][sparse]", Z, double, float) {
+    etl::csc_matrix<Z> a(3, 2, etl::values(0.0, 1.2, 0.0, 2.0, 4.0, 0.01));
+
+    REQUIRE_EQUALS(a.non_zeros(), 4UL);
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(0.0));
+    REQUIRE_EQUALS(a.get(0, 1), Z(1.2));
+    REQUIRE_EQUALS(a.get(1, 0), Z(0.0));
+    REQUIRE_EQUALS(a.get(1, 1), Z(2.0));
+    REQUIRE_EQUALS(a.get(2, 0), Z(4.0));
+    REQUIRE_EQUALS(a.get(2, 1), Z(0.01));
+
+    // Column 0 contains row 2, column 1 contains rows 0, 1 and 2
+    REQUIRE_EQUALS(a.outer_index()[1], 1UL);
+    REQUIRE_EQUALS(a.outer_index()[2], 4UL);
+    REQUIRE_EQUALS(a.inner_index()[0], 2UL);
+    REQUIRE_EQUALS(a.inner_index()[1], 0UL);
+    REQUIRE_EQUALS(a.inner_index()[3], 2UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/csr/set/1", "[mat][set][sparse]", Z, double, float) {
+    etl::csr_matrix<Z> a(3, 4);
+
+    a.set(1, 2, 3.0);
+    a.set(0, 3, 1.0);
+    a(2, 0) = 2.0;
+    a(1, 1) = 4.0;
+
+    REQUIRE_EQUALS(a.non_zeros(), 4UL);
+    REQUIRE_EQUALS(a.get(0, 3), Z(1.0));
+    REQUIRE_EQUALS(a.get(1, 1), Z(4.0));
+    REQUIRE_EQUALS(a.get(1, 2), Z(3.0));
+    REQUIRE_EQUALS(a.get(2, 0), Z(2.0));
+    REQUIRE_EQUALS(a[6], Z(3.0));
+
+    a.set(1, 2, 0.0);
+    a.erase(0, 3);
+    a(2, 0) = 0.0;
+
+    REQUIRE_EQUALS(a.non_zeros(), 1UL);
+    REQUIRE_EQUALS(a.get(0, 3), Z(0.0));
+    REQUIRE_EQUALS(a.get(1, 1), Z(4.0));
+    REQUIRE_EQUALS(a.get(1, 2), Z(0.0));
+    REQUIRE_EQUALS(a.get(2, 0), Z(0.0));
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/csc/set/1", "[mat][set][sparse]", Z, double, float) {
+    etl::csc_matrix<Z> a(3, 4);
+
+    a.set(1, 2, 3.0);
+    a.set(0, 3, 1.0);
+    a.set(2, 2, 5.0);
+    a.set(0, 2, 6.0);
+
+    REQUIRE_EQUALS(a.non_zeros(), 4UL);
+    REQUIRE_EQUALS(a.get(0, 2), Z(6.0));
+    REQUIRE_EQUALS(a.get(1, 2), Z(3.0));
+    REQUIRE_EQUALS(a.get(2, 2), Z(5.0));
+    REQUIRE_EQUALS(a.get(0, 3), Z(1.0));
+
+    a.erase(1, 2);
+
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+    REQUIRE_EQUALS(a.get(0, 2), Z(6.0));
+    REQUIRE_EQUALS(a.get(1, 2), Z(0.0));
+    REQUIRE_EQUALS(a.get(2, 2), Z(5.0));
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/csr/convert/1", "[mat][sparse]", Z, double, float) {
+    etl::sparse_matrix<Z> a(3, 3, std::initializer_list<Z>({0.0, 1.0, 2.0, 3.0, 0.0, 0.0, 0.0, 4.0, 5.0}));
+
+    etl::csr_matrix<Z> b(a);
+    etl::csc_matrix<Z> c(a);
+    etl::csr_matrix<Z> d(c);
+
+    REQUIRE_EQUALS(b.non_zeros(), 5UL);
+    REQUIRE_EQUALS(c.non_zeros(), 5UL);
+    REQUIRE_EQUALS(d.non_zeros(), 5UL);
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            REQUIRE_EQUALS(b.get(i, j), a.get(i, j));
+            REQUIRE_EQUALS(c.get(i, j), a.get(i, j));
+            REQUIRE_EQUALS(d.get(i, j), a.get(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/csr/copy/1", "[mat][sparse]", Z, double, float) {
+    etl::csr_matrix<Z> a(3, 3, std::initializer_list<Z>({0.0, 1.0, 2.0, 3.0, 0.0, 0.0, 0.0, 4.0, 5.0}));
+    etl::csr_matrix<Z> b(a);
+    etl::csr_matrix<Z> c;
+    etl::csr_matrix<Z> d(3, 3);
+
+    c = a;
+    d = a + a;
+
+    a.set(0, 1, 0.0);
+
+    REQUIRE_EQUALS(b.non_zeros(), 5UL);
+    REQUIRE_EQUALS(c.non_zeros(), 5UL);
+    REQUIRE_EQUALS(d.non_zeros(), 5UL);
+    REQUIRE_EQUALS(b.get(0, 1), Z(1.0));
+    REQUIRE_EQUALS(c.get(0, 1), Z(1.0));
+    REQUIRE_EQUALS(d.get(0, 1), Z(2.0));
+    REQUIRE_EQUALS(d.get(2, 2), Z(10.0));
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/triplets/1", "[mat][sparse]", Z, double, float) {
+    std::vector<etl::sparse_triplet<Z>> triplets = {{2, 2, 5.0}, {0, 1, 1.0}, {1, 0, 3.0}, {0, 2, 2.0}, {2, 1, 4.0}, {0, 1, 1.5}, {1, 1, 0.0}};
+
+    auto a = etl::sparse_matrix<Z>::from_triplets(3, 3, triplets);
+    auto b = etl::csr_matrix<Z>::from_triplets(3, 3, triplets);
+    auto c = etl::csc_matrix<Z>::from_triplets(3, 3, triplets);
+
+    // The duplicates are summed and the zeros are not stored
+    REQUIRE_EQUALS(a.non_zeros(), 5UL);
+    REQUIRE_EQUALS(b.non_zeros(), 5UL);
+    REQUIRE_EQUALS(c.non_zeros(), 5UL);
+
+    etl::dyn_matrix<Z> ref(3, 3, std::initializer_list<Z>({0.0, 2.5, 2.0, 3.0, 0.0, 0.0, 0.0, 4.0, 5.0}));
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            REQUIRE_EQUALS(a.get(i, j), ref(i, j));
+            REQUIRE_EQUALS(b.get(i, j), ref(i, j));
+            REQUIRE_EQUALS(c.get(i, j), ref(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/insert_batch/1", "[mat][sparse]", Z, double, float) {
+    etl::sparse_matrix<Z> a(3, 3, std::initializer_list<Z>({0.0, 1.0, 2.0, 3.0, 0.0, 0.0, 0.0, 4.0, 5.0}));
+    etl::csr_matrix<Z> b(3, 3, std::initializer_list<Z>({0.0, 1.0, 2.0, 3.0, 0.0, 0.0, 0.0, 4.0, 5.0}));
+    etl::csc_matrix<Z> c(3, 3, std::initializer_list<Z>({0.0, 1.0, 2.0, 3.0, 0.0, 0.0, 0.0, 4.0, 5.0}));
+
+    // Same as a sequence of set: the last duplicate wins and zero erases
+    std::vector<etl::sparse_triplet<Z>> batch = {{1, 1, 6.0}, {0, 2, 0.0}, {2, 0, 7.0}, {1, 0, 8.0}, {2, 0, 9.0}, {0, 0, 0.0}};
+
+    a.insert_batch(batch);
+    b.insert_batch(batch);
+    c.insert_batch(batch);
+
+    REQUIRE_EQUALS(a.non_zeros(), 6UL);
+    REQUIRE_EQUALS(b.non_zeros(), 6UL);
+    REQUIRE_EQUALS(c.non_zeros(), 6UL);
+
+    etl::dyn_matrix<Z> ref(3, 3, std::initializer_list<Z>({0.0, 1.0, 0.0, 8.0, 6.0, 0.0, 9.0, 4.0, 5.0}));
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            REQUIRE_EQUALS(a.get(i, j), ref(i, j));
+            REQUIRE_EQUALS(b.get(i, j), ref(i, j));
+            REQUIRE_EQUALS(c.get(i, j), ref(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/triplets/2", "[mat][sparse]", Z, double, float) {
+    const size_t n = 500;
+
+    std::vector<etl::sparse_triplet<Z>> triplets;
+
+    for (size_t k = 0; k < 20 * n; ++k) {
+        triplets.push_back({(k * 7919) % n, (k * 104729 + k / n) % n, Z(k % 17) + Z(1)});
+    }
+
+    auto a = etl::sparse_matrix<Z>::from_triplets(n, n, triplets);
+    auto b = etl::csc_matrix<Z>::from_triplets(n, n, triplets);
+
+    // Incremental construction, with amortized growth
+    etl::csr_matrix<Z> c(n, n);
+
+    for (auto& t : triplets) {
+        c(t.i, t.j) += t.value;
+    }
+
+    REQUIRE_EQUALS(a.non_zeros(), c.non_zeros());
+    REQUIRE_EQUALS(b.non_zeros(), c.non_zeros());
+    REQUIRE_DIRECT(c.capacity() >= c.non_zeros());
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS(a.get(i, j), c.get(i, j));
+            REQUIRE_EQUALS(b.get(i, j), c.get(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/add/2", "[mat][add][sparse]", Z, double, float) {
+    etl::csr_matrix<Z> a(3, 3, std::initializer_list<Z>({1.0, 0.0, 2.0, 0.0, 0.0, 3.0, 4.0, 0.0, 0.0}));
+    etl::csc_matrix<Z> b(3, 3, std::initializer_list<Z>({0.0, 5.0, -2.0, 0.0, 0.0, 0.0, 1.0, 0.0, 6.0}));
+
+    etl::csc_matrix<Z> c(3, 3);
+    etl::sparse_matrix<Z> d(3, 3);
+    etl::dyn_matrix<Z> e(3, 3);
+
+    c = a + b;
+    d = a - b;
+    e = a + b;
+
+    // The cancellations are not stored
+    REQUIRE_EQUALS(c.non_zeros(), 5UL);
+    REQUIRE_EQUALS(d.non_zeros(), 6UL);
+
+    etl::dyn_matrix<Z> ref_add(3, 3, std::initializer_list<Z>({1.0, 5.0, 0.0, 0.0, 0.0, 3.0, 5.0, 0.0, 6.0}));
+    etl::dyn_matrix<Z> ref_sub(3, 3, std::initializer_list<Z>({1.0, -5.0, 4.0, 0.0, 0.0, 3.0, 3.0, 0.0, -6.0}));
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            REQUIRE_EQUALS(c.get(i, j), ref_add(i, j));
+            REQUIRE_EQUALS(d.get(i, j), ref_sub(i, j));
+            REQUIRE_EQUALS(e(i, j), ref_add(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/mul/2", "[mat][mul][sparse]", Z, double, float) {
+    etl::csr_matrix<Z> a(3, 3, std::initializer_list<Z>({1.0, 0.0, 2.0, 0.0, 0.0, 3.0, 4.0, 0.0, 0.0}));
+    etl::dyn_matrix<Z> b(3, 3, std::initializer_list<Z>({2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0}));
+
+    etl::csr_matrix<Z> c(3, 3);
+    etl::csc_matrix<Z> d(3, 3);
+    etl::dyn_matrix<Z> e(3, 3);
+
+    c = a >> b;
+    d = b >> a;
+    e = a >> b;
+
+    REQUIRE_EQUALS(c.non_zeros(), 4UL);
+    REQUIRE_EQUALS(d.non_zeros(), 4UL);
+
+    etl::dyn_matrix<Z> ref(3, 3, std::initializer_list<Z>({2.0, 0.0, 8.0, 0.0, 0.0, 21.0, 32.0, 0.0, 0.0}));
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            REQUIRE_EQUALS(c.get(i, j), ref(i, j));
+            REQUIRE_EQUALS(d.get(i, j), ref(i, j));
+            REQUIRE_EQUALS(e(i, j), ref(i, j));
+        }
+    }
+
+    // The dense operand can be the result
+    b = a >> b;
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            REQUIRE_EQUALS(b(i, j), ref(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/scale/1", "[mat][mul][sparse]", Z, double, float) {
+    etl::sparse_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0}));
+    etl::csr_matrix<Z> b(3, 2, std::initializer_list<Z>({2.0, 1.0, 0.0, 3.0, 0.0, 0.0}));
+
+    a = a * Z(2.0);
+    b = Z(3.0) * b;
+
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+    REQUIRE_EQUALS(b.non_zeros(), 3UL);
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(2.0));
+    REQUIRE_EQUALS(a.get(1, 1), Z(4.0));
+    REQUIRE_EQUALS(a.get(2, 0), Z(6.0));
+    REQUIRE_EQUALS(b.get(0, 0), Z(6.0));
+    REQUIRE_EQUALS(b.get(0, 1), Z(3.0));
+    REQUIRE_EQUALS(b.get(1, 1), Z(9.0));
+
+    // The result can alias the operands
+    a = a + a;
+
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+    REQUIRE_EQUALS(a.get(0, 0), Z(4.0));
+    REQUIRE_EQUALS(a.get(1, 1), Z(8.0));
+    REQUIRE_EQUALS(a.get(2, 0), Z(12.0));
+}
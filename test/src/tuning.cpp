@@ -0,0 +1,153 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+#include <fstream>
+
+ETL_TEST_CASE("tuning/defaults/1", "[tuning]") {
+    etl::tuning_profile profile;
+
+    REQUIRE_EQUALS(profile.gemm_rr_small_threshold, etl::gemm_rr_small_threshold);
+    REQUIRE_EQUALS(profile.gemv_cm_small_threshold, etl::gemv_cm_small_threshold);
+    REQUIRE_EQUALS(profile.parallel_threshold, etl::parallel_threshold);
+    REQUIRE_EQUALS(profile.conv4_vec_image_threshold, etl::conv4_vec_image_threshold);
+}
+
+ETL_TEST_CASE("tuning/save_load/1", "[tuning]") {
+    etl::tuning_profile profile;
+
+    profile.gemm_rr_small_threshold = 1234;
+    profile.parallel_threshold      = 99;
+
+    REQUIRE_DIRECT(profile.save("test_tuning.tmp.etl"));
+
+    etl::tuning_profile loaded;
+
+    REQUIRE_DIRECT(loaded.load("test_tuning.tmp.etl"));
+    REQUIRE_EQUALS(loaded.gemm_rr_small_threshold, 1234UL);
+    REQUIRE_EQUALS(loaded.parallel_threshold, 99UL);
+    REQUIRE_EQUALS(loaded.gemv_rm_small_threshold, etl::gemv_rm_small_threshold);
+}
+
+ETL_TEST_CASE("tuning/load/1", "[tuning]") {
+    {
+        std::ofstream stream("test_tuning.tmp.etl");
+        stream << "# comment\n";
+        stream << "gevm_rm_small_threshold 42\n";
+        stream << "unknown_threshold 3\n";
+    }
+
+    etl::tuning_profile profile;
+
+    // The unknown entries are reported, the known ones are still loaded
+    REQUIRE_DIRECT(!profile.load("test_tuning.tmp.etl"));
+    REQUIRE_EQUALS(profile.gevm_rm_small_threshold, 42UL);
+
+    REQUIRE_DIRECT(!profile.load("test_tuning_missing.tmp.etl"));
+}
+
+ETL_TEST_CASE("tuning/global/1", "[tuning]") {
+    const etl::tuning_profile old = etl::tuning();
+
+    etl::tuning_profile profile = old;
+
+    profile.gemm_rr_small_threshold = old.gemm_rr_small_threshold + 1;
+
+    REQUIRE_DIRECT(profile.save("test_tuning.tmp.etl"));
+    REQUIRE_DIRECT(etl::load_tuning_profile("test_tuning.tmp.etl"));
+    REQUIRE_EQUALS(etl::tuning().gemm_rr_small_threshold, old.gemm_rr_small_threshold + 1);
+
+    etl::tuning() = old;
+    REQUIRE_EQUALS(etl::tuning().gemm_rr_small_threshold, old.gemm_rr_small_threshold);
+}
+
+TEMPLATE_TEST_CASE_2("tuning/gemm/1", "[tuning]", Z, float, double) {
+    etl::dyn_matrix<Z> a(17, 23);
+    etl::dyn_matrix<Z> b(23, 19);
+    etl::dyn_matrix<Z> c1(17, 19);
+    etl::dyn_matrix<Z> c2(17, 19);
+    etl::dyn_matrix<Z> ref(17, 19);
+
+    a = etl::sequence_generator<Z>(1.0) * Z(0.01);
+    b = etl::sequence_generator<Z>(1.0) * Z(-0.02);
+
+    SELECTED_SECTION(etl::gemm_impl::STD) {
+        ref = a * b;
+    }
+
+    auto& profile = etl::tuning();
+
+    const size_t old = profile.gemm_rr_small_threshold;
+
+    // Both the small and the large kernels must be correct
+    SELECTED_SECTION(etl::gemm_impl::VEC) {
+        profile.gemm_rr_small_threshold = 0;
+        c1                              = a * b;
+
+        profile.gemm_rr_small_threshold = std::numeric_limits<size_t>::max();
+        c2                              = a * b;
+    }
+
+    profile.gemm_rr_small_threshold = old;
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX(c1[i], ref[i]);
+        REQUIRE_EQUALS_APPROX(c2[i], ref[i]);
+    }
+}
+
+#ifdef ETL_COUNTERS
+
+TEMPLATE_TEST_CASE_2("tuning/counters/1", "[tuning][counters]", Z, float, double) {
+    etl::dyn_vector<Z> a(100);
+    etl::dyn_vector<Z> b(100);
+    etl::dyn_vector<Z> c(100);
+
+    a = etl::sequence_generator<Z>(1.0);
+    b = etl::sequence_generator<Z>(2.0);
+
+    const etl::tuning_profile old = etl::tuning();
+
+    etl::tuning_profile profile = old;
+
+    // A profile that never parallelizes the assignments
+
+    profile.parallel_threshold = std::numeric_limits<size_t>::max();
+
+    REQUIRE_DIRECT(profile.save("test_tuning.tmp.etl"));
+    REQUIRE_DIRECT(etl::load_tuning_profile("test_tuning.tmp.etl"));
+
+    etl::reset_counters();
+
+    c = a + b;
+
+    REQUIRE_EQUALS(etl::counter_value("par:assign") + etl::counter_value("par_vec:assign"), 0UL);
+
+    // A profile that parallelizes all the assignments
+
+    profile.parallel_threshold = 1;
+
+    REQUIRE_DIRECT(profile.save("test_tuning.tmp.etl"));
+    REQUIRE_DIRECT(etl::load_tuning_profile("test_tuning.tmp.etl"));
+
+    etl::reset_counters();
+
+    c = a + b;
+
+    const size_t parallel = etl::is_parallel && etl::threads > 1 ? 1 : 0;
+
+    REQUIRE_EQUALS(etl::counter_value("par:assign") + etl::counter_value("par_vec:assign"), parallel);
+
+    etl::tuning() = old;
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS(c[i], a[i] + b[i]);
+    }
+}
+
+#endif